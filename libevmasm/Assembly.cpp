@@ -30,6 +30,8 @@
 #include <libevmasm/ConstantOptimiser.h>
 #include <libevmasm/GasMeter.h>
 
+#include <libsolutil/ThreadPool.h>
+
 #include <fstream>
 #include <json/json.h>
 
@@ -39,6 +41,19 @@ using namespace solidity::evmasm;
 using namespace solidity::langutil;
 using namespace solidity::util;
 
+namespace
+{
+
+/// Adds @a _assembly and all its direct and indirect sub-assemblies to @a _assemblies.
+void collectAssemblies(Assembly const& _assembly, set<Assembly const*>& _assemblies)
+{
+	if (_assemblies.insert(&_assembly).second)
+		for (size_t subId = 0; subId < _assembly.numSubs(); ++subId)
+			collectAssemblies(_assembly.sub(subId), _assemblies);
+}
+
+}
+
 AssemblyItem const& Assembly::append(AssemblyItem const& _i)
 {
 	assertThrow(m_deposit >= 0, AssemblyException, "Stack underflow.");
@@ -390,28 +405,52 @@ Assembly& Assembly::optimise(bool _enable, EVMVersion _evmVersion, bool _isCreat
 
 Assembly& Assembly::optimise(OptimiserSettings const& _settings)
 {
-	optimiseInternal(_settings, {});
+	ThreadPool threads{_settings.threads};
+	optimiseInternal(_settings, {}, threads);
 	return *this;
 }
 
 map<u256, u256> Assembly::optimiseInternal(
 	OptimiserSettings const& _settings,
-	std::set<size_t> _tagsReferencedFromOutside
+	std::set<size_t> _tagsReferencedFromOutside,
+	ThreadPool& _threads
 )
 {
 	// Run optimisation for sub-assemblies.
+	OptimiserSettings subSettings = _settings;
+	// Disable creation mode for sub-assemblies.
+	subSettings.isCreation = false;
+	// The replacements of a sub-assembly only affect the tags of this sub-assembly,
+	// so all sub-assemblies can be optimised before any of the replacements are applied.
+	vector<map<u256, u256>> subTagReplacements(m_subs.size());
+	vector<exception_ptr> subExceptions(m_subs.size());
+	vector<future<void>> tasks;
+	for (vector<size_t> const& group: subAssemblyGroups())
+		tasks.emplace_back(_threads.submit([&, group]() {
+			for (size_t subId: group)
+				try
+				{
+					subTagReplacements[subId] = m_subs[subId]->optimiseInternal(
+						subSettings,
+						JumpdestRemover::referencedTags(m_items, subId),
+						_threads
+					);
+				}
+				catch (...)
+				{
+					subExceptions[subId] = current_exception();
+					return;
+				}
+		}));
+	for (auto& task: tasks)
+		_threads.wait(task);
+	// Report the failure of the first sub-assembly, just like sequential processing would.
+	for (exception_ptr const& exception: subExceptions)
+		if (exception)
+			rethrow_exception(exception);
 	for (size_t subId = 0; subId < m_subs.size(); ++subId)
-	{
-		OptimiserSettings settings = _settings;
-		// Disable creation mode for sub-assemblies.
-		settings.isCreation = false;
-		map<u256, u256> subTagReplacements = m_subs[subId]->optimiseInternal(
-			settings,
-			JumpdestRemover::referencedTags(m_items, subId)
-		);
 		// Apply the replacements (can be empty).
-		BlockDeduplicator::applyTagReplacement(m_items, subTagReplacements, subId);
-	}
+		BlockDeduplicator::applyTagReplacement(m_items, subTagReplacements[subId], subId);
 
 	map<u256, u256> tagReplacements;
 	// Iterate until no new optimisation possibilities are found.
@@ -428,7 +467,7 @@ map<u256, u256> Assembly::optimiseInternal(
 
 		if (_settings.runPeephole)
 		{
-			PeepholeOptimiser peepOpt{m_items};
+			PeepholeOptimiser peepOpt{m_items, _settings.runSuperoptimiser};
 			while (peepOpt.optimise())
 			{
 				count++;
@@ -467,48 +506,7 @@ map<u256, u256> Assembly::optimiseInternal(
 			// Control flow graph optimization has been here before but is disabled because it
 			// assumes we only jump to tags that are pushed. This is not the case anymore with
 			// function types that can be stored in storage.
-			AssemblyItems optimisedItems;
-
-			bool usesMSize = (find(m_items.begin(), m_items.end(), AssemblyItem{Instruction::MSIZE}) != m_items.end());
-
-			auto iter = m_items.begin();
-			while (iter != m_items.end())
-			{
-				KnownState emptyState;
-				CommonSubexpressionEliminator eliminator{emptyState};
-				auto orig = iter;
-				iter = eliminator.feedItems(iter, m_items.end(), usesMSize);
-				bool shouldReplace = false;
-				AssemblyItems optimisedChunk;
-				try
-				{
-					optimisedChunk = eliminator.getOptimizedItems();
-					shouldReplace = (optimisedChunk.size() < static_cast<size_t>(iter - orig));
-				}
-				catch (StackTooDeepException const&)
-				{
-					// This might happen if the opcode reconstruction is not as efficient
-					// as the hand-crafted code.
-				}
-				catch (ItemNotAvailableException const&)
-				{
-					// This might happen if e.g. associativity and commutativity rules
-					// reorganise the expression tree, but not all leaves are available.
-				}
-
-				if (shouldReplace)
-				{
-					count++;
-					optimisedItems += optimisedChunk;
-				}
-				else
-					copy(orig, iter, back_inserter(optimisedItems));
-			}
-			if (optimisedItems.size() < m_items.size())
-			{
-				m_items = move(optimisedItems);
-				count++;
-			}
+			count += eliminateCommonSubexpressions(_threads);
 		}
 	}
 
@@ -517,12 +515,123 @@ map<u256, u256> Assembly::optimiseInternal(
 			_settings.isCreation,
 			_settings.isCreation ? 1 : _settings.expectedExecutionsPerDeployment,
 			_settings.evmVersion,
-			*this
+			*this,
+			_settings.isCreation ? nullptr : _settings.gasProfile.get()
 		);
 
 	return tagReplacements;
 }
 
+vector<vector<size_t>> Assembly::subAssemblyGroups() const
+{
+	// Union-find on the indices of the sub-assemblies.
+	vector<size_t> parent(m_subs.size());
+	function<size_t(size_t)> root = [&](size_t _subId) {
+		return parent[_subId] == _subId ? _subId : parent[_subId] = root(parent[_subId]);
+	};
+	map<Assembly const*, size_t> firstUser;
+	for (size_t subId = 0; subId < m_subs.size(); ++subId)
+	{
+		parent[subId] = subId;
+		set<Assembly const*> assemblies;
+		collectAssemblies(*m_subs[subId], assemblies);
+		for (Assembly const* assembly: assemblies)
+		{
+			auto [user, inserted] = firstUser.emplace(assembly, subId);
+			if (!inserted)
+				parent[root(subId)] = root(user->second);
+		}
+	}
+
+	map<size_t, vector<size_t>> groups;
+	for (size_t subId = 0; subId < m_subs.size(); ++subId)
+		groups[root(subId)].push_back(subId);
+	vector<vector<size_t>> result;
+	for (auto& group: groups)
+		result.emplace_back(move(group.second));
+	return result;
+}
+
+unsigned Assembly::eliminateCommonSubexpressions(ThreadPool& _threads)
+{
+	bool usesMSize = (find(m_items.begin(), m_items.end(), AssemblyItem{Instruction::MSIZE}) != m_items.end());
+
+	// The basic blocks are analysed independently of each other, each ends with the item
+	// that breaks it (if any).
+	vector<pair<size_t, size_t>> blocks;
+	for (size_t begin = 0, end = 0; end < m_items.size(); begin = end)
+	{
+		while (end < m_items.size() && !SemanticInformation::breaksCSEAnalysisBlock(m_items[end], usesMSize))
+			++end;
+		if (end < m_items.size())
+			++end;
+		blocks.emplace_back(begin, end);
+	}
+
+	// Optimised blocks, or nullopt if the optimised block is not shorter.
+	vector<optional<AssemblyItems>> optimisedBlocks(blocks.size());
+	auto optimiseBlock = [&](size_t _index)
+	{
+		auto [begin, end] = blocks[_index];
+		KnownState emptyState;
+		CommonSubexpressionEliminator eliminator{emptyState};
+		auto blockEnd = m_items.begin() + static_cast<ptrdiff_t>(end);
+		auto iter = eliminator.feedItems(m_items.begin() + static_cast<ptrdiff_t>(begin), blockEnd, usesMSize);
+		assertThrow(iter == blockEnd, OptimizerException, "Unexpected end of basic block.");
+		try
+		{
+			AssemblyItems optimisedBlock = eliminator.getOptimizedItems();
+			if (optimisedBlock.size() < end - begin)
+				optimisedBlocks[_index] = move(optimisedBlock);
+		}
+		catch (StackTooDeepException const&)
+		{
+			// This might happen if the opcode reconstruction is not as efficient
+			// as the hand-crafted code.
+		}
+		catch (ItemNotAvailableException const&)
+		{
+			// This might happen if e.g. associativity and commutativity rules
+			// reorganise the expression tree, but not all leaves are available.
+		}
+	};
+
+	// Most blocks are small, so consecutive blocks are optimised together.
+	size_t const blocksPerTask = max<size_t>(blocks.size() / (4 * _threads.threads()), 1);
+	vector<future<void>> tasks;
+	for (size_t first = 0; first < blocks.size(); first += blocksPerTask)
+		tasks.emplace_back(_threads.submit([&, first]() {
+			for (size_t i = first; i < min(first + blocksPerTask, blocks.size()); ++i)
+				optimiseBlock(i);
+		}));
+	// All tasks have to finish before an exception is propagated.
+	for (auto& task: tasks)
+		_threads.wait(task);
+	for (auto& task: tasks)
+		task.get();
+
+	unsigned count = 0;
+	AssemblyItems optimisedItems;
+	for (size_t i = 0; i < blocks.size(); ++i)
+		if (optimisedBlocks[i])
+		{
+			count++;
+			optimisedItems += move(*optimisedBlocks[i]);
+		}
+		else
+			copy(
+				m_items.begin() + static_cast<ptrdiff_t>(blocks[i].first),
+				m_items.begin() + static_cast<ptrdiff_t>(blocks[i].second),
+				back_inserter(optimisedItems)
+			);
+	if (optimisedItems.size() < m_items.size())
+	{
+		m_items = move(optimisedItems);
+		count++;
+	}
+	return count;
+}
+
 LinkerObject const& Assembly::assemble() const
 {
 	assertThrow(!m_invalid, AssemblyException, "Attempted to assemble invalid Assembly object.");
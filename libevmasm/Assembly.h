@@ -22,6 +22,7 @@
 #include <liblangutil/SourceLocation.h>
 #include <libevmasm/AssemblyItem.h>
 #include <libevmasm/LinkerObject.h>
+#include <libevmasm/GasProfile.h>
 #include <libevmasm/Exceptions.h>
 
 #include <liblangutil/EVMVersion.h>
@@ -36,6 +37,11 @@
 #include <sstream>
 #include <memory>
 
+namespace solidity::util
+{
+class ThreadPool;
+}
+
 namespace solidity::evmasm
 {
 
@@ -111,10 +117,18 @@ public:
 		bool runDeduplicate = false;
 		bool runCSE = false;
 		bool runConstantOptimiser = false;
+		/// Lets the peephole optimiser replace windows by the cheaper equivalents found by the Superoptimiser.
+		bool runSuperoptimiser = false;
 		langutil::EVMVersion evmVersion;
 		/// This specifies an estimate on how often each opcode in this assembly will be executed,
 		/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 		size_t expectedExecutionsPerDeployment = 200;
+		/// Execution counts that replace expectedExecutionsPerDeployment for parts of the
+		/// runtime code, can be null.
+		std::shared_ptr<GasProfile const> gasProfile;
+		/// Number of threads used to optimise independent parts of the assembly concurrently.
+		/// The result does not depend on this setting.
+		size_t threads = 1;
 	};
 
 	/// Modify and return the current assembly such that creation and execution gas usage
@@ -153,7 +167,21 @@ protected:
 	/// Does the same operations as @a optimise, but should only be applied to a sub and
 	/// returns the replaced tags. Also takes an argument containing the tags of this assembly
 	/// that are referenced in a super-assembly.
-	std::map<u256, u256> optimiseInternal(OptimiserSettings const& _settings, std::set<size_t> _tagsReferencedFromOutside);
+	std::map<u256, u256> optimiseInternal(
+		OptimiserSettings const& _settings,
+		std::set<size_t> _tagsReferencedFromOutside,
+		util::ThreadPool& _threads
+	);
+
+	/// @returns the indices of the sub-assemblies grouped such that sub-assemblies that share
+	/// a (nested) sub-assembly are in the same group, in ascending order.
+	/// Different groups can be optimised concurrently.
+	std::vector<std::vector<size_t>> subAssemblyGroups() const;
+
+	/// Runs the common subexpression eliminator on all basic blocks of this assembly,
+	/// using @a _threads to optimise independent blocks concurrently.
+	/// @returns the number of blocks that were replaced by shorter code.
+	unsigned eliminateCommonSubexpressions(util::ThreadPool& _threads);
 
 	unsigned bytesRequired(unsigned subTagSize) const;
 
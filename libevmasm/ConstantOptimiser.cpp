@@ -23,27 +23,89 @@
 #include <libevmasm/ConstantOptimiser.h>
 #include <libevmasm/Assembly.h>
 #include <libevmasm/GasMeter.h>
+#include <libevmasm/GasProfile.h>
+#include <libevmasm/SemanticInformation.h>
 #include <libsolutil/CommonData.h>
 
+#include <map>
+#include <mutex>
+#include <optional>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::evmasm;
 
+namespace
+{
+
+/// Entries of the routine cache. The cache is cleared when it exceeds this size,
+/// which bounds the memory used by long-running compiler processes.
+size_t constexpr c_maxCachedRoutines = 0x10000;
+
+struct RoutineCache
+{
+	mutex guard;
+	map<ConstantRoutineCache::Key, AssemblyItems> routines;
+};
+
+RoutineCache& routineCache()
+{
+	static RoutineCache cache;
+	return cache;
+}
+
+}
+
+AssemblyItems ConstantRoutineCache::routine(Key const& _key, function<AssemblyItems()> const& _compute)
+{
+	RoutineCache& cache = routineCache();
+	{
+		lock_guard<mutex> lock(cache.guard);
+		if (auto it = cache.routines.find(_key); it != cache.routines.end())
+			return it->second;
+	}
+	// Computed without holding the lock. If another thread computes the same entry meanwhile,
+	// both results are equal.
+	AssemblyItems routine = _compute();
+	lock_guard<mutex> lock(cache.guard);
+	if (cache.routines.size() >= c_maxCachedRoutines)
+		cache.routines.clear();
+	cache.routines.emplace(_key, routine);
+	return routine;
+}
+
+void ConstantRoutineCache::clear()
+{
+	RoutineCache& cache = routineCache();
+	lock_guard<mutex> lock(cache.guard);
+	cache.routines.clear();
+}
+
 unsigned ConstantOptimisationMethod::optimiseConstants(
 	bool _isCreation,
 	size_t _runs,
 	langutil::EVMVersion _evmVersion,
-	Assembly& _assembly
+	Assembly& _assembly,
+	GasProfile const* _gasProfile
 )
 {
 	// TODO: design the optimiser in a way this is not needed
 	AssemblyItems& _items = _assembly.items();
 
-	unsigned optimisations = 0;
+	unsigned optimisations = reuseConstantsOnStack(_items);
 	map<AssemblyItem, size_t> pushes;
+	map<u256, size_t> runs;
 	for (AssemblyItem const& item: _items)
 		if (item.type() == Push)
+		{
 			pushes[item]++;
+			size_t itemRuns = _runs;
+			if (_gasProfile)
+				itemRuns = _gasProfile->executions(item.location()).value_or(_runs);
+			auto [it, inserted] = runs.emplace(item.data(), itemRuns);
+			if (!inserted)
+				it->second = max(it->second, itemRuns);
+		}
 	map<u256, AssemblyItems> pendingReplacements;
 	for (auto it: pushes)
 	{
@@ -53,7 +115,7 @@ unsigned ConstantOptimisationMethod::optimiseConstants(
 		Params params;
 		params.multiplicity = it.second;
 		params.isCreation = _isCreation;
-		params.runs = _runs;
+		params.runs = runs.at(item.data());
 		params.evmVersion = _evmVersion;
 		LiteralMethod lit(params, item.data());
 		bigint literalGas = lit.gasNeeded();
@@ -80,6 +142,68 @@ unsigned ConstantOptimisationMethod::optimiseConstants(
 	return optimisations;
 }
 
+unsigned ConstantOptimisationMethod::reuseConstantsOnStack(AssemblyItems& _items)
+{
+	unsigned replacements = 0;
+	// Known values of the top stack elements, the top is at the back.
+	// Elements below the tracked ones are unknown.
+	vector<optional<u256>> stack;
+	auto ensureHeight = [&](size_t _height) {
+		if (stack.size() < _height)
+			stack.insert(stack.begin(), _height - stack.size(), nullopt);
+	};
+	for (AssemblyItem& item: _items)
+	{
+		if (item.type() == Tag)
+		{
+			// Jumps can arrive here with any stack.
+			stack.clear();
+			continue;
+		}
+		else if (item.type() == Push)
+		{
+			u256 value = item.data();
+			if (value >= 0x100)
+				for (size_t depth = 1; depth <= min<size_t>(16, stack.size()); ++depth)
+					if (stack[stack.size() - depth] == value)
+					{
+						item = AssemblyItem(dupInstruction(static_cast<unsigned>(depth)), item.location());
+						replacements++;
+						break;
+					}
+			stack.emplace_back(move(value));
+			continue;
+		}
+		else if (item.type() == Operation && SemanticInformation::isDupInstruction(item))
+		{
+			unsigned depth = getDupNumber(item.instruction());
+			ensureHeight(depth);
+			stack.emplace_back(stack[stack.size() - depth]);
+			continue;
+		}
+		else if (item.type() == Operation && SemanticInformation::isSwapInstruction(item))
+		{
+			unsigned depth = getSwapNumber(item.instruction());
+			ensureHeight(depth + 1);
+			swap(stack.back(), stack[stack.size() - 1 - depth]);
+			continue;
+		}
+
+		ensureHeight(item.arguments());
+		stack.resize(stack.size() - item.arguments());
+		stack.resize(stack.size() + item.returnValues(), nullopt);
+		if (
+			item.type() == UndefinedItem ||
+			item == Instruction::JUMP ||
+			SemanticInformation::terminatesControlFlow(item)
+		)
+			// The code after unconditional jumps and terminating instructions
+			// is only reachable through a tag.
+			stack.clear();
+	}
+	return replacements;
+}
+
 bigint ConstantOptimisationMethod::simpleRunGas(AssemblyItems const& _items)
 {
 	bigint gas = 0;
@@ -30,6 +30,8 @@
 #include <libsolutil/CommonData.h>
 #include <libsolutil/CommonIO.h>
 
+#include <functional>
+#include <tuple>
 #include <vector>
 
 namespace solidity::evmasm
@@ -38,6 +40,47 @@ namespace solidity::evmasm
 class AssemblyItem;
 using AssemblyItems = std::vector<AssemblyItem>;
 class Assembly;
+class GasProfile;
+
+/**
+ * Process-wide memoisation of the routines that compute constants, used by the constant
+ * optimisers of both the legacy code generator and the Yul backend.
+ *
+ * A routine is a sequence of pushes and arithmetic operations that leaves the constant on the stack.
+ * The key contains everything the routine depends on, so the generated code does not depend on
+ * the order in which the entries are added. The cache can be used from several threads.
+ */
+class ConstantRoutineCache
+{
+public:
+	/// The cost models of the backends differ, so their routines are kept apart.
+	enum class CostModel { Legacy, Yul };
+
+	struct Key
+	{
+		CostModel costModel;
+		u256 value;
+		size_t runs;
+		bool isCreation;
+		/// Number of occurrences of the constant in the code, zero if the cost model ignores it.
+		size_t multiplicity;
+		langutil::EVMVersion evmVersion;
+
+		bool operator<(Key const& _other) const
+		{
+			return
+				std::tie(costModel, value, runs, isCreation, multiplicity, evmVersion) <
+				std::tie(_other.costModel, _other.value, _other.runs, _other.isCreation, _other.multiplicity, _other.evmVersion);
+		}
+	};
+
+	/// @returns the routine for @a _key, computed by @a _compute if it is not in the cache yet.
+	/// @a _compute has to be a pure function of the key.
+	static AssemblyItems routine(Key const& _key, std::function<AssemblyItems()> const& _compute);
+
+	/// Removes all entries.
+	static void clear();
+};
 
 /**
  * Abstract base class for one way to change how constants are represented in the code.
@@ -47,14 +90,23 @@ class ConstantOptimisationMethod
 public:
 	/// Tries to optimised how constants are represented in the source code and modifies
 	/// @a _assembly.
+	/// If @a _gasProfile is given, the executions it lists for the location of a constant
+	/// replace @a _runs. Constants that occur several times use the largest value.
 	/// @returns zero if no optimisations could be performed.
 	static unsigned optimiseConstants(
 		bool _isCreation,
 		size_t _runs,
 		langutil::EVMVersion _evmVersion,
-		Assembly& _assembly
+		Assembly& _assembly,
+		GasProfile const* _gasProfile = nullptr
 	);
 
+	/// Replaces pushes of constants that are still on the stack from an earlier push
+	/// in the same block by a DUP, which costs the same gas but is shorter.
+	/// Blocks end at tags and at items that end the control flow.
+	/// @returns the number of replaced pushes.
+	static unsigned reuseConstantsOnStack(AssemblyItems& _items);
+
 protected:
 	/// This is the public API for the optimiser methods, but it doesn't need to be exposed to the caller.
 
@@ -136,7 +188,17 @@ public:
 	explicit ComputeMethod(Params const& _params, u256 const& _value):
 		ConstantOptimisationMethod(_params, _value)
 	{
-		m_routine = findRepresentation(m_value);
+		m_routine = ConstantRoutineCache::routine(
+			{
+				ConstantRoutineCache::CostModel::Legacy,
+				m_value,
+				m_params.runs,
+				m_params.isCreation,
+				m_params.multiplicity,
+				m_params.evmVersion
+			},
+			[&]() { return findRepresentation(m_value); }
+		);
 		assertThrow(
 			checkRepresentation(m_value, m_routine),
 			OptimizerException,
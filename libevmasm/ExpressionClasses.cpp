@@ -27,6 +27,8 @@
 #include <libevmasm/CommonSubexpressionEliminator.h>
 #include <libevmasm/SimplificationRules.h>
 
+#include <boost/functional/hash.hpp>
+
 #include <functional>
 #include <tuple>
 #include <utility>
@@ -36,23 +38,32 @@ using namespace solidity;
 using namespace solidity::evmasm;
 using namespace solidity::langutil;
 
-bool ExpressionClasses::Expression::operator<(ExpressionClasses::Expression const& _other) const
+bool ExpressionClasses::Expression::operator==(ExpressionClasses::Expression const& _other) const
 {
 	assertThrow(!!item && !!_other.item, OptimizerException, "");
 	auto type = item->type();
-	auto otherType = _other.item->type();
-	if (type != otherType)
-		return type < otherType;
+	if (hash != _other.hash || type != _other.item->type())
+		return false;
 	else if (type == Operation)
-	{
-		auto instr = item->instruction();
-		auto otherInstr = _other.item->instruction();
-		return std::tie(instr, arguments, sequenceNumber) <
-			std::tie(otherInstr, _other.arguments, _other.sequenceNumber);
-	}
+		return
+			std::tie(arguments, sequenceNumber) == std::tie(_other.arguments, _other.sequenceNumber) &&
+			item->instruction() == _other.item->instruction();
+	else
+		return
+			std::tie(arguments, sequenceNumber) == std::tie(_other.arguments, _other.sequenceNumber) &&
+			item->data() == _other.item->data();
+}
+
+void ExpressionClasses::Expression::computeHash()
+{
+	assertThrow(!!item, OptimizerException, "");
+	hash = static_cast<size_t>(item->type());
+	if (item->type() == Operation)
+		boost::hash_combine(hash, static_cast<uint8_t>(item->instruction()));
 	else
-		return std::tie(item->data(), arguments, sequenceNumber) <
-			std::tie(_other.item->data(), _other.arguments, _other.sequenceNumber);
+		boost::hash_combine(hash, item->data());
+	boost::hash_range(hash, arguments.begin(), arguments.end());
+	boost::hash_combine(hash, sequenceNumber);
 }
 
 ExpressionClasses::Id ExpressionClasses::find(
@@ -70,6 +81,7 @@ ExpressionClasses::Id ExpressionClasses::find(
 
 	if (SemanticInformation::isCommutativeOperation(_item))
 		sort(exp.arguments.begin(), exp.arguments.end());
+	exp.computeHash();
 
 	if (SemanticInformation::isDeterministic(_item))
 	{
@@ -107,6 +119,7 @@ void ExpressionClasses::forceEqual(
 
 	if (SemanticInformation::isCommutativeOperation(_item))
 		sort(exp.arguments.begin(), exp.arguments.end());
+	exp.computeHash();
 
 	if (_copyItem)
 		exp.item = storeItem(_item);
@@ -119,6 +132,7 @@ ExpressionClasses::Id ExpressionClasses::newClass(SourceLocation const& _locatio
 	Expression exp;
 	exp.id = m_representatives.size();
 	exp.item = storeItem(AssemblyItem(UndefinedItem, (u256(1) << 255) + exp.id, _location));
+	exp.computeHash();
 	m_representatives.push_back(exp);
 	m_expressions.insert(exp);
 	return exp.id;
@@ -150,7 +164,7 @@ bool ExpressionClasses::knownNonZero(Id _c)
 
 u256 const* ExpressionClasses::knownConstant(Id _c)
 {
-	map<unsigned, Expression const*> matchGroups;
+	Pattern::MatchGroups matchGroups{};
 	Pattern constant(Push);
 	constant.setMatchGroup(1, matchGroups);
 	if (!constant.matches(representative(_c), *this))
@@ -183,7 +197,8 @@ string ExpressionClasses::fullDAGToString(ExpressionClasses::Id _id) const
 
 ExpressionClasses::Id ExpressionClasses::tryToSimplify(Expression const& _expr)
 {
-	static Rules rules;
+	// The rules store the match groups of the current match, so every thread needs its own copy.
+	thread_local Rules rules;
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
 	if (
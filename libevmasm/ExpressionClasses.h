@@ -31,6 +31,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <unordered_set>
 
 namespace solidity::langutil
 {
@@ -60,8 +61,12 @@ public:
 		Ids arguments;
 		/// Storage modification sequence, only used for storage and memory operations.
 		unsigned sequenceNumber = 0;
+		/// Hash of (item->type(), item->data(), arguments, sequenceNumber), set by @a computeHash.
+		size_t hash = 0;
 		/// Behaves as if this was a tuple of (item->type(), item->data(), arguments, sequenceNumber).
-		bool operator<(Expression const& _other) const;
+		bool operator==(Expression const& _other) const;
+		/// Sets @a hash from the current item, arguments and sequence number.
+		void computeHash();
 	};
 
 	/// Retrieves the id of the expression equivalence class resulting from the given item applied to the
@@ -121,8 +126,12 @@ private:
 
 	/// Expression equivalence class representatives - we only store one item of an equivalence.
 	std::vector<Expression> m_representatives;
+	struct ExpressionHash
+	{
+		size_t operator()(Expression const& _expression) const { return _expression.hash; }
+	};
 	/// All expression ever encountered.
-	std::set<Expression> m_expressions;
+	std::unordered_set<Expression, ExpressionHash> m_expressions;
 	std::vector<std::shared_ptr<AssemblyItem>> m_spareAssemblyItems;
 };
 
@@ -0,0 +1,133 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * @file GasProfile.cpp
+ * Execution counts of source ranges used for profile-guided optimisation.
+ */
+
+#include <libevmasm/GasProfile.h>
+
+#include <libevmasm/Exceptions.h>
+
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::evmasm;
+using namespace solidity::util;
+
+namespace
+{
+
+size_t executionsFromJson(Json::Value const& _json, string const& _context)
+{
+	if (!_json.isUInt64())
+		BOOST_THROW_EXCEPTION(
+			GasProfileError() << errinfo_comment("The executions of " + _context + " must be an unsigned number.")
+		);
+	return static_cast<size_t>(_json.asUInt64());
+}
+
+void expectObject(Json::Value const& _json, string const& _context)
+{
+	if (!_json.isObject())
+		BOOST_THROW_EXCEPTION(GasProfileError() << errinfo_comment(_context + " must be an object."));
+}
+
+}
+
+GasProfile GasProfile::fromJson(Json::Value const& _json)
+{
+	GasProfile profile;
+	expectObject(_json, "The gas profile");
+	for (string const& key: _json.getMemberNames())
+		if (key != "ranges" && key != "functions")
+			BOOST_THROW_EXCEPTION(GasProfileError() << errinfo_comment("Unknown key in gas profile: \"" + key + "\""));
+
+	if (_json.isMember("ranges"))
+	{
+		if (!_json["ranges"].isArray())
+			BOOST_THROW_EXCEPTION(GasProfileError() << errinfo_comment("The ranges of the gas profile must be an array."));
+		for (Json::Value const& range: _json["ranges"])
+		{
+			expectObject(range, "A range of the gas profile");
+			if (!range["source"].isString() || !range["start"].isInt() || !range["end"].isInt())
+				BOOST_THROW_EXCEPTION(GasProfileError() << errinfo_comment(
+					"A range of the gas profile needs a source name and integer start and end positions."
+				));
+			string context = "range " + range["source"].asString() + ":" + range["start"].asString() + "-" + range["end"].asString();
+			if (range["start"].asInt() < 0 || range["end"].asInt() < range["start"].asInt())
+				BOOST_THROW_EXCEPTION(GasProfileError() << errinfo_comment("Invalid gas profile " + context + "."));
+			profile.addRange({
+				range["source"].asString(),
+				range["start"].asInt(),
+				range["end"].asInt(),
+				executionsFromJson(range["executions"], context)
+			});
+		}
+	}
+
+	if (_json.isMember("functions"))
+	{
+		expectObject(_json["functions"], "The functions of the gas profile");
+		for (string const& source: _json["functions"].getMemberNames())
+		{
+			Json::Value const& contracts = _json["functions"][source];
+			expectObject(contracts, "The contracts of source " + source + " in the gas profile");
+			for (string const& contract: contracts.getMemberNames())
+			{
+				expectObject(contracts[contract], "The functions of contract " + contract + " in the gas profile");
+				for (string const& function: contracts[contract].getMemberNames())
+					profile.m_functions[source][contract][function] = executionsFromJson(
+						contracts[contract][function],
+						"function " + source + ":" + contract + "." + function
+					);
+			}
+		}
+	}
+
+	profile.m_hash = keccak256(jsonCompactPrint(_json));
+	return profile;
+}
+
+void GasProfile::addRange(Range _range)
+{
+	m_ranges[_range.source].emplace_back(move(_range));
+}
+
+optional<size_t> GasProfile::executions(langutil::SourceLocation const& _location) const
+{
+	if (!_location.source || _location.start < 0 || _location.end < _location.start)
+		return nullopt;
+	auto ranges = m_ranges.find(_location.source->name());
+	if (ranges == m_ranges.end())
+		return nullopt;
+
+	Range const* innermost = nullptr;
+	for (Range const& range: ranges->second)
+		if (
+			range.start <= _location.start &&
+			_location.end <= range.end &&
+			(!innermost || range.end - range.start < innermost->end - innermost->start)
+		)
+			innermost = &range;
+	if (innermost)
+		return innermost->executions;
+	return nullopt;
+}
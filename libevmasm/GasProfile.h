@@ -0,0 +1,90 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * @file GasProfile.h
+ * Execution counts of source ranges used for profile-guided optimisation.
+ */
+
+#pragma once
+
+#include <liblangutil/SourceLocation.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <json/json.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace solidity::evmasm
+{
+
+/**
+ * Execution counts of source ranges and functions, e.g. taken from traces of the deployed
+ * contracts. The counts have the same meaning as the "runs" setting, i.e. they are the expected
+ * number of executions over the lifetime of the contract, and replace it for the code in
+ * the range. Code outside of all ranges uses "runs".
+ *
+ * JSON format, all keys are optional:
+ * {
+ *   "ranges": [{"source": "a.sol", "start": 120, "end": 480, "executions": 50000}],
+ *   "functions": {"a.sol": {"C": {"transfer": 50000, "setOwner": 0}}}
+ * }
+ * Functions are turned into the ranges of their definitions by the compiler,
+ * names that do not match any function are ignored.
+ */
+class GasProfile
+{
+public:
+	struct Range
+	{
+		std::string source;
+		int start = -1;
+		int end = -1;
+		size_t executions = 0;
+	};
+	/// Executions by source, contract and function name.
+	using FunctionExecutions = std::map<std::string, std::map<std::string, std::map<std::string, size_t>>>;
+
+	/// Parses the JSON format described above.
+	/// @throws GasProfileError if @a _json is malformed.
+	static GasProfile fromJson(Json::Value const& _json);
+
+	/// Adds a range, e.g. the definition of a function listed in functions().
+	void addRange(Range _range);
+
+	/// @returns the executions of the innermost range that contains @a _location
+	/// or nullopt if there is none.
+	std::optional<size_t> executions(langutil::SourceLocation const& _location) const;
+
+	FunctionExecutions const& functions() const { return m_functions; }
+
+	/// @returns the hash of the JSON the profile was read from, which identifies it
+	/// e.g. in the metadata. Adding ranges does not change it.
+	util::h256 const& hash() const { return m_hash; }
+
+private:
+	/// Ranges by source name.
+	std::map<std::string, std::vector<Range>> m_ranges;
+	FunctionExecutions m_functions;
+	util::h256 m_hash;
+};
+
+}
@@ -186,11 +186,12 @@ KnownState::StoreOperation KnownState::feedItem(AssemblyItem const& _item, bool
 /// _this which is not in or not equal to the value in _other.
 template <class Mapping> void intersect(Mapping& _this, Mapping const& _other)
 {
-	for (auto it = _this.begin(); it != _this.end();)
-		if (_other.count(it->first) && _other.at(it->first) == it->second)
-			++it;
-		else
-			it = _this.erase(it);
+	Mapping common;
+	common.reserve(_this.size());
+	for (auto const& item: _this)
+		if (_other.count(item.first) && _other.at(item.first) == item.second)
+			common.emplace_hint(common.end(), item);
+	_this = move(common);
 }
 
 void KnownState::reduceToCommonKnowledge(KnownState const& _other, bool _combineSequenceNumbers)
@@ -222,9 +223,10 @@ void KnownState::reduceToCommonKnowledge(KnownState const& _other, bool _combine
 	// Use the smaller stack height. Essential to terminate in case of loops.
 	if (m_stackHeight > _other.m_stackHeight)
 	{
-		map<int, Id> shiftedStack;
+		StackElements shiftedStack;
+		shiftedStack.reserve(m_stackElements.size());
 		for (auto const& stackElement: m_stackElements)
-			shiftedStack[stackElement.first - stackDiff] = stackElement.second;
+			shiftedStack.emplace_hint(shiftedStack.end(), stackElement.first - stackDiff, stackElement.second);
 		m_stackElements = move(shiftedStack);
 		m_stackHeight = _other.m_stackHeight;
 	}
@@ -305,7 +307,7 @@ KnownState::StoreOperation KnownState::storeInStorage(
 	// are different from _slot or locations where we know that the stored value is equal to _value.
 	for (auto const& storageItem: m_storageContent)
 		if (m_expressionClasses->knownToBeDifferent(storageItem.first, _slot) || storageItem.second == _value)
-			storageContents.insert(storageItem);
+			storageContents.emplace_hint(storageContents.end(), storageItem);
 	m_storageContent = move(storageContents);
 
 	AssemblyItem item(Instruction::SSTORE, _location);
@@ -337,7 +339,7 @@ KnownState::StoreOperation KnownState::storeInMemory(Id _slot, Id _value, Source
 	// copy over values at points where we know that they are different from _slot by at least 32
 	for (auto const& memoryItem: m_memoryContent)
 		if (m_expressionClasses->knownToBeDifferentBy32(memoryItem.first, _slot))
-			memoryContents.insert(memoryItem);
+			memoryContents.emplace_hint(memoryContents.end(), memoryItem);
 	m_memoryContent = move(memoryContents);
 
 	AssemblyItem item(Instruction::MSTORE, _location);
@@ -24,6 +24,7 @@
 
 #include <libevmasm/AssemblyItem.h>
 #include <libevmasm/SemanticInformation.h>
+#include <libevmasm/Superoptimiser.h>
 
 using namespace std;
 using namespace solidity;
@@ -39,6 +40,7 @@ struct OptimiserState
 	AssemblyItems const& items;
 	size_t i;
 	std::back_insert_iterator<AssemblyItems> out;
+	bool superoptimiserRules;
 };
 
 template <class Method, size_t Arguments>
@@ -367,6 +369,26 @@ struct UnreachableCode
 	}
 };
 
+/// Replaces a window by its cheaper equivalent from the rules found by the superoptimiser.
+struct SuperoptimiserRule
+{
+	static bool apply(OptimiserState& _state)
+	{
+		if (!_state.superoptimiserRules)
+			return false;
+		auto rule = Superoptimiser::findRule(_state.items, _state.i);
+		if (!rule)
+			return false;
+		for (AssemblyItem item: *rule->second)
+		{
+			item.setLocation(_state.items[_state.i].location());
+			*_state.out = move(item);
+		}
+		_state.i += rule->first;
+		return true;
+	}
+};
+
 void applyMethods(OptimiserState&)
 {
 	assertThrow(false, OptimizerException, "Peephole optimizer failed to apply identity.");
@@ -388,13 +410,13 @@ size_t numberOfPops(AssemblyItems const& _items)
 
 bool PeepholeOptimiser::optimise()
 {
-	OptimiserState state {m_items, 0, std::back_inserter(m_optimisedItems)};
+	OptimiserState state {m_items, 0, std::back_inserter(m_optimisedItems), m_superoptimiserRules};
 	while (state.i < m_items.size())
 		applyMethods(
 			state,
 			PushPop(), OpPop(), DoublePush(), DoubleSwap(), CommutativeSwap(), SwapComparison(),
 			DupSwap(), IsZeroIsZeroJumpI(), JumpToNext(), UnreachableCode(),
-			TagConjunctions(), TruthyAnd(), Identity()
+			TagConjunctions(), TruthyAnd(), SuperoptimiserRule(), Identity()
 		);
 	if (m_optimisedItems.size() < m_items.size() || (
 		m_optimisedItems.size() == m_items.size() && (
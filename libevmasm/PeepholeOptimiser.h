@@ -41,7 +41,11 @@ public:
 class PeepholeOptimiser
 {
 public:
-	explicit PeepholeOptimiser(AssemblyItems& _items): m_items(_items) {}
+	/// @param _superoptimiserRules if true, also applies the rules found by the Superoptimiser.
+	explicit PeepholeOptimiser(AssemblyItems& _items, bool _superoptimiserRules = false):
+		m_items(_items),
+		m_superoptimiserRules(_superoptimiserRules)
+	{}
 	virtual ~PeepholeOptimiser() = default;
 
 	bool optimise();
@@ -49,6 +53,7 @@ public:
 private:
 	AssemblyItems& m_items;
 	AssemblyItems m_optimisedItems;
+	bool m_superoptimiserRules = false;
 };
 
 }
@@ -23,7 +23,12 @@
 
 #include <libevmasm/Instruction.h>
 #include <libsolutil/CommonData.h>
+
+#include <boost/container/flat_map.hpp>
+
 #include <functional>
+#include <optional>
+#include <vector>
 
 namespace solidity::evmasm
 {
@@ -55,6 +60,75 @@ struct SimplificationRule
 	std::function<bool()> feasible;
 };
 
+/**
+ * Decision tree over the simplification rules: The rules are grouped by the instruction
+ * of their pattern and then by the kind of the first argument of the pattern, e.g. the
+ * instruction of a nested operation or "constant". This way, rules that cannot match
+ * an expression are skipped without trying their patterns.
+ *
+ * The kinds are defined by the users of the index. Patterns that match any argument
+ * do not have a kind. Inside every group, the rules keep their order, so the first
+ * matching rule is the same as with a linear search.
+ */
+template <class Pattern>
+class SimplificationRuleIndex
+{
+public:
+	using Rule = SimplificationRule<Pattern>;
+	using Rules = std::vector<Rule const*>;
+
+	/// Adds a rule after all previously added rules. The rule has to outlive the index.
+	/// @param _firstArgumentKind the kind of expressions the first argument of the pattern
+	/// matches, or nullopt if it matches any expression.
+	void add(Instruction _instruction, Rule const& _rule, std::optional<unsigned> _firstArgumentKind)
+	{
+		Group& group = m_groups[uint8_t(_instruction)];
+		if (!_firstArgumentKind)
+		{
+			group.anyFirstArgument.push_back(&_rule);
+			for (auto& rules: group.byFirstArgument)
+				rules.second.push_back(&_rule);
+		}
+		else
+		{
+			auto it = group.byFirstArgument.find(*_firstArgumentKind);
+			if (it == group.byFirstArgument.end())
+				it = group.byFirstArgument.emplace(*_firstArgumentKind, group.anyFirstArgument).first;
+			it->second.push_back(&_rule);
+		}
+	}
+
+	/// @returns the rules for @a _instruction that can match an expression whose
+	/// first argument is of the kind @a _firstArgumentKind, in order.
+	Rules const& candidates(Instruction _instruction, std::optional<unsigned> _firstArgumentKind) const
+	{
+		Group const& group = m_groups[uint8_t(_instruction)];
+		if (_firstArgumentKind)
+		{
+			auto it = group.byFirstArgument.find(*_firstArgumentKind);
+			if (it != group.byFirstArgument.end())
+				return it->second;
+		}
+		return group.anyFirstArgument;
+	}
+
+	bool empty(Instruction _instruction) const
+	{
+		return m_groups[uint8_t(_instruction)].anyFirstArgument.empty() &&
+			m_groups[uint8_t(_instruction)].byFirstArgument.empty();
+	}
+
+private:
+	struct Group
+	{
+		/// Rules whose first argument matches anything, i.e. the only ones that can match
+		/// expressions of a kind not listed in @a byFirstArgument.
+		Rules anyFirstArgument;
+		boost::container::flat_map<unsigned, Rules> byFirstArgument;
+	};
+	Group m_groups[256];
+};
+
 template <typename Pattern>
 struct EVMBuiltins
 {
@@ -43,34 +43,25 @@ SimplificationRule<Pattern> const* Rules::findFirstMatch(
 	ExpressionClasses const& _classes
 )
 {
-	resetMatchGroups();
-
 	assertThrow(_expr.item, OptimizerException, "");
-	for (auto const& rule: m_rules[uint8_t(_expr.item->instruction())])
-	{
-		if (rule.pattern.matches(_expr, _classes))
-			if (!rule.feasible || rule.feasible())
-				return &rule;
+	optional<unsigned> firstArgumentKind;
+	if (!_expr.arguments.empty())
+		if (AssemblyItem const* item = _classes.representative(_expr.arguments.front()).item)
+			firstArgumentKind = Pattern::kind(*item);
 
+	for (auto const* rule: m_index.candidates(_expr.item->instruction(), firstArgumentKind))
+	{
 		resetMatchGroups();
+		if (rule->pattern.matches(_expr, _classes))
+			if (!rule->feasible || rule->feasible())
+				return rule;
 	}
 	return nullptr;
 }
 
 bool Rules::isInitialized() const
 {
-	return !m_rules[uint8_t(Instruction::ADD)].empty();
-}
-
-void Rules::addRules(std::vector<SimplificationRule<Pattern>> const& _rules)
-{
-	for (auto const& r: _rules)
-		addRule(r);
-}
-
-void Rules::addRule(SimplificationRule<Pattern> const& _rule)
-{
-	m_rules[uint8_t(_rule.pattern.instruction())].push_back(_rule);
+	return !m_index.empty(Instruction::ADD);
 }
 
 Rules::Rules()
@@ -93,7 +84,16 @@ Rules::Rules()
 	Y.setMatchGroup(6, m_matchGroups);
 	Z.setMatchGroup(7, m_matchGroups);
 
-	addRules(simplificationRuleList(nullopt, A, B, C, W, X, Y, Z));
+	m_rules = simplificationRuleList(nullopt, A, B, C, W, X, Y, Z);
+	for (auto const& rule: m_rules)
+	{
+		vector<Pattern> arguments = rule.pattern.arguments();
+		m_index.add(
+			rule.pattern.instruction(),
+			rule,
+			arguments.empty() ? nullopt : arguments.front().kind()
+		);
+	}
 	assertThrow(isInitialized(), OptimizerException, "Rule list not properly initialized.");
 }
 
@@ -104,8 +104,9 @@ Pattern::Pattern(Instruction _instruction, std::initializer_list<Pattern> _argum
 {
 }
 
-void Pattern::setMatchGroup(unsigned _group, map<unsigned, Expression const*>& _matchGroups)
+void Pattern::setMatchGroup(unsigned _group, MatchGroups& _matchGroups)
 {
+	assertThrow(_group < _matchGroups.size(), OptimizerException, "Invalid match group.");
 	m_matchGroup = _group;
 	m_matchGroups = &_matchGroups;
 }
@@ -116,7 +117,7 @@ bool Pattern::matches(Expression const& _expr, ExpressionClasses const& _classes
 		return false;
 	if (m_matchGroup)
 	{
-		if (!m_matchGroups->count(m_matchGroup))
+		if (!(*m_matchGroups)[m_matchGroup])
 			(*m_matchGroups)[m_matchGroup] = &_expr;
 		else if ((*m_matchGroups)[m_matchGroup]->id != _expr.id)
 			return false;
@@ -128,6 +129,24 @@ bool Pattern::matches(Expression const& _expr, ExpressionClasses const& _classes
 	return true;
 }
 
+optional<unsigned> Pattern::kind() const
+{
+	if (m_type == UndefinedItem)
+		return nullopt;
+	else if (m_type == Operation)
+		return static_cast<unsigned>(m_instruction);
+	else
+		return 256 + static_cast<unsigned>(m_type);
+}
+
+unsigned Pattern::kind(AssemblyItem const& _item)
+{
+	if (_item.type() == Operation)
+		return static_cast<unsigned>(_item.instruction());
+	else
+		return 256 + static_cast<unsigned>(_item.type());
+}
+
 AssemblyItem Pattern::toAssemblyItem(SourceLocation const& _location) const
 {
 	if (m_type == Operation)
@@ -31,7 +31,9 @@
 
 #include <boost/noncopyable.hpp>
 
+#include <array>
 #include <functional>
+#include <optional>
 #include <vector>
 
 namespace solidity::langutil
@@ -55,7 +57,8 @@ public:
 	Rules();
 
 	/// @returns a pointer to the first matching pattern and sets the match
-	/// groups accordingly.
+	/// groups accordingly. Only tries the rules that the index selects by the
+	/// instruction and the first argument of @a _expr.
 	SimplificationRule<Pattern> const* findFirstMatch(
 		Expression const& _expr,
 		ExpressionClasses const& _classes
@@ -66,15 +69,13 @@ public:
 	bool isInitialized() const;
 
 private:
-	void addRules(std::vector<SimplificationRule<Pattern>> const& _rules);
-	void addRule(SimplificationRule<Pattern> const& _rule);
+	void resetMatchGroups() { m_matchGroups.fill(nullptr); }
 
-	void resetMatchGroups() { m_matchGroups.clear(); }
-
-	std::map<unsigned, Expression const*> m_matchGroups;
+	std::array<Expression const*, 8> m_matchGroups{};
 	/// Pattern to match, replacement to be applied and flag indicating whether
 	/// the replacement might remove some elements (except constants).
-	std::vector<SimplificationRule<Pattern>> m_rules[256];
+	std::vector<SimplificationRule<Pattern>> m_rules;
+	SimplificationRuleIndex<Pattern> m_index;
 };
 
 /**
@@ -87,6 +88,8 @@ class Pattern
 public:
 	using Expression = ExpressionClasses::Expression;
 	using Id = ExpressionClasses::Id;
+	/// Matched expressions, indexed by match group. Group zero is unused.
+	using MatchGroups = std::array<Expression const*, 8>;
 
 	using Builtins = evmasm::EVMBuiltins<Pattern>;
 	static constexpr size_t WordSize = 256;
@@ -105,10 +108,17 @@ public:
 	/// Sets this pattern to be part of the match group with the identifier @a _group.
 	/// Inside one rule, all patterns in the same match group have to match expressions from the
 	/// same expression equivalence class.
-	void setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups);
+	void setMatchGroup(unsigned _group, MatchGroups& _matchGroups);
 	unsigned matchGroup() const { return m_matchGroup; }
 	bool matches(Expression const& _expr, ExpressionClasses const& _classes) const;
 
+	/// @returns the kind of the items this pattern matches for the rule index,
+	/// or nullopt if it matches any item.
+	std::optional<unsigned> kind() const;
+	/// @returns the kind of @a _item for the rule index: Its instruction for operations
+	/// and its type offset by 256 for other items.
+	static unsigned kind(AssemblyItem const& _item);
+
 	AssemblyItem toAssemblyItem(langutil::SourceLocation const& _location) const;
 	std::vector<Pattern> arguments() const { return m_arguments; }
 
@@ -137,7 +147,7 @@ private:
 	std::shared_ptr<u256> m_data; ///< Only valid if m_type is not Operation
 	std::vector<Pattern> m_arguments;
 	unsigned m_matchGroup = 0;
-	std::map<unsigned, Expression const*>* m_matchGroups = nullptr;
+	MatchGroups* m_matchGroups = nullptr;
 };
 
 /**
@@ -0,0 +1,264 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * @file Superoptimiser.cpp
+ * Search for cheaper equivalents of short instruction sequences and lookup of the resulting rules.
+ */
+
+#include <libevmasm/Superoptimiser.h>
+
+#include <libevmasm/ExpressionClasses.h>
+#include <libevmasm/GasMeter.h>
+#include <libevmasm/KnownState.h>
+#include <libevmasm/SemanticInformation.h>
+#include <libevmasm/SuperoptimiserRules.h>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <tuple>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::evmasm;
+
+namespace
+{
+
+/// Stack requirements of a sequence of items, relative to the stack height before it.
+struct StackEffect
+{
+	/// Number of stack elements that have to exist before the sequence.
+	int required = 0;
+	/// Maximum stack height reached.
+	int maxHeight = 0;
+	/// Stack height after the sequence.
+	int height = 0;
+};
+
+StackEffect stackEffect(AssemblyItems const& _items)
+{
+	StackEffect effect;
+	for (AssemblyItem const& item: _items)
+	{
+		effect.required = max(effect.required, static_cast<int>(item.arguments()) - effect.height);
+		effect.height += static_cast<int>(item.returnValues()) - static_cast<int>(item.arguments());
+		effect.maxHeight = max(effect.maxHeight, effect.height);
+	}
+	return effect;
+}
+
+unsigned gasCost(AssemblyItems const& _items)
+{
+	unsigned gas = 0;
+	for (AssemblyItem const& item: _items)
+		gas += GasMeter::runGas(item.type() == Operation ? item.instruction() : Instruction::PUSH1);
+	return gas;
+}
+
+/// @returns true if @a _item only reads and writes the stack, apart from call-constant
+/// information like the caller.
+bool onlyOperatesOnStack(AssemblyItem const& _item)
+{
+	if (_item.type() == Push)
+		return true;
+	if (_item.type() != Operation || _item.getJumpType() != AssemblyItem::JumpType::Ordinary)
+		return false;
+	return
+		SemanticInformation::isDupInstruction(_item) ||
+		SemanticInformation::isSwapInstruction(_item) ||
+		_item == Instruction::POP ||
+		SemanticInformation::movable(_item.instruction());
+}
+
+/// Classes of the stack elements from @a _lowestHeight up to the top after feeding @a _items
+/// into a fresh state that uses @a _classes, together with the resulting stack height.
+pair<int, vector<ExpressionClasses::Id>> stackSignature(
+	shared_ptr<ExpressionClasses> const& _classes,
+	AssemblyItems const& _items,
+	int _lowestHeight
+)
+{
+	KnownState state(_classes);
+	for (AssemblyItem const& item: _items)
+		state.feedItem(item, true);
+	vector<ExpressionClasses::Id> elements;
+	for (int height = _lowestHeight; height <= state.stackHeight(); ++height)
+		elements.push_back(state.stackElement(height, {}));
+	return {state.stackHeight(), move(elements)};
+}
+
+/// The compiled-in rules, indexed for the lookup during compilation.
+struct RuleTable
+{
+	RuleTable()
+	{
+		for (auto const& rule: Superoptimiser::rules())
+		{
+			replacements[rule.window] = rule.replacement;
+			items.insert(rule.window.begin(), rule.window.end());
+			maxWindow = max(maxWindow, rule.window.size());
+		}
+	}
+
+	map<AssemblyItems, AssemblyItems> replacements;
+	/// All items that occur in windows.
+	set<AssemblyItem> items;
+	size_t maxWindow = 0;
+};
+
+}
+
+AssemblyItems Superoptimiser::defaultAlphabet()
+{
+	return {
+		u256(0), u256(1), u256(2), u256(0x20),
+		Instruction::POP,
+		Instruction::DUP1, Instruction::DUP2, Instruction::DUP3,
+		Instruction::SWAP1, Instruction::SWAP2,
+		Instruction::ADD, Instruction::SUB, Instruction::MUL, Instruction::DIV,
+		Instruction::AND, Instruction::OR, Instruction::XOR, Instruction::NOT,
+		Instruction::ISZERO, Instruction::EQ, Instruction::LT, Instruction::GT,
+		Instruction::SLT, Instruction::SGT
+	};
+}
+
+vector<Superoptimiser::Rule> Superoptimiser::search(AssemblyItems const& _alphabet, size_t _maxLength)
+{
+	int deepestAccess = 0;
+	for (AssemblyItem const& item: _alphabet)
+	{
+		assertThrow(onlyOperatesOnStack(item), OptimizerException, "Item with side effects in alphabet.");
+		deepestAccess = max(deepestAccess, static_cast<int>(item.arguments()));
+	}
+	// Stack elements below this height are not touched by any of the sequences.
+	int const lowestHeight = 1 - deepestAccess * static_cast<int>(_maxLength);
+
+	vector<AssemblyItems> sequences{{}};
+	for (size_t begin = 0, length = 1; length <= _maxLength; ++length)
+	{
+		size_t end = sequences.size();
+		for (size_t i = begin; i < end; ++i)
+			for (AssemblyItem const& item: _alphabet)
+			{
+				AssemblyItems sequence = sequences[i];
+				sequence.push_back(item);
+				sequences.emplace_back(move(sequence));
+			}
+		begin = end;
+	}
+
+	// All sequences share the expression classes, so that equal classes mean equal values.
+	auto classes = make_shared<ExpressionClasses>();
+	map<pair<int, vector<ExpressionClasses::Id>>, vector<size_t>> equivalentSequences;
+	for (size_t i = 0; i < sequences.size(); ++i)
+		equivalentSequences[stackSignature(classes, sequences[i], lowestHeight)].push_back(i);
+
+	vector<Rule> rules;
+	for (auto const& group: equivalentSequences)
+		for (size_t window: group.second)
+		{
+			optional<size_t> best;
+			auto cost = [&](size_t _index) {
+				AssemblyItems const& sequence = sequences[_index];
+				return make_tuple(sequence.size(), gasCost(sequence), bytesRequired(sequence, 1));
+			};
+			for (size_t candidate: group.second)
+				if (
+					isImprovement(sequences[window], sequences[candidate]) &&
+					(!best || cost(candidate) < cost(*best))
+				)
+					best = candidate;
+			if (best)
+				rules.push_back({sequences[window], sequences[*best]});
+		}
+
+	// Windows that contain the window of another rule are already handled by the shorter rule.
+	// The rules are processed by length, so all shorter windows are known when checking one.
+	sort(rules.begin(), rules.end(), [](Rule const& _a, Rule const& _b) {
+		return make_pair(_a.window.size(), _a.window) < make_pair(_b.window.size(), _b.window);
+	});
+	vector<Rule> minimalRules;
+	set<AssemblyItems> windows;
+	for (Rule& rule: rules)
+	{
+		bool containsWindow = false;
+		for (size_t length = 1; length < rule.window.size() && !containsWindow; ++length)
+			for (size_t start = 0; start + length <= rule.window.size() && !containsWindow; ++start)
+				containsWindow = windows.count(AssemblyItems(
+					rule.window.begin() + static_cast<ptrdiff_t>(start),
+					rule.window.begin() + static_cast<ptrdiff_t>(start + length)
+				)) > 0;
+		if (!containsWindow)
+		{
+			windows.insert(rule.window);
+			minimalRules.emplace_back(move(rule));
+		}
+	}
+	return minimalRules;
+}
+
+bool Superoptimiser::equivalent(AssemblyItems const& _a, AssemblyItems const& _b)
+{
+	auto operatesOnStack = [](AssemblyItems const& _items) {
+		return all_of(_items.begin(), _items.end(), onlyOperatesOnStack);
+	};
+	if (!operatesOnStack(_a) || !operatesOnStack(_b))
+		return false;
+	int lowestHeight = 1 - max(stackEffect(_a).required, stackEffect(_b).required);
+	auto classes = make_shared<ExpressionClasses>();
+	return stackSignature(classes, _a, lowestHeight) == stackSignature(classes, _b, lowestHeight);
+}
+
+bool Superoptimiser::isImprovement(AssemblyItems const& _window, AssemblyItems const& _replacement)
+{
+	StackEffect windowEffect = stackEffect(_window);
+	StackEffect replacementEffect = stackEffect(_replacement);
+	return
+		_replacement.size() < _window.size() &&
+		gasCost(_replacement) <= gasCost(_window) &&
+		bytesRequired(_replacement, 1) <= bytesRequired(_window, 1) &&
+		replacementEffect.required <= windowEffect.required &&
+		replacementEffect.maxHeight <= windowEffect.maxHeight;
+}
+
+optional<pair<size_t, AssemblyItems const*>> Superoptimiser::findRule(
+	AssemblyItems const& _items,
+	size_t _position
+)
+{
+	static RuleTable const table;
+
+	AssemblyItems window;
+	for (size_t i = _position; i < _items.size() && window.size() < table.maxWindow; ++i)
+	{
+		if (!table.items.count(_items[i]))
+			break;
+		window.push_back(_items[i]);
+	}
+	for (; !window.empty(); window.pop_back())
+		if (auto it = table.replacements.find(window); it != table.replacements.end())
+			return {{window.size(), &it->second}};
+	return nullopt;
+}
+
+vector<Superoptimiser::Rule> const& Superoptimiser::rules()
+{
+	static vector<Rule> const rules = superoptimiserRuleTable();
+	return rules;
+}
@@ -0,0 +1,82 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * @file Superoptimiser.h
+ * Search for cheaper equivalents of short instruction sequences and lookup of the resulting rules.
+ */
+
+#pragma once
+
+#include <libevmasm/AssemblyItem.h>
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace solidity::evmasm
+{
+
+/**
+ * Bounded superoptimiser for windows of instructions that only operate on the stack.
+ *
+ * The search enumerates all sequences of items from a small alphabet up to a given length,
+ * proves sequences to be equivalent if the ExpressionClasses of a KnownState assign the same
+ * classes to their resulting stacks, and keeps the replacements that are shorter, at most as
+ * expensive according to the GasMeter and at most as large in code size.
+ *
+ * The search is run offline (see test/tools/superopt.cpp) and its result is compiled in
+ * as SuperoptimiserRules.h, so applying the rules during compilation is a table lookup.
+ */
+class Superoptimiser
+{
+public:
+	struct Rule
+	{
+		AssemblyItems window;
+		AssemblyItems replacement;
+	};
+
+	/// @returns the items the offline search combines by default: Some small constants,
+	/// stack manipulation and arithmetic that is available on all EVM versions.
+	static AssemblyItems defaultAlphabet();
+
+	/// Enumerates all sequences of at most @a _maxLength items of @a _alphabet, which must only
+	/// operate on the stack, and @returns a rule for every sequence that has a cheaper equivalent
+	/// among them and does not contain the window of another rule.
+	static std::vector<Rule> search(AssemblyItems const& _alphabet, size_t _maxLength);
+
+	/// @returns true if @a _a and @a _b are proven to have the same effect on the stack.
+	static bool equivalent(AssemblyItems const& _a, AssemblyItems const& _b);
+
+	/// @returns true if @a _replacement has fewer items than @a _window, costs at most as much
+	/// gas and code, and neither needs more stack elements nor grows the stack further.
+	/// Does not check equivalence.
+	static bool isImprovement(AssemblyItems const& _window, AssemblyItems const& _replacement);
+
+	/// Looks up the longest window of the compiled-in rule table that starts at @a _position.
+	/// @returns the length of the window and its replacement or nullopt if there is none.
+	static std::optional<std::pair<size_t, AssemblyItems const*>> findRule(
+		AssemblyItems const& _items,
+		size_t _position
+	);
+
+	/// @returns the compiled-in rules.
+	static std::vector<Rule> const& rules();
+};
+
+}
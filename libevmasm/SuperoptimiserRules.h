@@ -0,0 +1,586 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Rules found by the superoptimiser, generated by test/tools/superopt.cpp. Do not edit.
+ * Windows of at most 3 items, 548 rules.
+ */
+
+#pragma once
+
+#include <libevmasm/Superoptimiser.h>
+
+#include <vector>
+
+namespace solidity::evmasm
+{
+
+inline std::vector<Superoptimiser::Rule> superoptimiserRuleTable()
+{
+	return {
+		{{Instruction::ISZERO, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::XOR, Instruction::ISZERO}, {Instruction::EQ}},
+		{{Instruction::NOT, Instruction::NOT}, {}},
+		{{Instruction::NOT, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::AND}, {}},
+		{{Instruction::DUP1, Instruction::OR}, {}},
+		{{Instruction::DUP1, Instruction::POP}, {}},
+		{{Instruction::DUP1, Instruction::SWAP1}, {Instruction::DUP1}},
+		{{Instruction::DUP2, Instruction::POP}, {}},
+		{{Instruction::DUP2, Instruction::SWAP2}, {Instruction::DUP2}},
+		{{Instruction::DUP3, Instruction::POP}, {}},
+		{{Instruction::SWAP1, Instruction::ADD}, {Instruction::ADD}},
+		{{Instruction::SWAP1, Instruction::MUL}, {Instruction::MUL}},
+		{{Instruction::SWAP1, Instruction::EQ}, {Instruction::EQ}},
+		{{Instruction::SWAP1, Instruction::AND}, {Instruction::AND}},
+		{{Instruction::SWAP1, Instruction::OR}, {Instruction::OR}},
+		{{Instruction::SWAP1, Instruction::XOR}, {Instruction::XOR}},
+		{{Instruction::SWAP1, Instruction::SWAP1}, {}},
+		{{Instruction::SWAP2, Instruction::SWAP2}, {}},
+		{{u256(0), Instruction::ADD}, {}},
+		{{u256(0), Instruction::EQ}, {Instruction::ISZERO}},
+		{{u256(0), Instruction::ISZERO}, {u256(1)}},
+		{{u256(0), Instruction::OR}, {}},
+		{{u256(0), Instruction::XOR}, {}},
+		{{u256(0), Instruction::POP}, {}},
+		{{u256(1), Instruction::MUL}, {}},
+		{{u256(1), Instruction::ISZERO}, {u256(0)}},
+		{{u256(1), Instruction::POP}, {}},
+		{{u256(2), Instruction::ISZERO}, {u256(0)}},
+		{{u256(2), Instruction::POP}, {}},
+		{{u256(32), Instruction::ISZERO}, {u256(0)}},
+		{{u256(32), Instruction::POP}, {}},
+		{{Instruction::LT, Instruction::ISZERO, Instruction::ISZERO}, {Instruction::LT}},
+		{{Instruction::LT, u256(0), Instruction::LT}, {Instruction::LT}},
+		{{Instruction::GT, Instruction::ISZERO, Instruction::ISZERO}, {Instruction::GT}},
+		{{Instruction::GT, u256(0), Instruction::LT}, {Instruction::GT}},
+		{{Instruction::SLT, Instruction::ISZERO, Instruction::ISZERO}, {Instruction::SLT}},
+		{{Instruction::SLT, u256(0), Instruction::LT}, {Instruction::SLT}},
+		{{Instruction::SGT, Instruction::ISZERO, Instruction::ISZERO}, {Instruction::SGT}},
+		{{Instruction::SGT, u256(0), Instruction::LT}, {Instruction::SGT}},
+		{{Instruction::EQ, Instruction::ISZERO, Instruction::ISZERO}, {Instruction::EQ}},
+		{{Instruction::EQ, u256(0), Instruction::LT}, {Instruction::EQ}},
+		{{Instruction::ISZERO, Instruction::ADD, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::ISZERO, Instruction::MUL, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::ISZERO, Instruction::SUB, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::ISZERO, Instruction::DIV, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::ISZERO, Instruction::LT, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::ISZERO, Instruction::GT, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::ISZERO, Instruction::SLT, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::ISZERO, Instruction::SGT, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::ISZERO, Instruction::EQ, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::ISZERO, Instruction::ISZERO, Instruction::ISZERO}, {Instruction::ISZERO}},
+		{{Instruction::ISZERO, Instruction::AND, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::ISZERO, Instruction::OR, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::ISZERO, Instruction::XOR, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::ISZERO, Instruction::DUP1, Instruction::SUB}, {Instruction::POP, u256(0)}},
+		{{Instruction::ISZERO, Instruction::DUP1, Instruction::LT}, {Instruction::POP, u256(0)}},
+		{{Instruction::ISZERO, Instruction::DUP1, Instruction::GT}, {Instruction::POP, u256(0)}},
+		{{Instruction::ISZERO, Instruction::DUP1, Instruction::SLT}, {Instruction::POP, u256(0)}},
+		{{Instruction::ISZERO, Instruction::DUP1, Instruction::SGT}, {Instruction::POP, u256(0)}},
+		{{Instruction::ISZERO, Instruction::DUP1, Instruction::EQ}, {Instruction::POP, u256(1)}},
+		{{Instruction::ISZERO, Instruction::DUP1, Instruction::XOR}, {Instruction::POP, u256(0)}},
+		{{Instruction::ISZERO, u256(0), Instruction::MUL}, {Instruction::POP, u256(0)}},
+		{{Instruction::ISZERO, u256(0), Instruction::DIV}, {Instruction::POP, u256(0)}},
+		{{Instruction::ISZERO, u256(0), Instruction::LT}, {Instruction::ISZERO}},
+		{{Instruction::ISZERO, u256(0), Instruction::GT}, {Instruction::POP, u256(0)}},
+		{{Instruction::ISZERO, u256(0), Instruction::AND}, {Instruction::POP, u256(0)}},
+		{{Instruction::XOR, u256(0), Instruction::LT}, {Instruction::EQ, Instruction::ISZERO}},
+		{{Instruction::NOT, Instruction::ADD, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::NOT, Instruction::MUL, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::NOT, Instruction::SUB, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::NOT, Instruction::DIV, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::NOT, Instruction::LT, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::NOT, Instruction::GT, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::NOT, Instruction::SLT, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::NOT, Instruction::SGT, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::NOT, Instruction::EQ, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::NOT, Instruction::AND, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::NOT, Instruction::OR, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::NOT, Instruction::XOR, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::NOT, Instruction::DUP1, Instruction::SUB}, {Instruction::POP, u256(0)}},
+		{{Instruction::NOT, Instruction::DUP1, Instruction::LT}, {Instruction::POP, u256(0)}},
+		{{Instruction::NOT, Instruction::DUP1, Instruction::GT}, {Instruction::POP, u256(0)}},
+		{{Instruction::NOT, Instruction::DUP1, Instruction::SLT}, {Instruction::POP, u256(0)}},
+		{{Instruction::NOT, Instruction::DUP1, Instruction::SGT}, {Instruction::POP, u256(0)}},
+		{{Instruction::NOT, Instruction::DUP1, Instruction::EQ}, {Instruction::POP, u256(1)}},
+		{{Instruction::NOT, Instruction::DUP1, Instruction::XOR}, {Instruction::POP, u256(0)}},
+		{{Instruction::NOT, u256(0), Instruction::MUL}, {Instruction::POP, u256(0)}},
+		{{Instruction::NOT, u256(0), Instruction::DIV}, {Instruction::POP, u256(0)}},
+		{{Instruction::NOT, u256(0), Instruction::GT}, {Instruction::POP, u256(0)}},
+		{{Instruction::NOT, u256(0), Instruction::AND}, {Instruction::POP, u256(0)}},
+		{{Instruction::DUP1, Instruction::ADD, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::MUL, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::SUB, Instruction::ADD}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::SUB, Instruction::EQ}, {Instruction::POP, Instruction::ISZERO}},
+		{{Instruction::DUP1, Instruction::SUB, Instruction::ISZERO}, {Instruction::POP, u256(1)}},
+		{{Instruction::DUP1, Instruction::SUB, Instruction::OR}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::SUB, Instruction::XOR}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::SUB, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::DIV, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::LT, Instruction::ADD}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::LT, Instruction::EQ}, {Instruction::POP, Instruction::ISZERO}},
+		{{Instruction::DUP1, Instruction::LT, Instruction::ISZERO}, {Instruction::POP, u256(1)}},
+		{{Instruction::DUP1, Instruction::LT, Instruction::OR}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::LT, Instruction::XOR}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::LT, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::GT, Instruction::ADD}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::GT, Instruction::EQ}, {Instruction::POP, Instruction::ISZERO}},
+		{{Instruction::DUP1, Instruction::GT, Instruction::ISZERO}, {Instruction::POP, u256(1)}},
+		{{Instruction::DUP1, Instruction::GT, Instruction::OR}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::GT, Instruction::XOR}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::GT, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::SLT, Instruction::ADD}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::SLT, Instruction::EQ}, {Instruction::POP, Instruction::ISZERO}},
+		{{Instruction::DUP1, Instruction::SLT, Instruction::ISZERO}, {Instruction::POP, u256(1)}},
+		{{Instruction::DUP1, Instruction::SLT, Instruction::OR}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::SLT, Instruction::XOR}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::SLT, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::SGT, Instruction::ADD}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::SGT, Instruction::EQ}, {Instruction::POP, Instruction::ISZERO}},
+		{{Instruction::DUP1, Instruction::SGT, Instruction::ISZERO}, {Instruction::POP, u256(1)}},
+		{{Instruction::DUP1, Instruction::SGT, Instruction::OR}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::SGT, Instruction::XOR}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::SGT, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::EQ, Instruction::MUL}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::EQ, Instruction::ISZERO}, {Instruction::POP, u256(0)}},
+		{{Instruction::DUP1, Instruction::EQ, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::XOR, Instruction::ADD}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::XOR, Instruction::EQ}, {Instruction::POP, Instruction::ISZERO}},
+		{{Instruction::DUP1, Instruction::XOR, Instruction::OR}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::XOR, Instruction::XOR}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::XOR, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP1, Instruction::NOT, Instruction::AND}, {Instruction::POP, u256(0)}},
+		{{Instruction::DUP1, Instruction::DUP1, Instruction::SUB}, {u256(0)}},
+		{{Instruction::DUP1, Instruction::DUP1, Instruction::LT}, {u256(0)}},
+		{{Instruction::DUP1, Instruction::DUP1, Instruction::GT}, {u256(0)}},
+		{{Instruction::DUP1, Instruction::DUP1, Instruction::SLT}, {u256(0)}},
+		{{Instruction::DUP1, Instruction::DUP1, Instruction::SGT}, {u256(0)}},
+		{{Instruction::DUP1, Instruction::DUP1, Instruction::EQ}, {u256(1)}},
+		{{Instruction::DUP1, Instruction::DUP1, Instruction::XOR}, {u256(0)}},
+		{{Instruction::DUP1, Instruction::DUP1, Instruction::SWAP2}, {Instruction::DUP1, Instruction::DUP1}},
+		{{Instruction::DUP1, Instruction::DUP2, Instruction::SUB}, {u256(0)}},
+		{{Instruction::DUP1, Instruction::DUP2, Instruction::LT}, {u256(0)}},
+		{{Instruction::DUP1, Instruction::DUP2, Instruction::GT}, {u256(0)}},
+		{{Instruction::DUP1, Instruction::DUP2, Instruction::SLT}, {u256(0)}},
+		{{Instruction::DUP1, Instruction::DUP2, Instruction::SGT}, {u256(0)}},
+		{{Instruction::DUP1, Instruction::DUP2, Instruction::EQ}, {u256(1)}},
+		{{Instruction::DUP1, Instruction::DUP2, Instruction::AND}, {Instruction::DUP1}},
+		{{Instruction::DUP1, Instruction::DUP2, Instruction::OR}, {Instruction::DUP1}},
+		{{Instruction::DUP1, Instruction::DUP2, Instruction::XOR}, {u256(0)}},
+		{{Instruction::DUP1, Instruction::DUP2, Instruction::SWAP1}, {Instruction::DUP1, Instruction::DUP1}},
+		{{Instruction::DUP1, Instruction::DUP3, Instruction::SWAP1}, {Instruction::DUP2, Instruction::DUP2}},
+		{{Instruction::DUP1, Instruction::SWAP2, Instruction::SWAP1}, {Instruction::SWAP1, Instruction::DUP2}},
+		{{Instruction::DUP1, u256(0), Instruction::MUL}, {u256(0)}},
+		{{Instruction::DUP1, u256(0), Instruction::DIV}, {u256(0)}},
+		{{Instruction::DUP1, u256(0), Instruction::GT}, {u256(0)}},
+		{{Instruction::DUP1, u256(0), Instruction::AND}, {u256(0)}},
+		{{Instruction::DUP1, u256(0), Instruction::SWAP1}, {u256(0), Instruction::DUP2}},
+		{{Instruction::DUP1, u256(1), Instruction::SWAP1}, {u256(1), Instruction::DUP2}},
+		{{Instruction::DUP1, u256(2), Instruction::SWAP1}, {u256(2), Instruction::DUP2}},
+		{{Instruction::DUP1, u256(32), Instruction::SWAP1}, {u256(32), Instruction::DUP2}},
+		{{Instruction::DUP2, Instruction::ADD, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP2, Instruction::MUL, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP2, Instruction::SUB, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP2, Instruction::DIV, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP2, Instruction::LT, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP2, Instruction::GT, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP2, Instruction::SLT, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP2, Instruction::SGT, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP2, Instruction::EQ, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP2, Instruction::AND, Instruction::AND}, {Instruction::AND}},
+		{{Instruction::DUP2, Instruction::AND, Instruction::OR}, {Instruction::POP}},
+		{{Instruction::DUP2, Instruction::AND, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP2, Instruction::OR, Instruction::AND}, {Instruction::POP}},
+		{{Instruction::DUP2, Instruction::OR, Instruction::OR}, {Instruction::OR}},
+		{{Instruction::DUP2, Instruction::OR, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP2, Instruction::XOR, Instruction::XOR}, {Instruction::SWAP1, Instruction::POP}},
+		{{Instruction::DUP2, Instruction::XOR, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP2, Instruction::DUP1, Instruction::SUB}, {u256(0)}},
+		{{Instruction::DUP2, Instruction::DUP1, Instruction::LT}, {u256(0)}},
+		{{Instruction::DUP2, Instruction::DUP1, Instruction::GT}, {u256(0)}},
+		{{Instruction::DUP2, Instruction::DUP1, Instruction::SLT}, {u256(0)}},
+		{{Instruction::DUP2, Instruction::DUP1, Instruction::SGT}, {u256(0)}},
+		{{Instruction::DUP2, Instruction::DUP1, Instruction::EQ}, {u256(1)}},
+		{{Instruction::DUP2, Instruction::DUP1, Instruction::XOR}, {u256(0)}},
+		{{Instruction::DUP2, Instruction::DUP2, Instruction::SWAP1}, {Instruction::DUP1, Instruction::DUP3}},
+		{{Instruction::DUP2, Instruction::DUP3, Instruction::SUB}, {u256(0)}},
+		{{Instruction::DUP2, Instruction::DUP3, Instruction::LT}, {u256(0)}},
+		{{Instruction::DUP2, Instruction::DUP3, Instruction::GT}, {u256(0)}},
+		{{Instruction::DUP2, Instruction::DUP3, Instruction::SLT}, {u256(0)}},
+		{{Instruction::DUP2, Instruction::DUP3, Instruction::SGT}, {u256(0)}},
+		{{Instruction::DUP2, Instruction::DUP3, Instruction::EQ}, {u256(1)}},
+		{{Instruction::DUP2, Instruction::DUP3, Instruction::AND}, {Instruction::DUP2}},
+		{{Instruction::DUP2, Instruction::DUP3, Instruction::OR}, {Instruction::DUP2}},
+		{{Instruction::DUP2, Instruction::DUP3, Instruction::XOR}, {u256(0)}},
+		{{Instruction::DUP2, Instruction::DUP3, Instruction::SWAP1}, {Instruction::DUP2, Instruction::DUP1}},
+		{{Instruction::DUP2, Instruction::SWAP1, Instruction::POP}, {Instruction::POP, Instruction::DUP1}},
+		{{Instruction::DUP2, Instruction::SWAP1, Instruction::SWAP2}, {Instruction::SWAP1, Instruction::DUP1}},
+		{{Instruction::DUP2, u256(0), Instruction::MUL}, {u256(0)}},
+		{{Instruction::DUP2, u256(0), Instruction::DIV}, {u256(0)}},
+		{{Instruction::DUP2, u256(0), Instruction::GT}, {u256(0)}},
+		{{Instruction::DUP2, u256(0), Instruction::AND}, {u256(0)}},
+		{{Instruction::DUP2, u256(0), Instruction::SWAP1}, {u256(0), Instruction::DUP3}},
+		{{Instruction::DUP2, u256(1), Instruction::SWAP1}, {u256(1), Instruction::DUP3}},
+		{{Instruction::DUP2, u256(2), Instruction::SWAP1}, {u256(2), Instruction::DUP3}},
+		{{Instruction::DUP2, u256(32), Instruction::SWAP1}, {u256(32), Instruction::DUP3}},
+		{{Instruction::DUP3, Instruction::ADD, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP3, Instruction::MUL, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP3, Instruction::SUB, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP3, Instruction::DIV, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP3, Instruction::LT, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP3, Instruction::GT, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP3, Instruction::SLT, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP3, Instruction::SGT, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP3, Instruction::EQ, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP3, Instruction::AND, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP3, Instruction::OR, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP3, Instruction::XOR, Instruction::POP}, {Instruction::POP}},
+		{{Instruction::DUP3, Instruction::DUP1, Instruction::SUB}, {u256(0)}},
+		{{Instruction::DUP3, Instruction::DUP1, Instruction::LT}, {u256(0)}},
+		{{Instruction::DUP3, Instruction::DUP1, Instruction::GT}, {u256(0)}},
+		{{Instruction::DUP3, Instruction::DUP1, Instruction::SLT}, {u256(0)}},
+		{{Instruction::DUP3, Instruction::DUP1, Instruction::SGT}, {u256(0)}},
+		{{Instruction::DUP3, Instruction::DUP1, Instruction::EQ}, {u256(1)}},
+		{{Instruction::DUP3, Instruction::DUP1, Instruction::XOR}, {u256(0)}},
+		{{Instruction::DUP3, Instruction::SWAP1, Instruction::POP}, {Instruction::POP, Instruction::DUP2}},
+		{{Instruction::DUP3, u256(0), Instruction::MUL}, {u256(0)}},
+		{{Instruction::DUP3, u256(0), Instruction::DIV}, {u256(0)}},
+		{{Instruction::DUP3, u256(0), Instruction::GT}, {u256(0)}},
+		{{Instruction::DUP3, u256(0), Instruction::AND}, {u256(0)}},
+		{{Instruction::SWAP1, Instruction::SUB, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::SWAP1, Instruction::DIV, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::SWAP1, Instruction::LT, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::SWAP1, Instruction::GT, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::SWAP1, Instruction::SLT, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::SWAP1, Instruction::SGT, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::SWAP1, Instruction::POP, Instruction::POP}, {Instruction::POP, Instruction::POP}},
+		{{Instruction::SWAP1, Instruction::DUP1, Instruction::SWAP2}, {Instruction::DUP2, Instruction::SWAP1}},
+		{{Instruction::SWAP1, Instruction::DUP2, Instruction::SWAP1}, {Instruction::DUP1, Instruction::SWAP2}},
+		{{u256(0), Instruction::MUL, Instruction::ADD}, {Instruction::POP}},
+		{{u256(0), Instruction::MUL, Instruction::EQ}, {Instruction::POP, Instruction::ISZERO}},
+		{{u256(0), Instruction::MUL, Instruction::ISZERO}, {Instruction::POP, u256(1)}},
+		{{u256(0), Instruction::MUL, Instruction::OR}, {Instruction::POP}},
+		{{u256(0), Instruction::MUL, Instruction::XOR}, {Instruction::POP}},
+		{{u256(0), Instruction::MUL, Instruction::POP}, {Instruction::POP}},
+		{{u256(0), Instruction::SUB, Instruction::POP}, {Instruction::POP}},
+		{{u256(0), Instruction::DIV, Instruction::ADD}, {Instruction::POP}},
+		{{u256(0), Instruction::DIV, Instruction::EQ}, {Instruction::POP, Instruction::ISZERO}},
+		{{u256(0), Instruction::DIV, Instruction::ISZERO}, {Instruction::POP, u256(1)}},
+		{{u256(0), Instruction::DIV, Instruction::OR}, {Instruction::POP}},
+		{{u256(0), Instruction::DIV, Instruction::XOR}, {Instruction::POP}},
+		{{u256(0), Instruction::DIV, Instruction::POP}, {Instruction::POP}},
+		{{u256(0), Instruction::LT, Instruction::ISZERO}, {Instruction::ISZERO}},
+		{{u256(0), Instruction::LT, Instruction::POP}, {Instruction::POP}},
+		{{u256(0), Instruction::GT, Instruction::ADD}, {Instruction::POP}},
+		{{u256(0), Instruction::GT, Instruction::EQ}, {Instruction::POP, Instruction::ISZERO}},
+		{{u256(0), Instruction::GT, Instruction::ISZERO}, {Instruction::POP, u256(1)}},
+		{{u256(0), Instruction::GT, Instruction::OR}, {Instruction::POP}},
+		{{u256(0), Instruction::GT, Instruction::XOR}, {Instruction::POP}},
+		{{u256(0), Instruction::GT, Instruction::POP}, {Instruction::POP}},
+		{{u256(0), Instruction::SLT, Instruction::POP}, {Instruction::POP}},
+		{{u256(0), Instruction::SGT, Instruction::POP}, {Instruction::POP}},
+		{{u256(0), Instruction::AND, Instruction::ADD}, {Instruction::POP}},
+		{{u256(0), Instruction::AND, Instruction::EQ}, {Instruction::POP, Instruction::ISZERO}},
+		{{u256(0), Instruction::AND, Instruction::ISZERO}, {Instruction::POP, u256(1)}},
+		{{u256(0), Instruction::AND, Instruction::OR}, {Instruction::POP}},
+		{{u256(0), Instruction::AND, Instruction::XOR}, {Instruction::POP}},
+		{{u256(0), Instruction::AND, Instruction::POP}, {Instruction::POP}},
+		{{u256(0), Instruction::NOT, Instruction::MUL}, {u256(0), Instruction::SUB}},
+		{{u256(0), Instruction::NOT, Instruction::SUB}, {Instruction::NOT}},
+		{{u256(0), Instruction::NOT, Instruction::LT}, {Instruction::POP, u256(0)}},
+		{{u256(0), Instruction::NOT, Instruction::ISZERO}, {u256(0)}},
+		{{u256(0), Instruction::NOT, Instruction::AND}, {}},
+		{{u256(0), Instruction::DUP1, Instruction::ADD}, {u256(0)}},
+		{{u256(0), Instruction::DUP1, Instruction::MUL}, {u256(0)}},
+		{{u256(0), Instruction::DUP1, Instruction::SUB}, {u256(0)}},
+		{{u256(0), Instruction::DUP1, Instruction::DIV}, {u256(0)}},
+		{{u256(0), Instruction::DUP1, Instruction::LT}, {u256(0)}},
+		{{u256(0), Instruction::DUP1, Instruction::GT}, {u256(0)}},
+		{{u256(0), Instruction::DUP1, Instruction::SLT}, {u256(0)}},
+		{{u256(0), Instruction::DUP1, Instruction::SGT}, {u256(0)}},
+		{{u256(0), Instruction::DUP1, Instruction::EQ}, {u256(1)}},
+		{{u256(0), Instruction::DUP1, Instruction::ISZERO}, {u256(0), u256(1)}},
+		{{u256(0), Instruction::DUP1, Instruction::XOR}, {u256(0)}},
+		{{u256(0), Instruction::DUP2, Instruction::ADD}, {Instruction::DUP1}},
+		{{u256(0), Instruction::DUP2, Instruction::MUL}, {u256(0)}},
+		{{u256(0), Instruction::DUP2, Instruction::SUB}, {Instruction::DUP1}},
+		{{u256(0), Instruction::DUP2, Instruction::DIV}, {u256(0)}},
+		{{u256(0), Instruction::DUP2, Instruction::LT}, {u256(0)}},
+		{{u256(0), Instruction::DUP2, Instruction::EQ}, {Instruction::DUP1, Instruction::ISZERO}},
+		{{u256(0), Instruction::DUP2, Instruction::AND}, {u256(0)}},
+		{{u256(0), Instruction::DUP2, Instruction::OR}, {Instruction::DUP1}},
+		{{u256(0), Instruction::DUP2, Instruction::XOR}, {Instruction::DUP1}},
+		{{u256(0), Instruction::DUP2, Instruction::SWAP1}, {Instruction::DUP1, u256(0)}},
+		{{u256(0), Instruction::DUP3, Instruction::ADD}, {Instruction::DUP2}},
+		{{u256(0), Instruction::DUP3, Instruction::MUL}, {u256(0)}},
+		{{u256(0), Instruction::DUP3, Instruction::SUB}, {Instruction::DUP2}},
+		{{u256(0), Instruction::DUP3, Instruction::DIV}, {u256(0)}},
+		{{u256(0), Instruction::DUP3, Instruction::LT}, {u256(0)}},
+		{{u256(0), Instruction::DUP3, Instruction::EQ}, {Instruction::DUP2, Instruction::ISZERO}},
+		{{u256(0), Instruction::DUP3, Instruction::AND}, {u256(0)}},
+		{{u256(0), Instruction::DUP3, Instruction::OR}, {Instruction::DUP2}},
+		{{u256(0), Instruction::DUP3, Instruction::XOR}, {Instruction::DUP2}},
+		{{u256(0), Instruction::DUP3, Instruction::SWAP1}, {Instruction::DUP2, u256(0)}},
+		{{u256(0), Instruction::SWAP1, Instruction::SUB}, {}},
+		{{u256(0), Instruction::SWAP1, Instruction::DIV}, {Instruction::POP, u256(0)}},
+		{{u256(0), Instruction::SWAP1, Instruction::LT}, {Instruction::POP, u256(0)}},
+		{{u256(0), Instruction::SWAP1, Instruction::GT}, {Instruction::ISZERO, Instruction::ISZERO}},
+		{{u256(0), Instruction::SWAP1, Instruction::POP}, {Instruction::POP, u256(0)}},
+		{{u256(0), u256(0), Instruction::MUL}, {u256(0)}},
+		{{u256(0), u256(0), Instruction::SUB}, {u256(0)}},
+		{{u256(0), u256(0), Instruction::DIV}, {u256(0)}},
+		{{u256(0), u256(0), Instruction::LT}, {u256(0)}},
+		{{u256(0), u256(0), Instruction::GT}, {u256(0)}},
+		{{u256(0), u256(0), Instruction::SLT}, {u256(0)}},
+		{{u256(0), u256(0), Instruction::SGT}, {u256(0)}},
+		{{u256(0), u256(0), Instruction::AND}, {u256(0)}},
+		{{u256(0), u256(0), Instruction::SWAP1}, {u256(0), Instruction::DUP1}},
+		{{u256(0), u256(1), Instruction::ADD}, {u256(1)}},
+		{{u256(0), u256(1), Instruction::SUB}, {u256(1)}},
+		{{u256(0), u256(1), Instruction::DIV}, {u256(0)}},
+		{{u256(0), u256(1), Instruction::LT}, {u256(0)}},
+		{{u256(0), u256(1), Instruction::GT}, {u256(1)}},
+		{{u256(0), u256(1), Instruction::SLT}, {u256(0)}},
+		{{u256(0), u256(1), Instruction::SGT}, {u256(1)}},
+		{{u256(0), u256(1), Instruction::EQ}, {u256(0)}},
+		{{u256(0), u256(1), Instruction::AND}, {u256(0)}},
+		{{u256(0), u256(1), Instruction::OR}, {u256(1)}},
+		{{u256(0), u256(1), Instruction::XOR}, {u256(1)}},
+		{{u256(0), u256(1), Instruction::SWAP1}, {u256(1), u256(0)}},
+		{{u256(0), u256(2), Instruction::ADD}, {u256(2)}},
+		{{u256(0), u256(2), Instruction::MUL}, {u256(0)}},
+		{{u256(0), u256(2), Instruction::SUB}, {u256(2)}},
+		{{u256(0), u256(2), Instruction::DIV}, {u256(0)}},
+		{{u256(0), u256(2), Instruction::LT}, {u256(0)}},
+		{{u256(0), u256(2), Instruction::GT}, {u256(1)}},
+		{{u256(0), u256(2), Instruction::SLT}, {u256(0)}},
+		{{u256(0), u256(2), Instruction::SGT}, {u256(1)}},
+		{{u256(0), u256(2), Instruction::EQ}, {u256(0)}},
+		{{u256(0), u256(2), Instruction::AND}, {u256(0)}},
+		{{u256(0), u256(2), Instruction::OR}, {u256(2)}},
+		{{u256(0), u256(2), Instruction::XOR}, {u256(2)}},
+		{{u256(0), u256(2), Instruction::SWAP1}, {u256(2), u256(0)}},
+		{{u256(0), u256(32), Instruction::ADD}, {u256(32)}},
+		{{u256(0), u256(32), Instruction::MUL}, {u256(0)}},
+		{{u256(0), u256(32), Instruction::SUB}, {u256(32)}},
+		{{u256(0), u256(32), Instruction::DIV}, {u256(0)}},
+		{{u256(0), u256(32), Instruction::LT}, {u256(0)}},
+		{{u256(0), u256(32), Instruction::GT}, {u256(1)}},
+		{{u256(0), u256(32), Instruction::SLT}, {u256(0)}},
+		{{u256(0), u256(32), Instruction::SGT}, {u256(1)}},
+		{{u256(0), u256(32), Instruction::EQ}, {u256(0)}},
+		{{u256(0), u256(32), Instruction::AND}, {u256(0)}},
+		{{u256(0), u256(32), Instruction::OR}, {u256(32)}},
+		{{u256(0), u256(32), Instruction::XOR}, {u256(32)}},
+		{{u256(0), u256(32), Instruction::SWAP1}, {u256(32), u256(0)}},
+		{{u256(1), Instruction::ADD, Instruction::POP}, {Instruction::POP}},
+		{{u256(1), Instruction::SUB, Instruction::POP}, {Instruction::POP}},
+		{{u256(1), Instruction::DIV, Instruction::POP}, {Instruction::POP}},
+		{{u256(1), Instruction::LT, Instruction::POP}, {Instruction::POP}},
+		{{u256(1), Instruction::GT, Instruction::POP}, {Instruction::POP}},
+		{{u256(1), Instruction::SLT, Instruction::POP}, {Instruction::POP}},
+		{{u256(1), Instruction::SGT, Instruction::POP}, {Instruction::POP}},
+		{{u256(1), Instruction::EQ, Instruction::POP}, {Instruction::POP}},
+		{{u256(1), Instruction::AND, Instruction::POP}, {Instruction::POP}},
+		{{u256(1), Instruction::OR, Instruction::POP}, {Instruction::POP}},
+		{{u256(1), Instruction::XOR, Instruction::POP}, {Instruction::POP}},
+		{{u256(1), Instruction::NOT, Instruction::ISZERO}, {u256(0)}},
+		{{u256(1), Instruction::DUP1, Instruction::ADD}, {u256(2)}},
+		{{u256(1), Instruction::DUP1, Instruction::MUL}, {u256(1)}},
+		{{u256(1), Instruction::DUP1, Instruction::SUB}, {u256(0)}},
+		{{u256(1), Instruction::DUP1, Instruction::DIV}, {u256(1)}},
+		{{u256(1), Instruction::DUP1, Instruction::LT}, {u256(0)}},
+		{{u256(1), Instruction::DUP1, Instruction::GT}, {u256(0)}},
+		{{u256(1), Instruction::DUP1, Instruction::SLT}, {u256(0)}},
+		{{u256(1), Instruction::DUP1, Instruction::SGT}, {u256(0)}},
+		{{u256(1), Instruction::DUP1, Instruction::EQ}, {u256(1)}},
+		{{u256(1), Instruction::DUP1, Instruction::ISZERO}, {u256(1), u256(0)}},
+		{{u256(1), Instruction::DUP1, Instruction::XOR}, {u256(0)}},
+		{{u256(1), Instruction::DUP2, Instruction::MUL}, {Instruction::DUP1}},
+		{{u256(1), Instruction::DUP2, Instruction::DIV}, {Instruction::DUP1}},
+		{{u256(1), Instruction::DUP2, Instruction::SWAP1}, {Instruction::DUP1, u256(1)}},
+		{{u256(1), Instruction::DUP3, Instruction::MUL}, {Instruction::DUP2}},
+		{{u256(1), Instruction::DUP3, Instruction::DIV}, {Instruction::DUP2}},
+		{{u256(1), Instruction::DUP3, Instruction::SWAP1}, {Instruction::DUP2, u256(1)}},
+		{{u256(1), Instruction::SWAP1, Instruction::DIV}, {}},
+		{{u256(1), Instruction::SWAP1, Instruction::POP}, {Instruction::POP, u256(1)}},
+		{{u256(1), u256(0), Instruction::MUL}, {u256(0)}},
+		{{u256(1), u256(0), Instruction::SUB}, {u256(0), Instruction::NOT}},
+		{{u256(1), u256(0), Instruction::DIV}, {u256(0)}},
+		{{u256(1), u256(0), Instruction::LT}, {u256(1)}},
+		{{u256(1), u256(0), Instruction::GT}, {u256(0)}},
+		{{u256(1), u256(0), Instruction::SLT}, {u256(1)}},
+		{{u256(1), u256(0), Instruction::SGT}, {u256(0)}},
+		{{u256(1), u256(0), Instruction::AND}, {u256(0)}},
+		{{u256(1), u256(0), Instruction::SWAP1}, {u256(0), u256(1)}},
+		{{u256(1), u256(1), Instruction::ADD}, {u256(2)}},
+		{{u256(1), u256(1), Instruction::SUB}, {u256(0)}},
+		{{u256(1), u256(1), Instruction::DIV}, {u256(1)}},
+		{{u256(1), u256(1), Instruction::LT}, {u256(0)}},
+		{{u256(1), u256(1), Instruction::GT}, {u256(0)}},
+		{{u256(1), u256(1), Instruction::SLT}, {u256(0)}},
+		{{u256(1), u256(1), Instruction::SGT}, {u256(0)}},
+		{{u256(1), u256(1), Instruction::EQ}, {u256(1)}},
+		{{u256(1), u256(1), Instruction::AND}, {u256(1)}},
+		{{u256(1), u256(1), Instruction::OR}, {u256(1)}},
+		{{u256(1), u256(1), Instruction::XOR}, {u256(0)}},
+		{{u256(1), u256(1), Instruction::SWAP1}, {u256(1), Instruction::DUP1}},
+		{{u256(1), u256(2), Instruction::MUL}, {u256(2)}},
+		{{u256(1), u256(2), Instruction::SUB}, {u256(1)}},
+		{{u256(1), u256(2), Instruction::DIV}, {u256(2)}},
+		{{u256(1), u256(2), Instruction::LT}, {u256(0)}},
+		{{u256(1), u256(2), Instruction::GT}, {u256(1)}},
+		{{u256(1), u256(2), Instruction::SLT}, {u256(0)}},
+		{{u256(1), u256(2), Instruction::SGT}, {u256(1)}},
+		{{u256(1), u256(2), Instruction::EQ}, {u256(0)}},
+		{{u256(1), u256(2), Instruction::AND}, {u256(0)}},
+		{{u256(1), u256(2), Instruction::SWAP1}, {u256(2), u256(1)}},
+		{{u256(1), u256(32), Instruction::MUL}, {u256(32)}},
+		{{u256(1), u256(32), Instruction::DIV}, {u256(32)}},
+		{{u256(1), u256(32), Instruction::LT}, {u256(0)}},
+		{{u256(1), u256(32), Instruction::GT}, {u256(1)}},
+		{{u256(1), u256(32), Instruction::SLT}, {u256(0)}},
+		{{u256(1), u256(32), Instruction::SGT}, {u256(1)}},
+		{{u256(1), u256(32), Instruction::EQ}, {u256(0)}},
+		{{u256(1), u256(32), Instruction::AND}, {u256(0)}},
+		{{u256(1), u256(32), Instruction::SWAP1}, {u256(32), u256(1)}},
+		{{u256(2), Instruction::ADD, Instruction::POP}, {Instruction::POP}},
+		{{u256(2), Instruction::MUL, Instruction::POP}, {Instruction::POP}},
+		{{u256(2), Instruction::SUB, Instruction::POP}, {Instruction::POP}},
+		{{u256(2), Instruction::DIV, Instruction::POP}, {Instruction::POP}},
+		{{u256(2), Instruction::LT, Instruction::POP}, {Instruction::POP}},
+		{{u256(2), Instruction::GT, Instruction::POP}, {Instruction::POP}},
+		{{u256(2), Instruction::SLT, Instruction::POP}, {Instruction::POP}},
+		{{u256(2), Instruction::SGT, Instruction::POP}, {Instruction::POP}},
+		{{u256(2), Instruction::EQ, Instruction::POP}, {Instruction::POP}},
+		{{u256(2), Instruction::AND, Instruction::POP}, {Instruction::POP}},
+		{{u256(2), Instruction::OR, Instruction::POP}, {Instruction::POP}},
+		{{u256(2), Instruction::XOR, Instruction::POP}, {Instruction::POP}},
+		{{u256(2), Instruction::NOT, Instruction::ISZERO}, {u256(0)}},
+		{{u256(2), Instruction::DUP1, Instruction::SUB}, {u256(0)}},
+		{{u256(2), Instruction::DUP1, Instruction::DIV}, {u256(1)}},
+		{{u256(2), Instruction::DUP1, Instruction::LT}, {u256(0)}},
+		{{u256(2), Instruction::DUP1, Instruction::GT}, {u256(0)}},
+		{{u256(2), Instruction::DUP1, Instruction::SLT}, {u256(0)}},
+		{{u256(2), Instruction::DUP1, Instruction::SGT}, {u256(0)}},
+		{{u256(2), Instruction::DUP1, Instruction::EQ}, {u256(1)}},
+		{{u256(2), Instruction::DUP1, Instruction::ISZERO}, {u256(2), u256(0)}},
+		{{u256(2), Instruction::DUP1, Instruction::XOR}, {u256(0)}},
+		{{u256(2), Instruction::DUP2, Instruction::SWAP1}, {Instruction::DUP1, u256(2)}},
+		{{u256(2), Instruction::DUP3, Instruction::SWAP1}, {Instruction::DUP2, u256(2)}},
+		{{u256(2), Instruction::SWAP1, Instruction::POP}, {Instruction::POP, u256(2)}},
+		{{u256(2), u256(0), Instruction::MUL}, {u256(0)}},
+		{{u256(2), u256(0), Instruction::SUB}, {u256(1), Instruction::NOT}},
+		{{u256(2), u256(0), Instruction::DIV}, {u256(0)}},
+		{{u256(2), u256(0), Instruction::LT}, {u256(1)}},
+		{{u256(2), u256(0), Instruction::GT}, {u256(0)}},
+		{{u256(2), u256(0), Instruction::SLT}, {u256(1)}},
+		{{u256(2), u256(0), Instruction::SGT}, {u256(0)}},
+		{{u256(2), u256(0), Instruction::AND}, {u256(0)}},
+		{{u256(2), u256(0), Instruction::SWAP1}, {u256(0), u256(2)}},
+		{{u256(2), u256(1), Instruction::SUB}, {u256(0), Instruction::NOT}},
+		{{u256(2), u256(1), Instruction::DIV}, {u256(0)}},
+		{{u256(2), u256(1), Instruction::LT}, {u256(1)}},
+		{{u256(2), u256(1), Instruction::GT}, {u256(0)}},
+		{{u256(2), u256(1), Instruction::SLT}, {u256(1)}},
+		{{u256(2), u256(1), Instruction::SGT}, {u256(0)}},
+		{{u256(2), u256(1), Instruction::EQ}, {u256(0)}},
+		{{u256(2), u256(1), Instruction::AND}, {u256(0)}},
+		{{u256(2), u256(1), Instruction::SWAP1}, {u256(1), u256(2)}},
+		{{u256(2), u256(2), Instruction::SUB}, {u256(0)}},
+		{{u256(2), u256(2), Instruction::DIV}, {u256(1)}},
+		{{u256(2), u256(2), Instruction::LT}, {u256(0)}},
+		{{u256(2), u256(2), Instruction::GT}, {u256(0)}},
+		{{u256(2), u256(2), Instruction::SLT}, {u256(0)}},
+		{{u256(2), u256(2), Instruction::SGT}, {u256(0)}},
+		{{u256(2), u256(2), Instruction::EQ}, {u256(1)}},
+		{{u256(2), u256(2), Instruction::AND}, {u256(2)}},
+		{{u256(2), u256(2), Instruction::OR}, {u256(2)}},
+		{{u256(2), u256(2), Instruction::XOR}, {u256(0)}},
+		{{u256(2), u256(2), Instruction::SWAP1}, {u256(2), Instruction::DUP1}},
+		{{u256(2), u256(32), Instruction::LT}, {u256(0)}},
+		{{u256(2), u256(32), Instruction::GT}, {u256(1)}},
+		{{u256(2), u256(32), Instruction::SLT}, {u256(0)}},
+		{{u256(2), u256(32), Instruction::SGT}, {u256(1)}},
+		{{u256(2), u256(32), Instruction::EQ}, {u256(0)}},
+		{{u256(2), u256(32), Instruction::AND}, {u256(0)}},
+		{{u256(2), u256(32), Instruction::SWAP1}, {u256(32), u256(2)}},
+		{{u256(32), Instruction::ADD, Instruction::POP}, {Instruction::POP}},
+		{{u256(32), Instruction::MUL, Instruction::POP}, {Instruction::POP}},
+		{{u256(32), Instruction::SUB, Instruction::POP}, {Instruction::POP}},
+		{{u256(32), Instruction::DIV, Instruction::POP}, {Instruction::POP}},
+		{{u256(32), Instruction::LT, Instruction::POP}, {Instruction::POP}},
+		{{u256(32), Instruction::GT, Instruction::POP}, {Instruction::POP}},
+		{{u256(32), Instruction::SLT, Instruction::POP}, {Instruction::POP}},
+		{{u256(32), Instruction::SGT, Instruction::POP}, {Instruction::POP}},
+		{{u256(32), Instruction::EQ, Instruction::POP}, {Instruction::POP}},
+		{{u256(32), Instruction::AND, Instruction::POP}, {Instruction::POP}},
+		{{u256(32), Instruction::OR, Instruction::POP}, {Instruction::POP}},
+		{{u256(32), Instruction::XOR, Instruction::POP}, {Instruction::POP}},
+		{{u256(32), Instruction::NOT, Instruction::ISZERO}, {u256(0)}},
+		{{u256(32), Instruction::DUP1, Instruction::SUB}, {u256(0)}},
+		{{u256(32), Instruction::DUP1, Instruction::DIV}, {u256(1)}},
+		{{u256(32), Instruction::DUP1, Instruction::LT}, {u256(0)}},
+		{{u256(32), Instruction::DUP1, Instruction::GT}, {u256(0)}},
+		{{u256(32), Instruction::DUP1, Instruction::SLT}, {u256(0)}},
+		{{u256(32), Instruction::DUP1, Instruction::SGT}, {u256(0)}},
+		{{u256(32), Instruction::DUP1, Instruction::EQ}, {u256(1)}},
+		{{u256(32), Instruction::DUP1, Instruction::ISZERO}, {u256(32), u256(0)}},
+		{{u256(32), Instruction::DUP1, Instruction::XOR}, {u256(0)}},
+		{{u256(32), Instruction::DUP2, Instruction::SWAP1}, {Instruction::DUP1, u256(32)}},
+		{{u256(32), Instruction::DUP3, Instruction::SWAP1}, {Instruction::DUP2, u256(32)}},
+		{{u256(32), Instruction::SWAP1, Instruction::POP}, {Instruction::POP, u256(32)}},
+		{{u256(32), u256(0), Instruction::MUL}, {u256(0)}},
+		{{u256(32), u256(0), Instruction::DIV}, {u256(0)}},
+		{{u256(32), u256(0), Instruction::LT}, {u256(1)}},
+		{{u256(32), u256(0), Instruction::GT}, {u256(0)}},
+		{{u256(32), u256(0), Instruction::SLT}, {u256(1)}},
+		{{u256(32), u256(0), Instruction::SGT}, {u256(0)}},
+		{{u256(32), u256(0), Instruction::AND}, {u256(0)}},
+		{{u256(32), u256(0), Instruction::SWAP1}, {u256(0), u256(32)}},
+		{{u256(32), u256(1), Instruction::DIV}, {u256(0)}},
+		{{u256(32), u256(1), Instruction::LT}, {u256(1)}},
+		{{u256(32), u256(1), Instruction::GT}, {u256(0)}},
+		{{u256(32), u256(1), Instruction::SLT}, {u256(1)}},
+		{{u256(32), u256(1), Instruction::SGT}, {u256(0)}},
+		{{u256(32), u256(1), Instruction::EQ}, {u256(0)}},
+		{{u256(32), u256(1), Instruction::AND}, {u256(0)}},
+		{{u256(32), u256(1), Instruction::SWAP1}, {u256(1), u256(32)}},
+		{{u256(32), u256(2), Instruction::DIV}, {u256(0)}},
+		{{u256(32), u256(2), Instruction::LT}, {u256(1)}},
+		{{u256(32), u256(2), Instruction::GT}, {u256(0)}},
+		{{u256(32), u256(2), Instruction::SLT}, {u256(1)}},
+		{{u256(32), u256(2), Instruction::SGT}, {u256(0)}},
+		{{u256(32), u256(2), Instruction::EQ}, {u256(0)}},
+		{{u256(32), u256(2), Instruction::AND}, {u256(0)}},
+		{{u256(32), u256(2), Instruction::SWAP1}, {u256(2), u256(32)}},
+		{{u256(32), u256(32), Instruction::SUB}, {u256(0)}},
+		{{u256(32), u256(32), Instruction::DIV}, {u256(1)}},
+		{{u256(32), u256(32), Instruction::LT}, {u256(0)}},
+		{{u256(32), u256(32), Instruction::GT}, {u256(0)}},
+		{{u256(32), u256(32), Instruction::SLT}, {u256(0)}},
+		{{u256(32), u256(32), Instruction::SGT}, {u256(0)}},
+		{{u256(32), u256(32), Instruction::EQ}, {u256(1)}},
+		{{u256(32), u256(32), Instruction::AND}, {u256(32)}},
+		{{u256(32), u256(32), Instruction::OR}, {u256(32)}},
+		{{u256(32), u256(32), Instruction::XOR}, {u256(0)}},
+		{{u256(32), u256(32), Instruction::SWAP1}, {u256(32), Instruction::DUP1}}
+	};
+}
+
+}
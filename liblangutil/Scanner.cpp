@@ -59,6 +59,14 @@
 #include <ostream>
 #include <tuple>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SOL_SCANNER_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
 using namespace std;
 
 namespace solidity::langutil {
@@ -95,7 +103,6 @@ ostream& operator<<(ostream& os, ScannerError _errorCode)
 enum LiteralType
 {
 	LITERAL_TYPE_STRING,
-	LITERAL_TYPE_NUMBER, // not really different from string type in behaviour
 	LITERAL_TYPE_COMMENT
 };
 
@@ -110,7 +117,10 @@ public:
 		if (_type == LITERAL_TYPE_COMMENT)
 			m_scanner->m_skippedComments[Scanner::NextNext].literal.clear();
 		else
+		{
 			m_scanner->m_tokens[Scanner::NextNext].literal.clear();
+			m_scanner->m_tokens[Scanner::NextNext].sourceLiteral = {};
+		}
 	}
 	~LiteralScope()
 	{
@@ -119,7 +129,10 @@ public:
 			if (m_type == LITERAL_TYPE_COMMENT)
 				m_scanner->m_skippedComments[Scanner::NextNext].literal.clear();
 			else
+			{
 				m_scanner->m_tokens[Scanner::NextNext].literal.clear();
+				m_scanner->m_tokens[Scanner::NextNext].sourceLiteral = {};
+			}
 		}
 	}
 	void complete() { m_complete = true; }
@@ -130,6 +143,117 @@ private:
 	bool m_complete;
 };
 
+namespace
+{
+
+// Block-wise search for the end of the runs of characters the scanner skips over.
+// SSE2 is part of every x86-64 CPU, so no runtime dispatch is needed. The vector loops
+// only look at complete blocks of 16 bytes and the scalar loops, which are also used on
+// all other platforms, continue from where they stopped, so the result is always the same.
+
+bool isLineTerminatorCandidate(char _c)
+{
+	// Ascii line terminators and the lead bytes of the utf8 encodings of NEL, LS and PS.
+	return ('\n' <= _c && _c <= '\r') || uint8_t(_c) == 0xc2 || uint8_t(_c) == 0xe2;
+}
+
+#ifdef SOL_SCANNER_SSE2
+__m128i equalTo(__m128i _block, char _c)
+{
+	return _mm_cmpeq_epi8(_block, _mm_set1_epi8(_c));
+}
+
+__m128i inRange(__m128i _block, char _low, char _high)
+{
+	return _mm_and_si128(
+		_mm_cmpeq_epi8(_mm_max_epu8(_block, _mm_set1_epi8(_low)), _block),
+		_mm_cmpeq_epi8(_mm_min_epu8(_block, _mm_set1_epi8(_high)), _block)
+	);
+}
+
+/// Calls @a _matches on the blocks of @a _source starting at @a _position.
+/// @returns the position of the first byte whose bit in the mask of @a _matches is set
+/// or the start of the first incomplete block.
+template <class Matches>
+size_t findInBlocks(string const& _source, size_t _position, Matches _matches)
+{
+	for (; _position + 16 <= _source.size(); _position += 16)
+	{
+		__m128i block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(_source.data() + _position));
+		if (unsigned mask = _matches(block) & 0xffffu)
+		{
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward(&index, mask);
+			return _position + index;
+#else
+			return _position + static_cast<size_t>(__builtin_ctz(mask));
+#endif
+		}
+	}
+	return _position;
+}
+#endif
+
+/// @returns the position of the first byte at or after @a _position that can start a line
+/// terminator or the size of @a _source.
+size_t findLineTerminatorCandidate(string const& _source, size_t _position)
+{
+#ifdef SOL_SCANNER_SSE2
+	_position = findInBlocks(_source, _position, [](__m128i _block) {
+		return unsigned(_mm_movemask_epi8(_mm_or_si128(
+			inRange(_block, '\n', '\r'),
+			_mm_or_si128(equalTo(_block, char(0xc2)), equalTo(_block, char(0xe2)))
+		)));
+	});
+#endif
+	while (_position < _source.size() && !isLineTerminatorCandidate(_source[_position]))
+		++_position;
+	return _position;
+}
+
+/// @returns the position of the first byte at or after @a _position that is not a whitespace
+/// or the size of @a _source.
+size_t findNonWhiteSpace(string const& _source, size_t _position)
+{
+#ifdef SOL_SCANNER_SSE2
+	_position = findInBlocks(_source, _position, [](__m128i _block) {
+		return ~unsigned(_mm_movemask_epi8(_mm_or_si128(
+			_mm_or_si128(equalTo(_block, ' '), equalTo(_block, '\n')),
+			_mm_or_si128(equalTo(_block, '\t'), equalTo(_block, '\r'))
+		)));
+	});
+#endif
+	while (_position < _source.size() && isWhiteSpace(_source[_position]))
+		++_position;
+	return _position;
+}
+
+/// @returns the position of the first byte at or after @a _position that is not part of an
+/// identifier or the size of @a _source. Periods are part of identifiers if @a _allowPeriod is set.
+size_t findNonIdentifierPart(string const& _source, size_t _position, bool _allowPeriod)
+{
+#ifdef SOL_SCANNER_SSE2
+	_position = findInBlocks(_source, _position, [&](__m128i _block) {
+		__m128i identifierPart = _mm_or_si128(
+			_mm_or_si128(inRange(_block, 'a', 'z'), inRange(_block, 'A', 'Z')),
+			_mm_or_si128(inRange(_block, '0', '9'), _mm_or_si128(equalTo(_block, '_'), equalTo(_block, '$')))
+		);
+		if (_allowPeriod)
+			identifierPart = _mm_or_si128(identifierPart, equalTo(_block, '.'));
+		return ~unsigned(_mm_movemask_epi8(identifierPart));
+	});
+#endif
+	while (
+		_position < _source.size() &&
+		(isIdentifierPart(_source[_position]) || (_allowPeriod && _source[_position] == '.'))
+	)
+		++_position;
+	return _position;
+}
+
+}
+
 void Scanner::reset(CharStream _source)
 {
 	m_source = make_shared<CharStream>(std::move(_source));
@@ -221,6 +345,11 @@ void Scanner::addUnicodeAsUTF8(unsigned codepoint)
 	}
 }
 
+void Scanner::setSourceLiteral(size_t _start)
+{
+	m_tokens[NextNext].sourceLiteral = string_view(m_source->source()).substr(_start, sourcePos() - _start);
+}
+
 void Scanner::rescan()
 {
 	size_t rollbackTo = 0;
@@ -260,11 +389,12 @@ Token Scanner::selectToken(char _next, Token _then, Token _else)
 
 bool Scanner::skipWhitespace()
 {
-	size_t const startPosition = sourcePos();
-	while (isWhiteSpace(m_char))
-		advance();
-	// Return whether or not we skipped any characters.
-	return sourcePos() != startPosition;
+	if (!isWhiteSpace(m_char))
+		return false;
+	// The current character can be the whitespace that replaces the end of a multi-line comment.
+	advance();
+	m_char = m_source->setPosition(findNonWhiteSpace(m_source->source(), sourcePos()));
+	return true;
 }
 
 bool Scanner::skipWhitespaceExceptUnicodeLinebreak()
@@ -280,8 +410,9 @@ Token Scanner::skipSingleLineComment()
 {
 	// Line terminator is not part of the comment. If it is a
 	// non-ascii line terminator, it will result in a parser error.
-	while (!isUnicodeLinebreak())
-		if (!advance()) break;
+	m_char = m_source->setPosition(findLineTerminatorCandidate(m_source->source(), sourcePos()));
+	while (!isSourcePastEndOfInput() && !isUnicodeLinebreak())
+		m_char = m_source->setPosition(findLineTerminatorCandidate(m_source->source(), sourcePos() + 1));
 
 	return Token::Whitespace;
 }
@@ -354,20 +485,18 @@ size_t Scanner::scanSingleLineDocComment()
 
 Token Scanner::skipMultiLineComment()
 {
-	while (!isSourcePastEndOfInput())
-	{
-		char ch = m_char;
-		advance();
-
+	string const& source = m_source->source();
+	for (size_t star = source.find('*', sourcePos()); star != string::npos; star = source.find('*', star + 1))
 		// If we have reached the end of the multi-line comment, we
 		// consume the '/' and insert a whitespace. This way all
 		// multi-line comments are treated as whitespace.
-		if (ch == '*' && m_char == '/')
+		if (star + 1 < source.size() && source[star + 1] == '/')
 		{
+			m_source->setPosition(star + 1);
 			m_char = ' ';
 			return Token::Whitespace;
 		}
-	}
+	m_char = m_source->setPosition(source.size());
 	// Unterminated multi-line comment.
 	return setError(ScannerError::IllegalCommentTerminator);
 }
@@ -779,20 +908,30 @@ Token Scanner::scanString()
 	char const quote = m_char;
 	advance();  // consume quote
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
+	size_t const start = sourcePos();
+	// Strings without escape sequences are verbatim parts of the source and not copied.
+	bool verbatim = true;
 	while (m_char != quote && !isSourcePastEndOfInput() && !isUnicodeLinebreak())
 	{
 		char c = m_char;
 		advance();
 		if (c == '\\')
 		{
+			if (verbatim)
+			{
+				m_tokens[NextNext].literal = m_source->source().substr(start, sourcePos() - 1 - start);
+				verbatim = false;
+			}
 			if (isSourcePastEndOfInput() || !scanEscape())
 				return setError(ScannerError::IllegalEscapeSequence);
 		}
-		else
+		else if (!verbatim)
 			addLiteralChar(c);
 	}
 	if (m_char != quote)
 		return setError(ScannerError::IllegalStringEndQuote);
+	if (verbatim)
+		setSourceLiteral(start);
 	literal.complete();
 	advance();  // consume quote
 	return Token::StringLiteral;
@@ -841,7 +980,7 @@ void Scanner::scanDecimalDigits()
 
 	// May continue with decimal digit or underscore for grouping.
 	do
-		addLiteralCharAndAdvance();
+		advance();
 	while (!m_source->isPastEndOfInput() && (isDecimalDigit(m_char) || m_char == '_'));
 
 	// Defer further validation of underscore to SyntaxChecker.
@@ -850,11 +989,11 @@ void Scanner::scanDecimalDigits()
 Token Scanner::scanNumber(char _charSeen)
 {
 	enum { DECIMAL, HEX, BINARY } kind = DECIMAL;
-	LiteralScope literal(this, LITERAL_TYPE_NUMBER);
+	// The literal starts at the token, which includes the decimal point if it was already seen.
+	size_t const start = static_cast<size_t>(m_tokens[NextNext].location.start);
 	if (_charSeen == '.')
 	{
 		// we have already seen a decimal point of the float
-		addLiteralChar('.');
 		if (m_char == '_')
 			return setError(ScannerError::IllegalToken);
 		scanDecimalDigits();  // we know we have at least one digit
@@ -865,18 +1004,18 @@ Token Scanner::scanNumber(char _charSeen)
 		// if the first character is '0' we must check for octals and hex
 		if (m_char == '0')
 		{
-			addLiteralCharAndAdvance();
+			advance();
 			// either 0, 0exxx, 0Exxx, 0.xxx or a hex number
 			if (m_char == 'x')
 			{
 				// hex number
 				kind = HEX;
-				addLiteralCharAndAdvance();
+				advance();
 				if (!isHexDigit(m_char))
 					return setError(ScannerError::IllegalHexDigit); // we must have at least one hex digit after 'x'
 
 				while (isHexDigit(m_char) || m_char == '_') // We keep the underscores for later validation
-					addLiteralCharAndAdvance();
+					advance();
 			}
 			else if (isDecimalDigit(m_char))
 				// We do not allow octal numbers
@@ -892,17 +1031,17 @@ Token Scanner::scanNumber(char _charSeen)
 				{
 					// Assume the input may be a floating point number with leading '_' in fraction part.
 					// Recover by consuming it all but returning `Illegal` right away.
-					addLiteralCharAndAdvance(); // '.'
-					addLiteralCharAndAdvance(); // '_'
+					advance(); // '.'
+					advance(); // '_'
 					scanDecimalDigits();
 				}
 				if (m_source->isPastEndOfInput() || !isDecimalDigit(m_source->get(1)))
 				{
 					// A '.' has to be followed by a number.
-					literal.complete();
+					setSourceLiteral(start);
 					return Token::Number;
 				}
-				addLiteralCharAndAdvance();
+				advance();
 				scanDecimalDigits();
 			}
 		}
@@ -917,16 +1056,16 @@ Token Scanner::scanNumber(char _charSeen)
 		{
 			// Recover from wrongly placed underscore as delimiter in literal with scientific
 			// notation by consuming until the end.
-			addLiteralCharAndAdvance(); // 'e'
-			addLiteralCharAndAdvance(); // '_'
+			advance(); // 'e'
+			advance(); // '_'
 			scanDecimalDigits();
-			literal.complete();
+			setSourceLiteral(start);
 			return Token::Number;
 		}
 		// scan exponent
-		addLiteralCharAndAdvance(); // 'e' | 'E'
+		advance(); // 'e' | 'E'
 		if (m_char == '+' || m_char == '-')
-			addLiteralCharAndAdvance();
+			advance();
 		if (!isDecimalDigit(m_char)) // we must have at least one decimal digit after 'e'/'E'
 			return setError(ScannerError::IllegalExponent);
 		scanDecimalDigits();
@@ -937,20 +1076,18 @@ Token Scanner::scanNumber(char _charSeen)
 	// if the value is 0).
 	if (isDecimalDigit(m_char) || isIdentifierStart(m_char))
 		return setError(ScannerError::IllegalNumberEnd);
-	literal.complete();
+	setSourceLiteral(start);
 	return Token::Number;
 }
 
 tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 {
 	solAssert(isIdentifierStart(m_char), "");
-	LiteralScope literal(this, LITERAL_TYPE_STRING);
-	addLiteralCharAndAdvance();
+	size_t const start = sourcePos();
 	// Scan the rest of the identifier characters.
-	while (isIdentifierPart(m_char) || (m_char == '.' && m_supportPeriodInIdentifier))
-		addLiteralCharAndAdvance();
-	literal.complete();
-	return TokenTraits::fromIdentifierOrKeyword(m_tokens[NextNext].literal);
+	m_char = m_source->setPosition(findNonIdentifierPart(m_source->source(), start + 1, m_supportPeriodInIdentifier));
+	setSourceLiteral(start);
+	return TokenTraits::fromIdentifierOrKeyword(m_tokens[NextNext].sourceLiteral);
 }
 
 } // namespace solidity::langutil
@@ -60,6 +60,7 @@
 
 #include <optional>
 #include <iosfwd>
+#include <string_view>
 
 namespace solidity::langutil
 {
@@ -133,7 +134,9 @@ public:
 	}
 
 	SourceLocation currentLocation() const { return m_tokens[Current].location; }
-	std::string const& currentLiteral() const { return m_tokens[Current].literal; }
+	/// @returns the literal of the current token. Unless the literal contains escape sequences,
+	/// this is a view into the source, which is only valid until the scanner is reset.
+	std::string_view currentLiteral() const { return m_tokens[Current].literalView(); }
 	std::tuple<unsigned, unsigned> const& currentTokenInfo() const { return m_tokens[Current].extendedTokenInfo; }
 
 	/// Retrieves the last error that occurred during lexical analysis.
@@ -157,7 +160,7 @@ public:
 	/// @returns the next token without advancing input.
 	Token peekNextToken() const { return m_tokens[Next].token; }
 	SourceLocation peekLocation() const { return m_tokens[Next].location; }
-	std::string const& peekLiteral() const { return m_tokens[Next].literal; }
+	std::string_view peekLiteral() const { return m_tokens[Next].literalView(); }
 
 	Token peekNextNextToken() const { return m_tokens[NextNext].token; }
 	///@}
@@ -182,9 +185,15 @@ private:
 	{
 		Token token;
 		SourceLocation location;
+		/// The literal if it is not a verbatim part of the source, i.e. contains escape sequences
+		/// or is a comment.
 		std::string literal;
+		/// The part of the source that is the literal, if there is one.
+		std::string_view sourceLiteral;
 		ScannerError error = ScannerError::NoError;
 		std::tuple<unsigned, unsigned> extendedTokenInfo;
+
+		std::string_view literalView() const { return sourceLiteral.empty() ? literal : sourceLiteral; }
 	};
 
 	///@{
@@ -192,6 +201,8 @@ private:
 	inline void addLiteralChar(char c) { m_tokens[NextNext].literal.push_back(c); }
 	inline void addCommentLiteralChar(char c) { m_skippedComments[NextNext].literal.push_back(c); }
 	inline void addLiteralCharAndAdvance() { addLiteralChar(m_char); advance(); }
+	/// Sets the literal of the token to the source from @a _start up to the current position.
+	void setSourceLiteral(size_t _start);
 	void addUnicodeAsUTF8(unsigned codepoint);
 	///@}
 
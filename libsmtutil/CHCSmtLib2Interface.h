@@ -45,6 +45,10 @@ public:
 
 	std::pair<CheckResult, std::vector<std::string>> query(Expression const& _expr) override;
 
+	/// @returns the SMT-LIB2 query that query() sends to the solver,
+	/// after declaring the variables that are still undeclared.
+	std::string dumpQuery(Expression const& _expr);
+
 	void declareVariable(std::string const& _name, SortPointer const& _sort) override;
 
 	std::vector<std::string> unhandledQueries() const { return m_unhandledQueries; }
@@ -0,0 +1,130 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsmtutil/CHCSolverPool.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::smtutil;
+
+namespace
+{
+
+/// The SMT-LIB2 queries are only generated, never answered.
+map<util::h256, string> const c_noResponses;
+
+}
+
+CHCSolverPool::CHCSolverPool(
+	vector<unique_ptr<CHCSolverInterface>> _contexts,
+	vector<SolverInterface*> _variableSolvers,
+	size_t _threads,
+	shared_ptr<SMTQueryCache const> _cache,
+	string _solvers
+):
+	m_contexts(move(_contexts)),
+	m_declarations(move(_variableSolvers)),
+	m_threads(min(_threads, m_contexts.size())),
+	m_cache(move(_cache)),
+	m_solvers(move(_solvers))
+{
+	smtAssert(!m_contexts.empty(), "");
+	if (m_cache)
+	{
+		m_queryText = make_unique<CHCSmtLib2Interface>(c_noResponses, frontend::ReadCallback::Callback{});
+		m_declarations.addSolver(m_queryText->smtlib2Interface());
+	}
+}
+
+void CHCSolverPool::declareVariable(string const& _name, SortPointer const& _sort)
+{
+	smtAssert(_sort, "");
+	for (auto const& context: m_contexts)
+		context->declareVariable(_name, _sort);
+}
+
+void CHCSolverPool::registerRelation(Expression const& _expr)
+{
+	for (auto const& context: m_contexts)
+		context->registerRelation(_expr);
+	if (m_queryText)
+		m_queryText->registerRelation(_expr);
+}
+
+void CHCSolverPool::addRule(Expression const& _expr, string const& _name)
+{
+	for (auto const& context: m_contexts)
+		context->addRule(_expr, _name);
+	if (m_queryText)
+		m_queryText->addRule(_expr, _name);
+}
+
+pair<CheckResult, vector<string>> CHCSolverPool::query(Expression const& _expr)
+{
+	return m_contexts.front()->query(_expr);
+}
+
+vector<future<pair<CheckResult, vector<string>>>> CHCSolverPool::query(vector<Query> const& _queries)
+{
+	vector<promise<pair<CheckResult, vector<string>>>> promises(_queries.size());
+	vector<string> queryTexts(_queries.size());
+	vector<bool> cached(_queries.size(), false);
+	if (m_cache)
+		for (size_t i = 0; i < _queries.size(); ++i)
+		{
+			// The rule of the query is not part of the common rules of the contexts.
+			queryTexts[i] =
+				m_queryText->dumpQuery(_queries[i].relation) + "\n" +
+				m_queryText->smtlib2Interface()->toSExpr(_queries[i].rule);
+			if (auto result = m_cache->load(m_solvers, queryTexts[i]))
+			{
+				promises[i].set_value(move(*result));
+				cached[i] = true;
+			}
+		}
+
+	vector<future<void>> contextsDone;
+	for (size_t contextIndex = 0; contextIndex < m_contexts.size(); ++contextIndex)
+		contextsDone.emplace_back(m_threads.submit([&, contextIndex]() {
+			CHCSolverInterface& context = *m_contexts[contextIndex];
+			for (size_t i = contextIndex; i < _queries.size(); i += m_contexts.size())
+				try
+				{
+					// The rule is added even if the result is cached, so that the context
+					// contains the same rules as without a cache when it solves later queries.
+					context.addRule(_queries[i].rule, _queries[i].ruleName);
+					if (cached[i])
+						continue;
+					auto result = context.query(_queries[i].relation);
+					if (m_cache)
+						m_cache->store(m_solvers, queryTexts[i], result);
+					promises[i].set_value(move(result));
+				}
+				catch (...)
+				{
+					promises[i].set_exception(current_exception());
+				}
+		}));
+	for (auto& done: contextsDone)
+		done.get();
+
+	vector<future<pair<CheckResult, vector<string>>>> results;
+	for (auto& result: promises)
+		results.emplace_back(result.get_future());
+	return results;
+}
@@ -0,0 +1,132 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <libsmtutil/CHCSmtLib2Interface.h>
+#include <libsmtutil/CHCSolverInterface.h>
+#include <libsmtutil/SMTQueryCache.h>
+
+#include <libsolutil/ThreadPool.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace solidity::smtutil
+{
+
+/**
+ * Set of independent Horn solver contexts that receive the same relations and rules,
+ * so that several reachability queries can be solved concurrently.
+ *
+ * The single-query interface only uses the first context. Batches of queries are
+ * distributed round-robin among the contexts and every context solves its queries
+ * in order, so the results only depend on the number of contexts. The engine always
+ * creates numContexts contexts, which are processed on as many threads as allowed.
+ *
+ * If a cache is given, the results of batches of queries are looked up in and added to it.
+ * The cache keys are the SMT-LIB2 versions of the queries, which are generated
+ * alongside the contexts.
+ */
+class CHCSolverPool: public CHCSolverInterface, public boost::noncopyable
+{
+public:
+	struct Query
+	{
+		/// Rule that is only needed by this query, added right before it is solved.
+		Expression rule;
+		std::string ruleName;
+		/// Relation whose reachability is queried.
+		Expression relation;
+	};
+
+	/// Number of contexts the engine creates if it solves queries itself. It does not
+	/// depend on the number of threads, so that the results do not either.
+	static size_t constexpr numContexts = 4;
+
+	/// @param _variableSolvers the solver interfaces that declare the variables
+	/// of the respective context.
+	/// @param _threads the maximum number of contexts that solve queries at the same time.
+	/// @param _solvers names and versions of the solvers of the contexts, part of the cache keys.
+	CHCSolverPool(
+		std::vector<std::unique_ptr<CHCSolverInterface>> _contexts,
+		std::vector<SolverInterface*> _variableSolvers,
+		size_t _threads,
+		std::shared_ptr<SMTQueryCache const> _cache = nullptr,
+		std::string _solvers = {}
+	);
+
+	void declareVariable(std::string const& _name, SortPointer const& _sort) override;
+
+	void registerRelation(Expression const& _expr) override;
+
+	void addRule(Expression const& _expr, std::string const& _name) override;
+
+	std::pair<CheckResult, std::vector<std::string>> query(Expression const& _expr) override;
+
+	/// Solves all @a _queries, using up to one thread per context.
+	/// @returns the results in the order of the queries. All of them are ready,
+	/// exceptions thrown while solving a query are rethrown by its future.
+	std::vector<std::future<std::pair<CheckResult, std::vector<std::string>>>> query(std::vector<Query> const& _queries);
+
+	std::vector<std::unique_ptr<CHCSolverInterface>> const& contexts() const { return m_contexts; }
+
+	/// @returns an interface that declares variables in all contexts.
+	/// It is used by the encoding and does not support any other operation.
+	SolverInterface* declarations() { return &m_declarations; }
+
+private:
+	class Declarations: public SolverInterface
+	{
+	public:
+		explicit Declarations(std::vector<SolverInterface*> _solvers): m_solvers(std::move(_solvers)) {}
+
+		void addSolver(SolverInterface* _solver) { m_solvers.emplace_back(_solver); }
+
+		void reset() override { smtAssert(false, ""); }
+		void push() override { smtAssert(false, ""); }
+		void pop() override { smtAssert(false, ""); }
+		void declareVariable(std::string const& _name, SortPointer const& _sort) override
+		{
+			for (SolverInterface* solver: m_solvers)
+				solver->declareVariable(_name, _sort);
+		}
+		void addAssertion(Expression const&) override { smtAssert(false, ""); }
+		std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const&) override
+		{
+			smtAssert(false, "");
+		}
+
+	private:
+		std::vector<SolverInterface*> m_solvers;
+	};
+
+	std::vector<std::unique_ptr<CHCSolverInterface>> m_contexts;
+	Declarations m_declarations;
+	util::ThreadPool m_threads;
+
+	std::shared_ptr<SMTQueryCache const> m_cache;
+	std::string m_solvers;
+	/// Generates the SMT-LIB2 versions of the queries, only present if there is a cache.
+	std::unique_ptr<CHCSmtLib2Interface> m_queryText;
+};
+
+}
@@ -35,18 +35,32 @@ using namespace solidity::smtutil;
 SMTPortfolio::SMTPortfolio(
 	map<h256, string> const& _smtlib2Responses,
 	frontend::ReadCallback::Callback const& _smtCallback,
-	[[maybe_unused]] SMTSolverChoice _enabledSolvers
+	[[maybe_unused]] SMTSolverChoice _enabledSolvers,
+	size_t _parallelism,
+	shared_ptr<SMTQueryCache const> _cache
 )
 {
 	m_solvers.emplace_back(make_unique<SMTLib2Interface>(_smtlib2Responses, _smtCallback));
 #ifdef HAVE_Z3
 	if (_enabledSolvers.z3)
+	{
 		m_solvers.emplace_back(make_unique<Z3Interface>());
+		m_solverVersions += "z3 " + Z3Interface::version() + "\n";
+	}
 #endif
 #ifdef HAVE_CVC4
 	if (_enabledSolvers.cvc4)
+	{
 		m_solvers.emplace_back(make_unique<CVC4Interface>());
+		m_solverVersions += "cvc4 " + CVC4Interface::version() + "\n";
+	}
 #endif
+	size_t integratedSolvers = m_solvers.size() - 1;
+	if (integratedSolvers > 1 && _parallelism > 1)
+		m_threads = make_unique<ThreadPool>(min(integratedSolvers, _parallelism));
+	// Without an integrated solver the queries are answered by the callback.
+	if (integratedSolvers > 0)
+		m_cache = move(_cache);
 }
 
 void SMTPortfolio::reset()
@@ -109,42 +123,98 @@ void SMTPortfolio::addAssertion(Expression const& _expr)
  *   when it is told that this is a hard query to solve.
  *
  *   If all solvers return ERROR, the result is ERROR.
+ *
+ * If more than one thread may be used, the integrated solvers run concurrently,
+ * but their results are combined in the same way, see checkConcurrently().
+ *
+ * Results found in the cache are returned without querying any solver.
 */
 pair<CheckResult, vector<string>> SMTPortfolio::check(vector<Expression> const& _expressionsToEvaluate)
 {
-	CheckResult lastResult = CheckResult::ERROR;
-	vector<string> finalValues;
-	for (auto const& s: m_solvers)
+	string query;
+	if (m_cache)
 	{
-		CheckResult result;
-		vector<string> values;
-		tie(result, values) = s->check(_expressionsToEvaluate);
-		if (solverAnswered(result))
-		{
-			if (!solverAnswered(lastResult))
-			{
-				lastResult = result;
-				finalValues = std::move(values);
-			}
-			else if (lastResult != result)
-			{
-				lastResult = CheckResult::CONFLICTING;
-				break;
-			}
-		}
-		else if (result == CheckResult::UNKNOWN && lastResult == CheckResult::ERROR)
-			lastResult = result;
+		query = smtlib2Interface().dumpQuery(_expressionsToEvaluate);
+		if (auto cached = m_cache->load(m_solverVersions, query))
+			return *cached;
 	}
-	return make_pair(lastResult, finalValues);
+
+	auto result = m_threads ? checkConcurrently(_expressionsToEvaluate) : checkInOrder(_expressionsToEvaluate);
+	if (m_cache)
+		m_cache->store(m_solverVersions, query, result);
+	return result;
+}
+
+pair<CheckResult, vector<string>> SMTPortfolio::checkInOrder(vector<Expression> const& _expressionsToEvaluate)
+{
+	pair<CheckResult, vector<string>> combined{CheckResult::ERROR, {}};
+	for (auto const& s: m_solvers)
+		if (!combine(combined, s->check(_expressionsToEvaluate)))
+			break;
+	return combined;
+}
+
+/*
+ * The SMT-LIB2 interface does not solve anything itself and is queried first.
+ * The integrated solvers then run concurrently and to completion. Their results
+ * are combined in the order of m_solvers, so the result and the reported model
+ * are the same as if the solvers ran one after the other.
+ */
+pair<CheckResult, vector<string>> SMTPortfolio::checkConcurrently(vector<Expression> const& _expressionsToEvaluate)
+{
+	pair<CheckResult, vector<string>> combined{CheckResult::ERROR, {}};
+	if (!combine(combined, m_solvers.front()->check(_expressionsToEvaluate)))
+		return combined;
+
+	vector<future<pair<CheckResult, vector<string>>>> results;
+	for (size_t i = 1; i < m_solvers.size(); ++i)
+		results.emplace_back(m_threads->submit([&, i]() {
+			return m_solvers[i]->check(_expressionsToEvaluate);
+		}));
+	// All solvers have to stop before an exception is propagated.
+	for (auto& result: results)
+		result.wait();
+
+	for (auto& result: results)
+		if (!combine(combined, result.get()))
+			break;
+	return combined;
 }
 
 vector<string> SMTPortfolio::unhandledQueries()
+{
+	return smtlib2Interface().unhandledQueries();
+}
+
+SMTLib2Interface& SMTPortfolio::smtlib2Interface() const
 {
 	// This code assumes that the constructor guarantees that
 	// SmtLib2Interface is in position 0.
 	smtAssert(!m_solvers.empty(), "");
-	smtAssert(dynamic_cast<SMTLib2Interface*>(m_solvers.front().get()), "");
-	return m_solvers.front()->unhandledQueries();
+	auto smtlib2 = dynamic_cast<SMTLib2Interface*>(m_solvers.front().get());
+	smtAssert(smtlib2, "");
+	return *smtlib2;
+}
+
+bool SMTPortfolio::combine(pair<CheckResult, vector<string>>& _combined, pair<CheckResult, vector<string>> _result)
+{
+	auto& [lastResult, finalValues] = _combined;
+	if (solverAnswered(_result.first))
+	{
+		if (!solverAnswered(lastResult))
+		{
+			lastResult = _result.first;
+			finalValues = std::move(_result.second);
+		}
+		else if (lastResult != _result.first)
+		{
+			lastResult = CheckResult::CONFLICTING;
+			return false;
+		}
+	}
+	else if (_result.first == CheckResult::UNKNOWN && lastResult == CheckResult::ERROR)
+		lastResult = _result.first;
+	return true;
 }
 
 bool SMTPortfolio::solverAnswered(CheckResult result)
@@ -19,22 +19,33 @@
 #pragma once
 
 
+#include <libsmtutil/SMTQueryCache.h>
 #include <libsmtutil/SolverInterface.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolutil/FixedHash.h>
+#include <libsolutil/ThreadPool.h>
 
 #include <boost/noncopyable.hpp>
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace solidity::smtutil
 {
 
+class SMTLib2Interface;
+
 /**
  * The SMTPortfolio wraps all available solvers within a single interface,
  * propagating the functionalities to all solvers.
  * It also checks whether different solvers give conflicting answers
  * to SMT queries.
+ *
+ * If it is allowed to use more than one thread, the integrated solvers
+ * run concurrently (see check()).
+ *
+ * If a cache is given, the results of the integrated solvers are looked up
+ * in and added to it.
  */
 class SMTPortfolio: public SolverInterface, public boost::noncopyable
 {
@@ -42,7 +53,9 @@ public:
 	SMTPortfolio(
 		std::map<util::h256, std::string> const& _smtlib2Responses,
 		frontend::ReadCallback::Callback const& _smtCallback,
-		SMTSolverChoice _enabledSolvers
+		SMTSolverChoice _enabledSolvers,
+		size_t _parallelism = 1,
+		std::shared_ptr<SMTQueryCache const> _cache = nullptr
 	);
 
 	void reset() override;
@@ -58,10 +71,32 @@ public:
 
 	std::vector<std::string> unhandledQueries() override;
 	unsigned solvers() override { return m_solvers.size(); }
+	/// @returns the number of threads used by a single check.
+	size_t threads() const { return m_threads ? m_threads->threads() : 1; }
 private:
 	static bool solverAnswered(CheckResult result);
+	/// Combines @a _result of the next solver with the results @a _combined of the solvers before it.
+	/// @returns false if the result is CONFLICTING, in which case further results do not matter.
+	static bool combine(
+		std::pair<CheckResult, std::vector<std::string>>& _combined,
+		std::pair<CheckResult, std::vector<std::string>> _result
+	);
+
+	SMTLib2Interface& smtlib2Interface() const;
+
+	/// Runs the solvers one after the other.
+	std::pair<CheckResult, std::vector<std::string>> checkInOrder(std::vector<Expression> const& _expressionsToEvaluate);
+
+	/// Runs the integrated solvers concurrently, with the same result as checkInOrder().
+	std::pair<CheckResult, std::vector<std::string>> checkConcurrently(std::vector<Expression> const& _expressionsToEvaluate);
 
 	std::vector<std::unique_ptr<SolverInterface>> m_solvers;
+	/// Threads the integrated solvers run on, only present if they run concurrently.
+	std::unique_ptr<util::ThreadPool> m_threads;
+	/// Only present if there is an integrated solver.
+	std::shared_ptr<SMTQueryCache const> m_cache;
+	/// Names and versions of the integrated solvers, part of the cache keys.
+	std::string m_solverVersions;
 
 	std::vector<Expression> m_assertions;
 };
@@ -0,0 +1,155 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsmtutil/SMTQueryCache.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
+
+#include <boost/filesystem.hpp>
+
+#include <map>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::smtutil;
+
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+map<CheckResult, string> const c_resultNames{
+	{CheckResult::SATISFIABLE, "sat"},
+	{CheckResult::UNSATISFIABLE, "unsat"},
+	{CheckResult::UNKNOWN, "unknown"}
+};
+
+bool isDelimiter(char _c)
+{
+	return _c == '(' || _c == ')' || _c == '|' || _c == ' ' || _c == '\n' || _c == '\t' || _c == '\r';
+}
+
+}
+
+SMTQueryCache::SMTQueryCache(string _directory, string _salt):
+	m_directory(move(_directory)),
+	m_salt(move(_salt))
+{
+	boost::system::error_code error;
+	fs::create_directories(m_directory, error);
+}
+
+optional<pair<CheckResult, vector<string>>> SMTQueryCache::load(string const& _solvers, string const& _query) const
+{
+	string content = readFileAsString(file(_solvers, _query));
+	Json::Value entry;
+	if (content.empty() || !jsonParseStrict(content, entry) || !entry.isObject() || !entry["values"].isArray())
+		return nullopt;
+
+	optional<CheckResult> result;
+	for (auto const& [value, name]: c_resultNames)
+		if (entry["result"] == name)
+			result = value;
+	if (!result)
+		return nullopt;
+
+	vector<string> values;
+	for (Json::Value const& value: entry["values"])
+	{
+		if (!value.isString())
+			return nullopt;
+		values.emplace_back(value.asString());
+	}
+	return make_pair(*result, move(values));
+}
+
+void SMTQueryCache::store(
+	string const& _solvers,
+	string const& _query,
+	pair<CheckResult, vector<string>> const& _result
+) const
+{
+	if (!c_resultNames.count(_result.first))
+		return;
+
+	Json::Value entry{Json::objectValue};
+	entry["result"] = c_resultNames.at(_result.first);
+	entry["values"] = Json::arrayValue;
+	for (string const& value: _result.second)
+		entry["values"].append(value);
+	writeFileAtomically(file(_solvers, _query), jsonCompactPrint(entry));
+}
+
+string SMTQueryCache::canonicalQuery(string const& _query)
+{
+	// Collect the declared symbols first, so that they are also renamed where they are used
+	// before their declaration.
+	map<string, string> names;
+	auto rename = [&](string const& _name) -> string const& {
+		auto it = names.find(_name);
+		if (it == names.end())
+			it = names.emplace(_name, "#" + to_string(names.size())).first;
+		return it->second;
+	};
+	for (size_t start = _query.find('|'); start != string::npos; start = _query.find('|', start))
+	{
+		size_t end = _query.find('|', start + 1);
+		if (end == string::npos)
+			break;
+		rename(_query.substr(start + 1, end - start - 1));
+		start = end + 1;
+	}
+
+	string result;
+	result.reserve(_query.size());
+	bool ruleName = false;
+	for (size_t i = 0; i < _query.size();)
+		if (_query[i] == '|')
+		{
+			size_t end = _query.find('|', i + 1);
+			if (end == string::npos)
+				end = _query.size();
+			result += "|" + rename(_query.substr(i + 1, end - i - 1)) + "|";
+			i = end + 1;
+		}
+		else if (isDelimiter(_query[i]))
+			result += _query[i++];
+		else
+		{
+			size_t end = i;
+			while (end < _query.size() && !isDelimiter(_query[end]))
+				++end;
+			string token = _query.substr(i, end - i);
+			if (ruleName || names.count(token))
+				result += rename(token);
+			else
+				result += token;
+			ruleName = token == ":named";
+			i = end;
+		}
+	return result;
+}
+
+string SMTQueryCache::file(string const& _solvers, string const& _query) const
+{
+	h256 key = keccak256(m_salt + '\0' + _solvers + '\0' + canonicalQuery(_query));
+	return (fs::path(m_directory) / (key.hex() + ".json")).string();
+}
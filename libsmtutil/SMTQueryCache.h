@@ -0,0 +1,81 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * On-disk cache for the results of SMT queries.
+ */
+
+#pragma once
+
+#include <libsmtutil/SolverInterface.h>
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace solidity::smtutil
+{
+
+/**
+ * Directory of results of SMT queries, one JSON file per query, named after the hash of
+ * the query and the solvers that answered it.
+ *
+ * Queries are identified by their SMT-LIB2 text after renaming all declared symbols
+ * (see canonicalQuery()), so that queries that only differ in the AST IDs contained
+ * in the names of the variables share an entry.
+ *
+ * The cache is best-effort: Entries that cannot be read or written are treated as missing.
+ * Since the solvers run with fixed resource limits, UNKNOWN results are cached as well,
+ * errors are not.
+ */
+class SMTQueryCache
+{
+public:
+	/// Creates a cache in the directory @a _directory, which is created if it does not exist yet.
+	/// @param _salt is part of the key of every entry and has to identify everything
+	/// apart from the query and the solvers that influences the result, e.g. the resource limits.
+	SMTQueryCache(std::string _directory, std::string _salt);
+
+	std::string const& directory() const { return m_directory; }
+
+	/// @returns the result stored for the SMT-LIB2 query @a _query solved by @a _solvers
+	/// or nullopt if there is none.
+	std::optional<std::pair<CheckResult, std::vector<std::string>>> load(
+		std::string const& _solvers,
+		std::string const& _query
+	) const;
+	/// Stores the result of @a _query unless it is an error.
+	void store(
+		std::string const& _solvers,
+		std::string const& _query,
+		std::pair<CheckResult, std::vector<std::string>> const& _result
+	) const;
+
+	/// @returns @a _query with every symbol that is written between bars (i.e. every declared symbol),
+	/// every other occurrence of it and every rule name replaced by a name that only depends
+	/// on the order of first occurrence.
+	static std::string canonicalQuery(std::string const& _query);
+
+private:
+	std::string file(std::string const& _solvers, std::string const& _query) const;
+
+	std::string m_directory;
+	std::string m_salt;
+};
+
+}
@@ -0,0 +1,108 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsmtutil/SMTSolverPool.h>
+
+#include <libsolutil/CommonData.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::smtutil;
+
+SMTSolverPool::SMTSolverPool(vector<unique_ptr<SolverInterface>> _contexts, size_t _threads):
+	m_contexts(move(_contexts)),
+	m_threads(min(_threads, m_contexts.size()))
+{
+	smtAssert(!m_contexts.empty(), "");
+}
+
+void SMTSolverPool::reset()
+{
+	for (auto const& context: m_contexts)
+		context->reset();
+}
+
+void SMTSolverPool::push()
+{
+	for (auto const& context: m_contexts)
+		context->push();
+}
+
+void SMTSolverPool::pop()
+{
+	for (auto const& context: m_contexts)
+		context->pop();
+}
+
+void SMTSolverPool::declareVariable(string const& _name, SortPointer const& _sort)
+{
+	smtAssert(_sort, "");
+	for (auto const& context: m_contexts)
+		context->declareVariable(_name, _sort);
+}
+
+void SMTSolverPool::addAssertion(Expression const& _expr)
+{
+	for (auto const& context: m_contexts)
+		context->addAssertion(_expr);
+}
+
+pair<CheckResult, vector<string>> SMTSolverPool::check(vector<Expression> const& _expressionsToEvaluate)
+{
+	return m_contexts.front()->check(_expressionsToEvaluate);
+}
+
+vector<future<pair<CheckResult, vector<string>>>> SMTSolverPool::check(vector<Query> const& _queries)
+{
+	vector<promise<pair<CheckResult, vector<string>>>> promises(_queries.size());
+	vector<future<void>> contextsDone;
+	for (size_t contextIndex = 0; contextIndex < m_contexts.size(); ++contextIndex)
+		contextsDone.emplace_back(m_threads.submit([&, contextIndex]() {
+			SolverInterface& context = *m_contexts[contextIndex];
+			for (size_t i = contextIndex; i < _queries.size(); i += m_contexts.size())
+			{
+				context.push();
+				try
+				{
+					context.addAssertion(_queries[i].condition);
+					promises[i].set_value(context.check(_queries[i].expressionsToEvaluate));
+				}
+				catch (...)
+				{
+					promises[i].set_exception(current_exception());
+				}
+				context.pop();
+			}
+		}));
+	for (auto& done: contextsDone)
+		done.get();
+
+	vector<future<pair<CheckResult, vector<string>>>> results;
+	for (auto& result: promises)
+		results.emplace_back(result.get_future());
+	return results;
+}
+
+vector<string> SMTSolverPool::unhandledQueries()
+{
+	vector<string> queries;
+	for (auto const& context: m_contexts)
+		queries += context->unhandledQueries();
+	return queries;
+}
@@ -0,0 +1,87 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <libsmtutil/SolverInterface.h>
+
+#include <libsolutil/ThreadPool.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace solidity::smtutil
+{
+
+/**
+ * Set of independent solver contexts that receive the same declarations and assertions,
+ * so that several queries can be checked concurrently.
+ *
+ * The single-query interface only uses the first context. Batches of queries are
+ * distributed round-robin among the contexts and every context checks its queries
+ * in order, so the results only depend on the number of contexts. The engines always
+ * create numContexts contexts, which are processed on as many threads as allowed.
+ */
+class SMTSolverPool: public SolverInterface, public boost::noncopyable
+{
+public:
+	struct Query
+	{
+		/// Assertion that is added on top of the current assertions for this query only.
+		Expression condition;
+		std::vector<Expression> expressionsToEvaluate;
+	};
+
+	/// Number of contexts the engines create if they solve queries themselves. It does not
+	/// depend on the number of threads, so that the results do not either.
+	static size_t constexpr numContexts = 4;
+
+	/// @param _threads the maximum number of contexts that check queries at the same time.
+	SMTSolverPool(std::vector<std::unique_ptr<SolverInterface>> _contexts, size_t _threads);
+
+	void reset() override;
+
+	void push() override;
+	void pop() override;
+
+	void declareVariable(std::string const& _name, SortPointer const& _sort) override;
+
+	void addAssertion(Expression const& _expr) override;
+
+	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const& _expressionsToEvaluate) override;
+
+	/// Checks all @a _queries, using up to one thread per context.
+	/// @returns the results in the order of the queries. All of them are ready,
+	/// exceptions thrown while checking a query are rethrown by its future.
+	std::vector<std::future<std::pair<CheckResult, std::vector<std::string>>>> check(std::vector<Query> const& _queries);
+
+	/// @returns the unhandled queries of all contexts.
+	std::vector<std::string> unhandledQueries() override;
+	unsigned solvers() override { return m_contexts.front()->solvers(); }
+
+	size_t contexts() const { return m_contexts.size(); }
+
+private:
+	std::vector<std::unique_ptr<SolverInterface>> m_contexts;
+	util::ThreadPool m_threads;
+};
+
+}
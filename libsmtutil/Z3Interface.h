@@ -47,6 +47,8 @@ public:
 
 	z3::context* context() { return &m_context; }
 
+	static std::string version() { return Z3_get_full_version(); }
+
 	// Z3 "basic resources" limit.
 	// This is used to make the runs more deterministic and platform/machine independent.
 	// The tests start failing for Z3 with less than 10000000,
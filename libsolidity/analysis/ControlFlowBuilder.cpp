@@ -380,7 +380,10 @@ bool ControlFlowBuilder::visit(InlineAssembly const& _inlineAssembly)
 void ControlFlowBuilder::visit(yul::Statement const& _statement)
 {
 	solAssert(m_currentNode && m_inlineAssembly, "");
-	m_currentNode->location = langutil::SourceLocation::smallestCovering(m_currentNode->location, locationOf(_statement));
+	m_currentNode->location = langutil::SourceLocation::smallestCovering(
+		m_currentNode->location,
+		locationOf(_statement).toSourceLocation(m_inlineAssembly->dialect().repository)
+	);
 	ASTWalker::visit(_statement);
 }
 
@@ -472,7 +475,7 @@ void ControlFlowBuilder::operator()(yul::Identifier const& _identifier)
 			m_currentNode->variableOccurrences.emplace_back(
 				*declaration,
 				VariableOccurrence::Kind::Access,
-				_identifier.location
+				_identifier.location.toSourceLocation(m_inlineAssembly->dialect().repository)
 			);
 	}
 }
@@ -488,7 +491,7 @@ void ControlFlowBuilder::operator()(yul::Assignment const& _assignment)
 				m_currentNode->variableOccurrences.emplace_back(
 					*declaration,
 					VariableOccurrence::Kind::Assignment,
-					variable.location
+					variable.location.toSourceLocation(m_inlineAssembly->dialect().repository)
 				);
 }
 
@@ -187,8 +187,10 @@ bool ReferencesResolver::visit(InlineAssembly const& _inlineAssembly)
 	m_resolver.warnVariablesNamedLikeInstructions();
 
 	m_yulAnnotation = &_inlineAssembly.annotation();
+	m_yulDialect = &_inlineAssembly.dialect();
 	(*this)(_inlineAssembly.operations());
 	m_yulAnnotation = nullptr;
+	m_yulDialect = nullptr;
 
 	return false;
 }
@@ -229,7 +231,7 @@ void ReferencesResolver::operator()(yul::Identifier const& _identifier)
 		{
 			m_errorReporter.declarationError(
 				4794_error,
-				_identifier.location,
+				sourceLocation(_identifier.location),
 				"In variable names _slot and _offset can only be used as a suffix."
 			);
 			return;
@@ -240,7 +242,7 @@ void ReferencesResolver::operator()(yul::Identifier const& _identifier)
 	{
 		m_errorReporter.declarationError(
 			4718_error,
-			_identifier.location,
+			sourceLocation(_identifier.location),
 			"Multiple matching identifiers. Resolving overloaded identifiers is not supported."
 		);
 		return;
@@ -252,7 +254,7 @@ void ReferencesResolver::operator()(yul::Identifier const& _identifier)
 		{
 			m_errorReporter.declarationError(
 				6578_error,
-				_identifier.location,
+				sourceLocation(_identifier.location),
 				"Cannot access local Solidity variables from inside an inline assembly function."
 			);
 			return;
@@ -274,7 +276,7 @@ void ReferencesResolver::operator()(yul::VariableDeclaration const& _varDecl)
 		if (isSlot || isOffset)
 			m_errorReporter.declarationError(
 				9155_error,
-				identifier.location,
+				sourceLocation(identifier.location),
 				"In variable declarations _slot and _offset can not be used as a suffix."
 			);
 		else if (
@@ -288,7 +290,7 @@ void ReferencesResolver::operator()(yul::VariableDeclaration const& _varDecl)
 			if (!ssl.infos.empty())
 				m_errorReporter.declarationError(
 					3859_error,
-					identifier.location,
+					sourceLocation(identifier.location),
 					ssl,
 					namePrefix.size() < identifier.name.str().size() ?
 					"The prefix of this declaration conflicts with a declaration outside the inline assembly block." :
@@ -301,6 +303,12 @@ void ReferencesResolver::operator()(yul::VariableDeclaration const& _varDecl)
 		visit(*_varDecl.value);
 }
 
+SourceLocation ReferencesResolver::sourceLocation(yul::Location const& _location) const
+{
+	solAssert(m_yulDialect, "");
+	return _location.toSourceLocation(m_yulDialect->repository);
+}
+
 void ReferencesResolver::resolveInheritDoc(StructuredDocumentation const& _documentation, StructurallyDocumentedAnnotation& _annotation)
 {
 	switch (_annotation.docTags.count("inheritdoc"))
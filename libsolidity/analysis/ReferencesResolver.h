@@ -92,6 +92,9 @@ private:
 
 	void resolveInheritDoc(StructuredDocumentation const& _documentation, StructurallyDocumentedAnnotation& _annotation);
 
+	/// @returns @a _location of a node of the inline assembly block that is currently visited.
+	langutil::SourceLocation sourceLocation(yul::Location const& _location) const;
+
 	langutil::ErrorReporter& m_errorReporter;
 	NameAndTypeResolver& m_resolver;
 	langutil::EVMVersion m_evmVersion;
@@ -100,6 +103,7 @@ private:
 	bool const m_resolveInsideCode;
 
 	InlineAssemblyAnnotation* m_yulAnnotation = nullptr;
+	yul::Dialect const* m_yulDialect = nullptr;
 	bool m_yulInsideFunction = false;
 };
 
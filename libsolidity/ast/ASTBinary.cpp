@@ -0,0 +1,379 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Compact binary format of the ASTs of several sources.
+ */
+
+#include <libsolidity/ast/ASTBinary.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::frontend;
+
+namespace
+{
+
+string_view const c_magic{"\0solc-ast", 9};
+
+enum class Tag: uint8_t
+{
+	Null,
+	False,
+	True,
+	Int,
+	UInt,
+	Real,
+	String,
+	Array,
+	Object
+};
+
+class Writer
+{
+public:
+	string encode(map<string, Json::Value> const& _sources)
+	{
+		vector<pair<size_t, size_t>> sources;
+		for (auto const& [name, ast]: _sources)
+		{
+			sources.emplace_back(stringIndex(name), m_trees.size());
+			value(ast);
+		}
+
+		string data{c_magic};
+		data.push_back(static_cast<char>(ASTBinary::version));
+		number(data, m_strings.size());
+		for (string_view entry: m_strings)
+		{
+			number(data, entry.size());
+			data += entry;
+		}
+		number(data, m_nodes.size());
+		for (auto const& [id, offset]: m_nodes)
+		{
+			signedNumber(data, id);
+			number(data, offset);
+		}
+		number(data, sources.size());
+		for (auto const& [name, offset]: sources)
+		{
+			number(data, name);
+			number(data, offset);
+		}
+		number(data, m_trees.size());
+		data += m_trees;
+		return data;
+	}
+
+private:
+	static void number(string& _data, uint64_t _value)
+	{
+		for (; _value >= 0x80; _value >>= 7)
+			_data.push_back(static_cast<char>((_value & 0x7f) | 0x80));
+		_data.push_back(static_cast<char>(_value));
+	}
+
+	static void signedNumber(string& _data, int64_t _value)
+	{
+		number(_data, (static_cast<uint64_t>(_value) << 1) ^ static_cast<uint64_t>(_value >> 63));
+	}
+
+	size_t stringIndex(string_view _string)
+	{
+		auto [it, inserted] = m_stringIndices.emplace(_string, m_strings.size());
+		if (inserted)
+			m_strings.push_back(_string);
+		return it->second;
+	}
+
+	void value(Json::Value const& _value)
+	{
+		switch (_value.type())
+		{
+		case Json::nullValue:
+			tag(Tag::Null);
+			break;
+		case Json::booleanValue:
+			tag(_value.asBool() ? Tag::True : Tag::False);
+			break;
+		case Json::intValue:
+			tag(Tag::Int);
+			signedNumber(m_trees, _value.asInt64());
+			break;
+		case Json::uintValue:
+			tag(Tag::UInt);
+			number(m_trees, _value.asUInt64());
+			break;
+		case Json::realValue:
+		{
+			tag(Tag::Real);
+			double real = _value.asDouble();
+			uint64_t bits;
+			memcpy(&bits, &real, sizeof(bits));
+			for (size_t i = 0; i < sizeof(bits); ++i, bits >>= 8)
+				m_trees.push_back(static_cast<char>(bits & 0xff));
+			break;
+		}
+		case Json::stringValue:
+		{
+			tag(Tag::String);
+			char const* begin = nullptr;
+			char const* end = nullptr;
+			_value.getString(&begin, &end);
+			number(m_trees, stringIndex(string_view(begin, static_cast<size_t>(end - begin))));
+			break;
+		}
+		case Json::arrayValue:
+			tag(Tag::Array);
+			number(m_trees, _value.size());
+			for (auto const& element: _value)
+				value(element);
+			break;
+		case Json::objectValue:
+			if (_value.isMember("id") && _value.isMember("nodeType") && _value["id"].isInt64())
+				m_nodes.emplace_back(_value["id"].asInt64(), m_trees.size());
+			tag(Tag::Object);
+			number(m_trees, _value.size());
+			for (auto it = _value.begin(); it != _value.end(); ++it)
+			{
+				char const* end = nullptr;
+				char const* begin = it.memberName(&end);
+				number(m_trees, stringIndex(string_view(begin, static_cast<size_t>(end - begin))));
+				value(*it);
+			}
+			break;
+		}
+	}
+
+	void tag(Tag _tag)
+	{
+		m_trees.push_back(static_cast<char>(_tag));
+	}
+
+	/// The strings point into the encoded values, which outlive the writer.
+	vector<string_view> m_strings;
+	unordered_map<string_view, size_t> m_stringIndices;
+	vector<pair<int64_t, size_t>> m_nodes;
+	string m_trees;
+};
+
+class Reader
+{
+public:
+	/// Reads the string table and the position of the node index, the sources and the trees.
+	explicit Reader(string const& _data): m_data(_data)
+	{
+		astAssert(ASTBinary::isBinary(m_data), "Not a binary AST.");
+		m_position = c_magic.size();
+		astAssert(byte() == ASTBinary::version, "Unsupported version of the binary AST format.");
+		m_strings.resize(count());
+		for (string_view& entry: m_strings)
+			entry = bytes(count());
+		m_nodeIndex = m_position;
+		for (size_t nodes = count(); nodes > 0; --nodes)
+		{
+			signedNumber();
+			number();
+		}
+		m_sources = m_position;
+		for (size_t sources = count(); sources > 0; --sources)
+		{
+			stringAt(count());
+			number();
+		}
+		size_t size = count();
+		m_trees = m_position;
+		astAssert(m_data.size() - m_trees == size, "Invalid size of the binary AST.");
+	}
+
+	map<string, Json::Value> sources()
+	{
+		map<string, Json::Value> sources;
+		m_position = m_sources;
+		for (size_t remaining = count(); remaining > 0; --remaining)
+		{
+			string name{stringAt(count())};
+			size_t offset = tree(count());
+			size_t position = m_position;
+			m_position = offset;
+			astAssert(sources.emplace(move(name), value()).second, "Duplicate source in the binary AST.");
+			m_position = position;
+		}
+		return sources;
+	}
+
+	optional<Json::Value> node(int64_t _id)
+	{
+		m_position = m_nodeIndex;
+		for (size_t remaining = count(); remaining > 0; --remaining)
+		{
+			int64_t id = signedNumber();
+			size_t offset = tree(count());
+			if (id == _id)
+			{
+				m_position = offset;
+				return value();
+			}
+		}
+		return nullopt;
+	}
+
+private:
+	Json::Value value()
+	{
+		switch (static_cast<Tag>(byte()))
+		{
+		case Tag::Null:
+			return Json::nullValue;
+		case Tag::False:
+			return false;
+		case Tag::True:
+			return true;
+		case Tag::Int:
+			return Json::Int64(signedNumber());
+		case Tag::UInt:
+			return Json::UInt64(number());
+		case Tag::Real:
+		{
+			uint64_t bits = 0;
+			for (size_t i = 0; i < sizeof(bits); ++i)
+				bits |= uint64_t(byte()) << (8 * i);
+			double real;
+			memcpy(&real, &bits, sizeof(real));
+			return real;
+		}
+		case Tag::String:
+		{
+			string_view text = stringAt(count());
+			return Json::Value(text.data(), text.data() + text.size());
+		}
+		case Tag::Array:
+		{
+			Json::Value array{Json::arrayValue};
+			size_t size = count();
+			// Each element takes at least one byte.
+			astAssert(size <= m_data.size() - m_position, "Invalid size of an array in the binary AST.");
+			array.resize(static_cast<Json::ArrayIndex>(size));
+			for (Json::ArrayIndex i = 0; i < size; ++i)
+				array[i] = value();
+			return array;
+		}
+		case Tag::Object:
+		{
+			Json::Value object{Json::objectValue};
+			for (size_t size = count(); size > 0; --size)
+			{
+				string_view key = stringAt(count());
+				*object.demand(key.data(), key.data() + key.size()) = value();
+			}
+			return object;
+		}
+		}
+		astAssert(false, "Invalid tag in the binary AST.");
+		return {};
+	}
+
+	uint8_t byte()
+	{
+		astAssert(m_position < m_data.size(), "Unexpected end of the binary AST.");
+		return static_cast<uint8_t>(m_data[m_position++]);
+	}
+
+	uint64_t number()
+	{
+		uint64_t result = 0;
+		for (unsigned shift = 0; ; shift += 7)
+		{
+			astAssert(shift < 64, "Invalid number in the binary AST.");
+			uint8_t next = byte();
+			result |= uint64_t(next & 0x7f) << shift;
+			if (!(next & 0x80))
+				return result;
+		}
+	}
+
+	int64_t signedNumber()
+	{
+		uint64_t zigzag = number();
+		return static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+	}
+
+	/// @returns a number that is used as size or index.
+	size_t count()
+	{
+		uint64_t result = number();
+		astAssert(result <= m_data.size(), "Invalid size or index in the binary AST.");
+		return static_cast<size_t>(result);
+	}
+
+	string_view bytes(size_t _size)
+	{
+		astAssert(_size <= m_data.size() - m_position, "Unexpected end of the binary AST.");
+		string_view result(m_data.data() + m_position, _size);
+		m_position += _size;
+		return result;
+	}
+
+	string_view stringAt(size_t _index) const
+	{
+		astAssert(_index < m_strings.size(), "Invalid string index in the binary AST.");
+		return m_strings[_index];
+	}
+
+	size_t tree(size_t _offset) const
+	{
+		astAssert(_offset < m_data.size() - m_trees, "Invalid offset in the binary AST.");
+		return m_trees + _offset;
+	}
+
+	string const& m_data;
+	size_t m_position = 0;
+	vector<string_view> m_strings;
+	size_t m_nodeIndex = 0;
+	size_t m_sources = 0;
+	size_t m_trees = 0;
+};
+
+}
+
+bool ASTBinary::isBinary(string const& _data)
+{
+	return string_view(_data).substr(0, c_magic.size()) == c_magic;
+}
+
+string ASTBinary::encode(map<string, Json::Value> const& _sources)
+{
+	return Writer{}.encode(_sources);
+}
+
+map<string, Json::Value> ASTBinary::decode(string const& _data)
+{
+	return Reader{_data}.sources();
+}
+
+optional<Json::Value> ASTBinary::decodeNode(string const& _data, int64_t _id)
+{
+	return Reader{_data}.node(_id);
+}
@@ -0,0 +1,75 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Compact binary format of the ASTs of several sources.
+ */
+
+#pragma once
+
+#include <json/json.h>
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace solidity::frontend
+{
+
+/**
+ * Binary encoding of the compact JSON ASTs (as produced by ASTJsonConverter) of several
+ * sources, which can be imported again through ASTJsonImporter.
+ *
+ * The encoding is lossless: decoding yields JSON values that are equal to the encoded ones,
+ * including the distinction between signed and unsigned integers.
+ *
+ * Layout, where all numbers are unsigned LEB128 and all signed numbers are zigzag-encoded:
+ *  - the magic bytes "\0solc-ast" followed by a single byte for the format version,
+ *  - the string table: the number of strings, followed by the length and bytes of each.
+ *    Every object key, string value and source name is stored once and referred to by index,
+ *  - the node index: the number of nodes, followed by the id of each node and the offset
+ *    of its object in the trees,
+ *  - the sources: the number of sources, followed by the name and the offset of the tree of each,
+ *  - the size of the trees, followed by the trees. A value consists of a tag byte and a payload:
+ *    nothing for null, false and true, a number for integers, the eight bytes of the IEEE 754
+ *    representation in little endian order for reals, the index in the string table for strings,
+ *    the number of elements and the elements for arrays and the number of members and pairs
+ *    of key index and value for objects.
+ */
+class ASTBinary
+{
+public:
+	static uint8_t constexpr version = 1;
+
+	/// @returns true if @a _data starts with the magic bytes of the binary format.
+	static bool isBinary(std::string const& _data);
+
+	/// @returns the binary encoding of the compact JSON ASTs of the sources in @a _sources.
+	static std::string encode(std::map<std::string, Json::Value> const& _sources);
+
+	/// @returns the compact JSON ASTs of the sources encoded in @a _data.
+	/// Throws InvalidAstError if @a _data is not in the binary format of this version.
+	static std::map<std::string, Json::Value> decode(std::string const& _data);
+
+	/// Uses the node index to decode only the node with id @a _id and its children.
+	/// @returns nullopt if there is no such node.
+	/// Throws InvalidAstError if @a _data is not in the binary format of this version.
+	static std::optional<Json::Value> decodeNode(std::string const& _data, int64_t _id);
+};
+
+}
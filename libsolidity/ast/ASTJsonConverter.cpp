@@ -190,10 +190,13 @@ void ASTJsonConverter::appendExpressionAttributes(
 	_attributes += exprAttributes;
 }
 
-Json::Value ASTJsonConverter::inlineAssemblyIdentifierToJson(pair<yul::Identifier const* ,InlineAssemblyAnnotation::ExternalIdentifierInfo> _info) const
+Json::Value ASTJsonConverter::inlineAssemblyIdentifierToJson(
+	pair<yul::Identifier const* ,InlineAssemblyAnnotation::ExternalIdentifierInfo> _info,
+	yul::YulStringRepository const& _repository
+) const
 {
 	Json::Value tuple(Json::objectValue);
-	tuple["src"] = sourceLocationToString(_info.first->location);
+	tuple["src"] = sourceLocationToString(_info.first->location.toSourceLocation(_repository));
 	tuple["declaration"] = idOrNull(_info.second.declaration);
 	tuple["isSlot"] = Json::Value(_info.second.isSlot);
 	tuple["isOffset"] = Json::Value(_info.second.isOffset);
@@ -506,7 +509,7 @@ bool ASTJsonConverter::visit(InlineAssembly const& _node)
 		if (it.first)
 			externalReferences.emplace_back(make_pair(
 				it.first->name.str(),
-				inlineAssemblyIdentifierToJson(it)
+				inlineAssemblyIdentifierToJson(it, _node.dialect().repository)
 			));
 
 	Json::Value externalReferencesJson = Json::arrayValue;
@@ -40,6 +40,11 @@ namespace solidity::langutil
 struct SourceLocation;
 }
 
+namespace solidity::yul
+{
+class YulStringRepository;
+}
+
 namespace solidity::frontend
 {
 
@@ -146,7 +151,10 @@ private:
 	{
 		return _node ? toJson(*_node) : Json::nullValue;
 	}
-	Json::Value inlineAssemblyIdentifierToJson(std::pair<yul::Identifier const* , InlineAssemblyAnnotation::ExternalIdentifierInfo> _info) const;
+	Json::Value inlineAssemblyIdentifierToJson(
+		std::pair<yul::Identifier const* , InlineAssemblyAnnotation::ExternalIdentifierInfo> _info,
+		yul::YulStringRepository const& _repository
+	) const;
 	static std::string location(VariableDeclaration::Location _location);
 	static std::string contractKind(ContractKind _kind);
 	static std::string functionCallKind(FunctionCallKind _kind);
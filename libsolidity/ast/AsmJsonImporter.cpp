@@ -47,16 +47,18 @@ SourceLocation const AsmJsonImporter::createSourceLocation(Json::Value const& _n
 {
 	astAssert(member(_node, "src").isString(), "'src' must be a string");
 
-	return solidity::langutil::parseSourceLocation(_node["src"].asString(), m_sourceName);
+	SourceLocation location = solidity::langutil::parseSourceLocation(_node["src"].asString(), m_sourceName);
+	location.source = m_source;
+	return location;
 }
 
 template <class T>
 T AsmJsonImporter::createAsmNode(Json::Value const& _node)
 {
 	T r;
-	r.location = createSourceLocation(_node);
+	r.location = yul::Location{createSourceLocation(_node), m_repository};
 	astAssert(
-		r.location.source && 0 <= r.location.start && r.location.start <= r.location.end,
+		r.location.sourceIndex && 0 <= r.location.start && r.location.start <= r.location.end,
 		"Invalid source location in Asm AST"
 	);
 	return r;
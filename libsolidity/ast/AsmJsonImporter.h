@@ -29,6 +29,11 @@
 
 #include <utility>
 
+namespace solidity::yul
+{
+class YulStringRepository;
+}
+
 namespace solidity::frontend
 {
 
@@ -38,7 +43,12 @@ namespace solidity::frontend
 class AsmJsonImporter
 {
 public:
-	explicit AsmJsonImporter(std::string _sourceName) : m_sourceName(std::move(_sourceName)) {}
+	/// @param _repository the repository of the dialect the imported code is used with.
+	AsmJsonImporter(std::string _sourceName, yul::YulStringRepository& _repository):
+		m_sourceName(std::move(_sourceName)),
+		m_source(std::make_shared<langutil::CharStream>("", m_sourceName)),
+		m_repository(_repository)
+	{}
 	yul::Block createBlock(Json::Value const& _node);
 
 private:
@@ -71,7 +81,9 @@ private:
 	yul::Continue createContinue(Json::Value const& _node);
 
 	std::string m_sourceName;
-
+	/// Source shared by all imported locations, so that the Yul AST refers to a single source.
+	std::shared_ptr<langutil::CharStream> m_source;
+	yul::YulStringRepository& m_repository;
 };
 
 }
@@ -42,13 +42,24 @@ public:
 		m_context(_evmVersion, _revertStrings, &m_runtimeContext)
 	{ }
 
-	/// Compiles a contract.
+	/// Sets the on-disk cache used for optimised Yul code generated by the code generator.
+	void setCompilationCache(CompilationCache const* _cache)
+	{
+		m_runtimeContext.setCompilationCache(_cache);
+		m_context.setCompilationCache(_cache);
+	}
+
+	/// Compiles a contract. The resulting assembly is not optimised, call optimise() for that.
 	/// @arg _metadata contains the to be injected metadata CBOR
 	void compileContract(
 		ContractDefinition const& _contract,
 		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> const& _otherCompilers,
 		bytes const& _metadata
 	);
+	/// Runs the assembly optimiser on the compiled contract. This also re-optimises
+	/// the assemblies of the contracts it creates, since they are embedded as sub-assemblies.
+	/// Independent parts of the assembly are optimised concurrently on @a _threads threads.
+	void optimise(size_t _threads = 1);
 	/// @returns Entire assembly.
 	evmasm::Assembly const& assembly() const { return m_context.assembly(); }
 	/// @returns Entire assembly as a shared pointer to non-const.
@@ -26,6 +26,7 @@
 #include <libsolidity/ast/AST.h>
 #include <libsolidity/codegen/Compiler.h>
 #include <libsolidity/codegen/CompilerUtils.h>
+#include <libsolidity/interface/CompilationCache.h>
 #include <libsolidity/interface/Version.h>
 
 #include <libyul/AsmParser.h>
@@ -34,10 +35,13 @@
 #include <libyul/backends/evm/AsmCodeGen.h>
 #include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/backends/evm/EVMMetrics.h>
+#include <libyul/optimiser/OptimisedCodeCache.h>
 #include <libyul/optimiser/Suite.h>
 #include <libyul/Object.h>
 #include <libyul/YulString.h>
 
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
 #include <libsolutil/Whiskers.h>
 
 #include <liblangutil/ErrorReporter.h>
@@ -373,6 +377,7 @@ void CompilerContext::appendInlineAssembly(
 )
 {
 	unsigned startStackHeight = stackHeight();
+	yul::EVMDialect const& dialect = yul::EVMDialect::strictAssemblyForEVM(m_evmVersion);
 
 	set<yul::YulString> externallyUsedIdentifiers;
 	for (auto const& fun: _externallyUsedFunctions)
@@ -406,7 +411,7 @@ void CompilerContext::appendInlineAssembly(
 		if (stackDiff < 1 || stackDiff > 16)
 			BOOST_THROW_EXCEPTION(
 				StackTooDeepError() <<
-				errinfo_sourceLocation(_identifier.location) <<
+				errinfo_sourceLocation(_identifier.location.toSourceLocation(dialect.repository)) <<
 				util::errinfo_comment("Stack too deep (" + to_string(stackDiff) + "), try removing local variables.")
 			);
 		if (_context == yul::IdentifierContext::RValue)
@@ -421,7 +426,6 @@ void CompilerContext::appendInlineAssembly(
 	ErrorList errors;
 	ErrorReporter errorReporter(errors);
 	auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(_assembly, "--CODEGEN--"));
-	yul::EVMDialect const& dialect = yul::EVMDialect::strictAssemblyForEVM(m_evmVersion);
 	optional<langutil::SourceLocation> locationOverride;
 	if (!_system)
 		locationOverride = m_asm->currentSourceLocation();
@@ -467,7 +471,10 @@ void CompilerContext::appendInlineAssembly(
 		obj.code = parserResult;
 		obj.analysisInfo = make_shared<yul::AsmAnalysisInfo>(analysisInfo);
 
-		optimizeYul(obj, dialect, _optimiserSettings, externallyUsedIdentifiers);
+		if (_system)
+			optimizeGeneratedYul(obj, _assembly, dialect, _optimiserSettings, externallyUsedIdentifiers);
+		else
+			optimizeYul(obj, dialect, _optimiserSettings, externallyUsedIdentifiers);
 
 		analysisInfo = std::move(*obj.analysisInfo);
 		parserResult = std::move(obj.code);
@@ -511,7 +518,8 @@ void CompilerContext::optimizeYul(yul::Object& _object, yul::EVMDialect const& _
 		_object,
 		_optimiserSettings.optimizeStackAllocation,
 		_optimiserSettings.yulOptimiserSteps,
-		_externalIdentifiers
+		_externalIdentifiers,
+		_optimiserSettings.gasProfile.get()
 	);
 
 #ifdef SOL_OUTPUT_ASM
@@ -520,6 +528,62 @@ void CompilerContext::optimizeYul(yul::Object& _object, yul::EVMDialect const& _
 #endif
 }
 
+void CompilerContext::optimizeGeneratedYul(
+	yul::Object& _object,
+	string const& _code,
+	yul::EVMDialect const& _dialect,
+	OptimiserSettings const& _optimiserSettings,
+	set<yul::YulString> const& _externalIdentifiers
+)
+{
+	Json::Value input{Json::objectValue};
+	input["version"] = VersionString;
+	input["code"] = _code;
+	input["evmVersion"] = m_evmVersion.name();
+	input["creation"] = runtimeContext() != nullptr;
+	input["runs"] = Json::UInt64(_optimiserSettings.expectedExecutionsPerDeployment);
+	input["optimizeStackAllocation"] = _optimiserSettings.optimizeStackAllocation;
+	input["steps"] = _optimiserSettings.yulOptimiserSteps;
+	if (_optimiserSettings.gasProfile)
+		input["gasProfile"] = _optimiserSettings.gasProfile->hash().hex();
+	set<string> externalIdentifiers;
+	for (yul::YulString identifier: _externalIdentifiers)
+		externalIdentifiers.insert(identifier.str());
+	input["externalIdentifiers"] = Json::arrayValue;
+	for (string const& identifier: externalIdentifiers)
+		input["externalIdentifiers"].append(identifier);
+	h256 key = keccak256(jsonCompactPrint(input));
+
+	// All locations of generated code refer to the code itself.
+	unsigned sourceIndex = _object.code->location.sourceIndex;
+	yul::OptimisedCodeCache& cache = yul::OptimisedCodeCache::global();
+	optional<Json::Value> entry = cache.load(key);
+	bool fromDisk = false;
+	if (!entry && m_compilationCache)
+	{
+		entry = m_compilationCache->load(key);
+		fromDisk = entry.has_value();
+	}
+	if (entry)
+		if (shared_ptr<yul::Block> code = yul::OptimisedCodeCache::decode(*entry, _dialect, sourceIndex))
+		{
+			_object.code = move(code);
+			*_object.analysisInfo = yul::AsmAnalyzer::analyzeStrictAssertCorrect(_dialect, _object);
+			if (fromDisk)
+				cache.store(key, move(*entry));
+			return;
+		}
+
+	optimizeYul(_object, _dialect, _optimiserSettings, _externalIdentifiers);
+
+	if (optional<Json::Value> newEntry = yul::OptimisedCodeCache::encode(*_object.code, sourceIndex))
+	{
+		if (m_compilationCache)
+			m_compilationCache->store(key, *newEntry);
+		cache.store(key, move(*newEntry));
+	}
+}
+
 LinkerObject const& CompilerContext::assembledObject() const
 {
 	LinkerObject const& object = m_asm->assemble();
@@ -537,18 +601,24 @@ void CompilerContext::updateSourceLocation()
 	m_asm->setSourceLocation(m_visitedNodes.empty() ? SourceLocation() : m_visitedNodes.top()->location());
 }
 
-evmasm::Assembly::OptimiserSettings CompilerContext::translateOptimiserSettings(OptimiserSettings const& _settings)
+evmasm::Assembly::OptimiserSettings CompilerContext::translateOptimiserSettings(
+	OptimiserSettings const& _settings,
+	size_t _threads
+)
 {
 	// Constructing it this way so that we notice changes in the fields.
-	evmasm::Assembly::OptimiserSettings asmSettings{false, false, false, false, false, false, m_evmVersion, 0};
+	evmasm::Assembly::OptimiserSettings asmSettings{false, false, false, false, false, false, false, m_evmVersion, 0, nullptr, 1};
 	asmSettings.isCreation = true;
 	asmSettings.runJumpdestRemover = _settings.runJumpdestRemover;
 	asmSettings.runPeephole = _settings.runPeephole;
 	asmSettings.runDeduplicate = _settings.runDeduplicate;
 	asmSettings.runCSE = _settings.runCSE;
 	asmSettings.runConstantOptimiser = _settings.runConstantOptimiser;
+	asmSettings.runSuperoptimiser = _settings.runSuperoptimiser;
 	asmSettings.expectedExecutionsPerDeployment = _settings.expectedExecutionsPerDeployment;
+	asmSettings.gasProfile = _settings.gasProfile;
 	asmSettings.evmVersion = m_evmVersion;
+	asmSettings.threads = _threads;
 	return asmSettings;
 }
 
@@ -49,6 +49,7 @@
 namespace solidity::frontend {
 
 class Compiler;
+class CompilationCache;
 
 /**
  * Context to be shared by all units that compile the same contract.
@@ -266,11 +267,18 @@ public:
 
 	void optimizeYul(yul::Object& _object, yul::EVMDialect const& _dialect, OptimiserSettings const& _optimiserSetting, std::set<yul::YulString> const& _externalIdentifiers = {});
 
+	/// Sets the on-disk cache that is used in addition to the in-memory cache of optimised
+	/// Yul code generated by the code generator.
+	void setCompilationCache(CompilationCache const* _cache) { m_compilationCache = _cache; }
+
 	/// Appends arbitrary data to the end of the bytecode.
 	void appendAuxiliaryData(bytes const& _data) { m_asm->appendAuxiliaryDataToEnd(_data); }
 
-	/// Run optimisation step.
-	void optimise(OptimiserSettings const& _settings) { m_asm->optimise(translateOptimiserSettings(_settings)); }
+	/// Run optimisation step, using @a _threads threads.
+	void optimise(OptimiserSettings const& _settings, size_t _threads = 1)
+	{
+		m_asm->optimise(translateOptimiserSettings(_settings, _threads));
+	}
 
 	/// @returns the runtime context if in creation mode and runtime context is set, nullptr otherwise.
 	CompilerContext* runtimeContext() const { return m_runtimeContext; }
@@ -313,10 +321,21 @@ public:
 	RevertStrings revertStrings() const { return m_revertStrings; }
 
 private:
+	/// Optimises @a _object, which was parsed from the code @a _code generated by the code generator.
+	/// The same code is generated for many contracts, so the result is taken from and stored in
+	/// the cache of optimised code.
+	void optimizeGeneratedYul(
+		yul::Object& _object,
+		std::string const& _code,
+		yul::EVMDialect const& _dialect,
+		OptimiserSettings const& _optimiserSettings,
+		std::set<yul::YulString> const& _externalIdentifiers
+	);
+
 	/// Updates source location set in the assembly.
 	void updateSourceLocation();
 
-	evmasm::Assembly::OptimiserSettings translateOptimiserSettings(OptimiserSettings const& _settings);
+	evmasm::Assembly::OptimiserSettings translateOptimiserSettings(OptimiserSettings const& _settings, size_t _threads);
 
 	/**
 	 * Helper class that manages function labels and ensures that referenced functions are
@@ -393,6 +412,8 @@ private:
 	std::queue<std::tuple<std::string, unsigned, unsigned, std::function<void(CompilerContext&)>>> m_lowLevelFunctionGenerationQueue;
 	/// Flag to check that requestedYulFunctions() was called exactly once
 	bool m_requestedYulFunctionsRan = false;
+	/// On-disk cache of optimised Yul code, if any.
+	CompilationCache const* m_compilationCache = nullptr;
 };
 
 }
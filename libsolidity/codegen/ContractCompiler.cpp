@@ -306,66 +306,29 @@ void ContractCompiler::appendDelegatecallCheck()
 
 void ContractCompiler::appendInternalSelector(
 	map<FixedHash<4>, evmasm::AssemblyItem const> const& _entryPoints,
-	vector<FixedHash<4>> const& _ids,
-	evmasm::AssemblyItem const& _notFoundTag,
-	size_t _runs
+	SelectorSearchTree const& _tree,
+	evmasm::AssemblyItem const& _notFoundTag
 )
 {
-	// Code for selecting from n functions without split:
-	//   n times: dup1, push4 <id_i>, eq, push2/3 <tag_i>, jumpi
-	//   push2/3 <notfound> jump
-	// (called SELECT[n])
-	// Code for selecting from n functions with split:
-	//   dup1, push4 <pivot>, gt, push2/3<tag_less>, jumpi
-	//     SELECT[n/2]
-	//   tag_less:
-	//     SELECT[n/2]
-	//
-	// This means each split adds 16-18 bytes of additional code (note the additional jump out!)
-	// The average execution cost if we do not split at all are:
-	//   (3 + 3 + 3 + 3 + 10) * n/2 = 24 * n/2 = 12 * n
-	// If we split once:
-	//    (3 + 3 + 3 + 3 + 10) + 24 * n/4 = 24 * (n/4 + 1) = 6 * n + 24;
-	//
-	// We should split if
-	//     _runs * 12 * n > _runs * (6 * n + 24) + 17 * createDataGas
-	// <=> _runs * 6 * (n - 4) > 17 * createDataGas
-	//
-	// Which also means that the execution itself is not profitable
-	// unless we have at least 5 functions.
-
-	// Start with some comparisons to avoid overflow, then do the actual comparison.
-	bool split = false;
-	if (_ids.size() <= 4)
-		split = false;
-	else if (_runs > (17 * evmasm::GasCosts::createDataGas) / 6)
-		split = true;
-	else
-		split = (_runs * 6 * (_ids.size() - 4) > 17 * evmasm::GasCosts::createDataGas);
-
-	if (split)
-	{
-		size_t pivotIndex = _ids.size() / 2;
-		FixedHash<4> pivot{_ids.at(pivotIndex)};
-		m_context << dupInstruction(1) << u256(FixedHash<4>::Arith(pivot)) << Instruction::GT;
-		evmasm::AssemblyItem lessTag{m_context.appendConditionalJump()};
-		// Here, we have funid >= pivot
-		vector<FixedHash<4>> larger{_ids.begin() + static_cast<ptrdiff_t>(pivotIndex), _ids.end()};
-		appendInternalSelector(_entryPoints, larger, _notFoundTag, _runs);
-		m_context << lessTag;
-		// Here, we have funid < pivot
-		vector<FixedHash<4>> smaller{_ids.begin(), _ids.begin() + static_cast<ptrdiff_t>(pivotIndex)};
-		appendInternalSelector(_entryPoints, smaller, _notFoundTag, _runs);
-	}
-	else
+	if (_tree.isLeaf())
 	{
-		for (auto const& id: _ids)
+		for (auto const& id: _tree.selectors())
 		{
 			m_context << dupInstruction(1) << u256(FixedHash<4>::Arith(id)) << Instruction::EQ;
 			m_context.appendConditionalJumpTo(_entryPoints.at(id));
 		}
 		m_context.appendJumpTo(_notFoundTag);
 	}
+	else
+	{
+		m_context << dupInstruction(1) << u256(FixedHash<4>::Arith(_tree.pivot())) << Instruction::GT;
+		evmasm::AssemblyItem lessTag{m_context.appendConditionalJump()};
+		// Here, we have funid >= pivot
+		appendInternalSelector(_entryPoints, _tree.upper(), _notFoundTag);
+		m_context << lessTag;
+		// Here, we have funid < pivot
+		appendInternalSelector(_entryPoints, _tree.lower(), _notFoundTag);
+	}
 }
 
 namespace
@@ -436,7 +399,12 @@ void ContractCompiler::appendFunctionSelector(ContractDefinition const& _contrac
 			sortedIDs.emplace_back(it.first);
 		}
 		std::sort(sortedIDs.begin(), sortedIDs.end());
-		appendInternalSelector(callDataUnpackerEntryPoints, sortedIDs, notFound, m_optimiserSettings.expectedExecutionsPerDeployment);
+		SelectorSearchTree tree(
+			move(sortedIDs),
+			m_optimiserSettings.expectedExecutionsPerDeployment,
+			SelectorSearchTree::executions(interfaceFunctions, m_optimiserSettings.gasProfile.get())
+		);
+		appendInternalSelector(callDataUnpackerEntryPoints, tree, notFound);
 	}
 
 	m_context << notFoundOrReceiveEther;
@@ -25,6 +25,7 @@
 
 #include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/codegen/CompilerContext.h>
+#include <libsolidity/codegen/SelectorSearchTree.h>
 #include <libsolidity/interface/DebugSettings.h>
 #include <libevmasm/Assembly.h>
 #include <functional>
@@ -87,13 +88,11 @@ private:
 	/// This is done by inserting a specific push constant as the first instruction
 	/// whose data will be modified in memory at deploy time.
 	void appendDelegatecallCheck();
-	/// Appends the function selector. Is called recursively to create a binary search tree.
-	/// @a _runs the number of intended executions of the contract to tune the split point.
+	/// Appends the function selector. Is called recursively for the nodes of @a _tree.
 	void appendInternalSelector(
 		std::map<util::FixedHash<4>, evmasm::AssemblyItem const> const& _entryPoints,
-		std::vector<util::FixedHash<4>> const& _ids,
-		evmasm::AssemblyItem const& _notFoundTag,
-		size_t _runs
+		SelectorSearchTree const& _tree,
+		evmasm::AssemblyItem const& _notFoundTag
 	);
 	void appendFunctionSelector(ContractDefinition const& _contract);
 	void appendCallValueCheck();
@@ -0,0 +1,178 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/codegen/SelectorSearchTree.h>
+
+#include <libsolidity/ast/AST.h>
+
+#include <libevmasm/GasMeter.h>
+#include <libevmasm/GasProfile.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::frontend;
+using namespace solidity::util;
+
+namespace
+{
+
+/// Gas of comparing the selector with a constant and jumping on the result:
+/// dup1, push4 <id>, eq / gt, push2/3 <tag>, jumpi
+size_t const c_comparisonGas = 3 + 3 + 3 + 3 + 10;
+/// Bytes of code added by a split, including the additional jump out of the lower half.
+size_t const c_splitBytes = 17;
+
+/// @returns the executions of the selectors in @a _begin to @a _end times the number of
+/// comparisons until they are found, if they are compared in descending order of executions.
+bigint linearSearchComparisons(
+	vector<FixedHash<4>>::const_iterator _begin,
+	vector<FixedHash<4>>::const_iterator _end,
+	map<FixedHash<4>, size_t> const& _weights
+)
+{
+	vector<size_t> weights;
+	for (auto it = _begin; it != _end; ++it)
+		weights.push_back(_weights.at(*it));
+	sort(weights.begin(), weights.end(), greater<size_t>());
+	bigint comparisons = 0;
+	for (size_t i = 0; i < weights.size(); ++i)
+		comparisons += bigint(weights[i]) * (i + 1);
+	return comparisons;
+}
+
+}
+
+SelectorSearchTree::SelectorSearchTree(
+	vector<FixedHash<4>> _selectors,
+	size_t _runs,
+	map<FixedHash<4>, size_t> const& _executions
+):
+	m_selectors(move(_selectors))
+{
+	solAssert(is_sorted(m_selectors.begin(), m_selectors.end()), "");
+	map<FixedHash<4>, size_t> weights;
+	if (!_executions.empty())
+		for (auto const& selector: m_selectors)
+			weights[selector] = _executions.count(selector) ?
+				_executions.at(selector) :
+				_runs / m_selectors.size();
+	build(_runs, weights);
+}
+
+map<FixedHash<4>, size_t> SelectorSearchTree::executions(
+	map<FixedHash<4>, FunctionTypePointer> const& _interfaceFunctions,
+	evmasm::GasProfile const* _profile
+)
+{
+	map<FixedHash<4>, size_t> executions;
+	if (_profile)
+		for (auto const& [selector, function]: _interfaceFunctions)
+			if (auto count = _profile->executions(function->declaration().location()))
+				executions[selector] = *count;
+	return executions;
+}
+
+void SelectorSearchTree::build(size_t _runs, map<FixedHash<4>, size_t> const& _weights)
+{
+	size_t pivotIndex = 0;
+	if (_weights.empty())
+	{
+		// Code for selecting from n functions without split:
+		//   n times: dup1, push4 <id_i>, eq, push2/3 <tag_i>, jumpi
+		//   push2/3 <notfound> jump
+		// (called SELECT[n])
+		// Code for selecting from n functions with split:
+		//   dup1, push4 <pivot>, gt, push2/3<tag_less>, jumpi
+		//     SELECT[n/2]
+		//   tag_less:
+		//     SELECT[n/2]
+		//
+		// This means each split adds 16-18 bytes of additional code (note the additional jump out!)
+		// The average execution cost if we do not split at all are:
+		//   (3 + 3 + 3 + 3 + 10) * n/2 = 24 * n/2 = 12 * n
+		// If we split once:
+		//    (3 + 3 + 3 + 3 + 10) + 24 * n/4 = 24 * (n/4 + 1) = 6 * n + 24;
+		//
+		// We should split if
+		//     _runs * 12 * n > _runs * (6 * n + 24) + 17 * createDataGas
+		// <=> _runs * 6 * (n - 4) > 17 * createDataGas
+		//
+		// Which also means that the execution itself is not profitable
+		// unless we have at least 5 functions.
+
+		// Start with some comparisons to avoid overflow, then do the actual comparison.
+		bool split = false;
+		if (m_selectors.size() <= 4)
+			split = false;
+		else if (_runs > (17 * evmasm::GasCosts::createDataGas) / 6)
+			split = true;
+		else
+			split = (_runs * 6 * (m_selectors.size() - 4) > 17 * evmasm::GasCosts::createDataGas);
+		if (split)
+			pivotIndex = m_selectors.size() / 2;
+	}
+	else if (m_selectors.size() >= 2)
+	{
+		// Split where the executions of both halves are closest to each other and only
+		// if the saved comparisons outweigh the additional code.
+		bigint total = 0;
+		for (auto const& selector: m_selectors)
+			total += _weights.at(selector);
+		bigint lowerExecutions = 0;
+		bigint bestDifference = -1;
+		size_t candidate = 0;
+		for (size_t i = 1; i < m_selectors.size(); ++i)
+		{
+			lowerExecutions += _weights.at(m_selectors[i - 1]);
+			bigint difference = abs(2 * lowerExecutions - total);
+			if (bestDifference < 0 || difference < bestDifference)
+			{
+				bestDifference = difference;
+				candidate = i;
+			}
+		}
+		auto middle = m_selectors.begin() + static_cast<ptrdiff_t>(candidate);
+		bigint linearCost = c_comparisonGas * linearSearchComparisons(m_selectors.begin(), m_selectors.end(), _weights);
+		bigint splitCost = c_comparisonGas * (
+			total +
+			linearSearchComparisons(m_selectors.begin(), middle, _weights) +
+			linearSearchComparisons(middle, m_selectors.end(), _weights)
+		);
+		if (linearCost - splitCost > c_splitBytes * evmasm::GasCosts::createDataGas)
+			pivotIndex = candidate;
+	}
+
+	if (pivotIndex > 0)
+	{
+		auto middle = m_selectors.begin() + static_cast<ptrdiff_t>(pivotIndex);
+		m_pivot = *middle;
+		m_lower.reset(new SelectorSearchTree({m_selectors.begin(), middle}));
+		m_upper.reset(new SelectorSearchTree({middle, m_selectors.end()}));
+		m_selectors.clear();
+		m_lower->build(_runs, _weights);
+		m_upper->build(_runs, _weights);
+	}
+	else if (!_weights.empty())
+		stable_sort(m_selectors.begin(), m_selectors.end(), [&](auto const& _a, auto const& _b) {
+			return _weights.at(_a) > _weights.at(_b);
+		});
+}
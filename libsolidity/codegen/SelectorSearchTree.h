@@ -0,0 +1,90 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Search tree over the function selectors of a contract used by the function dispatch.
+ */
+#pragma once
+
+#include <libsolidity/ast/Types.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace solidity::evmasm
+{
+class GasProfile;
+}
+
+namespace solidity::frontend
+{
+
+/**
+ * Search tree over the four-byte function selectors of a contract, shared by the legacy and the
+ * IR code generator. Inner nodes compare the selector with a pivot, leaves compare it with each
+ * of their selectors in turn.
+ *
+ * Without execution counts, a node is split in half if the comparisons saved during the expected
+ * number of runs outweigh the cost of the additional code. With execution counts of the functions,
+ * e.g. from a gas profile, the split points balance the executions instead of the number of
+ * functions and the leaves compare the selectors of the most frequently called functions first.
+ */
+class SelectorSearchTree
+{
+public:
+	/// @param _selectors the sorted selectors of all functions.
+	/// @param _runs the number of intended executions of the contract.
+	/// @param _executions the execution counts of the functions. Functions without a count get an
+	/// equal share of @a _runs. If empty, the tree is balanced by the number of functions.
+	SelectorSearchTree(
+		std::vector<util::FixedHash<4>> _selectors,
+		size_t _runs,
+		std::map<util::FixedHash<4>, size_t> const& _executions = {}
+	);
+
+	/// @returns the execution counts of the innermost ranges of @a _profile that contain the
+	/// declarations of @a _interfaceFunctions. Empty if there is no profile.
+	static std::map<util::FixedHash<4>, size_t> executions(
+		std::map<util::FixedHash<4>, FunctionTypePointer> const& _interfaceFunctions,
+		evmasm::GasProfile const* _profile
+	);
+
+	bool isLeaf() const { return !m_lower; }
+	/// @returns the selectors of a leaf in the order in which they are compared.
+	std::vector<util::FixedHash<4>> const& selectors() const { return m_selectors; }
+	/// @returns the smallest selector of the upper subtree of an inner node.
+	util::FixedHash<4> const& pivot() const { return m_pivot; }
+	SelectorSearchTree const& lower() const { return *m_lower; }
+	SelectorSearchTree const& upper() const { return *m_upper; }
+
+private:
+	explicit SelectorSearchTree(std::vector<util::FixedHash<4>> _selectors): m_selectors(std::move(_selectors)) {}
+
+	/// Splits the node recursively or orders the selectors of a leaf.
+	/// @param _weights the execution counts of all functions or empty.
+	void build(size_t _runs, std::map<util::FixedHash<4>, size_t> const& _weights);
+
+	std::vector<util::FixedHash<4>> m_selectors;
+	util::FixedHash<4> m_pivot;
+	std::unique_ptr<SelectorSearchTree> m_lower;
+	std::unique_ptr<SelectorSearchTree> m_upper;
+};
+
+}
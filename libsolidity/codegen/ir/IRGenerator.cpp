@@ -29,6 +29,7 @@
 #include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/codegen/ABIFunctions.h>
 #include <libsolidity/codegen/CompilerUtils.h>
+#include <libsolidity/codegen/SelectorSearchTree.h>
 
 #include <libyul/AssemblyStack.h>
 #include <libyul/Utilities.h>
@@ -585,8 +586,19 @@ string IRGenerator::dispatchRoutine(ContractDefinition const& _contract)
 		if iszero(lt(calldatasize(), 4))
 		{
 			let selector := <shr224>(calldataload(0))
-			switch selector
-			<#cases>
+			<?useSearchTree><searchTree><!useSearchTree>switch selector
+			<#cases><case></cases>
+			default {}</useSearchTree>
+		}
+		if iszero(calldatasize()) { <receiveEther> }
+		<fallback>
+	)X");
+	t("shr224", m_utils.shiftRightFunction(224));
+	map<FixedHash<4>, FunctionTypePointer> interfaceFunctions = _contract.interfaceFunctions();
+	map<FixedHash<4>, string> cases;
+	for (auto const& function: interfaceFunctions)
+	{
+		Whiskers templ(R"X(
 			case <functionSelector>
 			{
 				// <functionName>
@@ -597,42 +609,69 @@ string IRGenerator::dispatchRoutine(ContractDefinition const& _contract)
 				let memEnd := <abiEncode>(memPos <?+retParams>,</+retParams> <retParams>)
 				return(memPos, sub(memEnd, memPos))
 			}
-			</cases>
-			default {}
-		}
-		if iszero(calldatasize()) { <receiveEther> }
-		<fallback>
-	)X");
-	t("shr224", m_utils.shiftRightFunction(224));
-	vector<map<string, string>> functions;
-	for (auto const& function: _contract.interfaceFunctions())
-	{
-		functions.emplace_back();
-		map<string, string>& templ = functions.back();
-		templ["functionSelector"] = "0x" + function.first.hex();
+			)X");
+		templ("functionSelector", "0x" + function.first.hex());
 		FunctionTypePointer const& type = function.second;
-		templ["functionName"] = type->externalSignature();
-		templ["callValueCheck"] = type->isPayable() ? "" : callValueCheck();
+		templ("functionName", type->externalSignature());
+		templ("callValueCheck", type->isPayable() ? "" : callValueCheck());
 
 		unsigned paramVars = make_shared<TupleType>(type->parameterTypes())->sizeOnStack();
 		unsigned retVars = make_shared<TupleType>(type->returnParameterTypes())->sizeOnStack();
 
 		ABIFunctions abiFunctions(m_evmVersion, m_context.revertStrings(), m_context.functionCollector());
-		templ["abiDecode"] = abiFunctions.tupleDecoder(type->parameterTypes());
-		templ["params"] = suffixedVariableNameList("param_", 0, paramVars);
-		templ["retParams"] = suffixedVariableNameList("ret_", 0, retVars);
+		templ("abiDecode", abiFunctions.tupleDecoder(type->parameterTypes()));
+		templ("params", suffixedVariableNameList("param_", 0, paramVars));
+		templ("retParams", suffixedVariableNameList("ret_", 0, retVars));
 
 		if (FunctionDefinition const* funDef = dynamic_cast<FunctionDefinition const*>(&type->declaration()))
-			templ["function"] = m_context.enqueueFunctionForCodeGeneration(*funDef);
+			templ("function", m_context.enqueueFunctionForCodeGeneration(*funDef));
 		else if (VariableDeclaration const* varDecl = dynamic_cast<VariableDeclaration const*>(&type->declaration()))
-			templ["function"] = generateGetter(*varDecl);
+			templ("function", generateGetter(*varDecl));
 		else
 			solAssert(false, "Unexpected declaration for function!");
 
-		templ["allocate"] = m_utils.allocationFunction();
-		templ["abiEncode"] = abiFunctions.tupleEncoder(type->returnParameterTypes(), type->returnParameterTypes(), false);
+		templ("allocate", m_utils.allocationFunction());
+		templ("abiEncode", abiFunctions.tupleEncoder(type->returnParameterTypes(), type->returnParameterTypes(), false));
+		cases[function.first] = templ.render();
+	}
+
+	// Without execution counts, the code transform already lowers large switches to a binary search.
+	map<FixedHash<4>, size_t> executions = SelectorSearchTree::executions(interfaceFunctions, m_optimiserSettings.gasProfile.get());
+	if (executions.empty())
+	{
+		vector<map<string, string>> sortedCases;
+		for (auto const& selectorCase: cases)
+			sortedCases.emplace_back(map<string, string>{{"case", selectorCase.second}});
+		t("useSearchTree", false);
+		t("searchTree", "");
+		t("cases", move(sortedCases));
+	}
+	else
+	{
+		function<string(SelectorSearchTree const&)> searchTree = [&](SelectorSearchTree const& _tree) -> string {
+			if (_tree.isLeaf())
+			{
+				string code = "switch selector\n";
+				for (FixedHash<4> const& selector: _tree.selectors())
+					code += cases.at(selector);
+				return code + "default {}\n";
+			}
+			return
+				"switch lt(selector, 0x" + _tree.pivot().hex() + ")\n"
+				"case 0 {\n" + searchTree(_tree.upper()) + "}\n"
+				"default {\n" + searchTree(_tree.lower()) + "}\n";
+		};
+		vector<FixedHash<4>> selectors;
+		for (auto const& selectorCase: cases)
+			selectors.emplace_back(selectorCase.first);
+		t("useSearchTree", true);
+		t("searchTree", searchTree(SelectorSearchTree(
+			move(selectors),
+			m_optimiserSettings.expectedExecutionsPerDeployment,
+			executions
+		)));
+		t("cases", vector<map<string, string>>{});
 	}
-	t("cases", functions);
 	if (FunctionDefinition const* fallback = _contract.fallbackFunction())
 	{
 		string fallbackCode;
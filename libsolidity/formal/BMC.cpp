@@ -29,15 +29,46 @@ using namespace solidity::util;
 using namespace solidity::langutil;
 using namespace solidity::frontend;
 
+namespace
+{
+
+/// Creates the solver contexts and lets as many of them check queries at the same time
+/// as fit into @a _parallelism threads, taking into account that the solvers of every
+/// context run on separate threads.
+unique_ptr<smtutil::SMTSolverPool> createSolverPool(
+	map<h256, string> const& _smtlib2Responses,
+	ReadCallback::Callback const& _smtCallback,
+	smtutil::SMTSolverChoice _enabledSolvers,
+	size_t _parallelism,
+	shared_ptr<smtutil::SMTQueryCache const> const& _cache
+)
+{
+	auto createPortfolio = [&]() {
+		return make_unique<smtutil::SMTPortfolio>(_smtlib2Responses, _smtCallback, _enabledSolvers, _parallelism, _cache);
+	};
+	vector<unique_ptr<smtutil::SolverInterface>> contexts;
+	contexts.emplace_back(createPortfolio());
+	auto const& portfolio = dynamic_cast<smtutil::SMTPortfolio&>(*contexts.front());
+	// Without an integrated solver the queries are only collected, which is not worth parallelising.
+	if (contexts.front()->solvers() > 1)
+		while (contexts.size() < smtutil::SMTSolverPool::numContexts)
+			contexts.emplace_back(createPortfolio());
+	return make_unique<smtutil::SMTSolverPool>(move(contexts), max<size_t>(_parallelism / portfolio.threads(), 1));
+}
+
+}
+
 BMC::BMC(
 	smt::EncodingContext& _context,
 	ErrorReporter& _errorReporter,
 	map<h256, string> const& _smtlib2Responses,
 	ReadCallback::Callback const& _smtCallback,
-	smtutil::SMTSolverChoice _enabledSolvers
+	smtutil::SMTSolverChoice _enabledSolvers,
+	size_t _parallelism,
+	shared_ptr<smtutil::SMTQueryCache const> _cache
 ):
 	SMTEncoder(_context),
-	m_interface(make_unique<smtutil::SMTPortfolio>(_smtlib2Responses, _smtCallback, _enabledSolvers)),
+	m_interface(createSolverPool(_smtlib2Responses, _smtCallback, _enabledSolvers, _parallelism, _cache)),
 	m_outerErrorReporter(_errorReporter)
 {
 #if defined (HAVE_Z3) || defined (HAVE_CVC4)
@@ -519,15 +550,28 @@ void BMC::reset()
 
 pair<vector<smtutil::Expression>, vector<string>> BMC::modelExpressions()
 {
+	// The expressions are part of the queries, so they are ordered by AST ID and name instead
+	// of by address and hash, in order to get the same queries, e.g. for the cache, in every compilation.
+	auto byID = [](ASTNode const* _a, ASTNode const* _b) { return _a->id() < _b->id(); };
+	vector<VariableDeclaration const*> variables;
+	for (auto const& var: m_context.variables())
+		variables.push_back(var.first);
+	sort(variables.begin(), variables.end(), byID);
+	vector<Expression const*> uninterpretedTerms(m_uninterpretedTerms.begin(), m_uninterpretedTerms.end());
+	sort(uninterpretedTerms.begin(), uninterpretedTerms.end(), byID);
+
 	vector<smtutil::Expression> expressionsToEvaluate;
 	vector<string> expressionNames;
-	for (auto const& var: m_context.variables())
-		if (var.first->type()->isValueType())
+	for (auto const* var: variables)
+		if (var->type()->isValueType())
 		{
-			expressionsToEvaluate.emplace_back(currentValue(*var.first));
-			expressionNames.push_back(var.first->name());
+			expressionsToEvaluate.emplace_back(currentValue(*var));
+			expressionNames.push_back(var->name());
 		}
-	for (auto const& var: m_context.globalSymbols())
+	for (auto const& var: map<string, shared_ptr<smt::SymbolicVariable>>(
+		m_context.globalSymbols().begin(),
+		m_context.globalSymbols().end()
+	))
 	{
 		auto const& type = var.second->type();
 		if (
@@ -539,7 +583,7 @@ pair<vector<smtutil::Expression>, vector<string>> BMC::modelExpressions()
 			expressionNames.push_back(var.first);
 		}
 	}
-	for (auto const& uf: m_uninterpretedTerms)
+	for (auto const* uf: uninterpretedTerms)
 		if (uf->annotation().type->isValueType())
 		{
 			expressionsToEvaluate.emplace_back(expr(*uf));
@@ -555,6 +599,7 @@ void BMC::checkVerificationTargets(smtutil::Expression const& _constraints)
 {
 	for (auto& target: m_verificationTargets)
 		checkVerificationTarget(target, _constraints);
+	checkQueries();
 }
 
 void BMC::checkVerificationTarget(BMCVerificationTarget& _target, smtutil::Expression const& _constraints)
@@ -739,9 +784,6 @@ void BMC::checkCondition(
 	smtutil::Expression const* _additionalValue
 )
 {
-	m_interface->push();
-	m_interface->addAssertion(_condition);
-
 	vector<smtutil::Expression> expressionsToEvaluate;
 	vector<string> expressionNames;
 	tie(expressionsToEvaluate, expressionNames) = _modelExpressions;
@@ -751,9 +793,6 @@ void BMC::checkCondition(
 			expressionsToEvaluate.emplace_back(*_additionalValue);
 			expressionNames.push_back(_additionalValueName);
 		}
-	smtutil::CheckResult result;
-	vector<string> values;
-	tie(result, values) = checkSatisfiableAndGenerateModel(expressionsToEvaluate);
 
 	string extraComment = SMTEncoder::extraComment();
 	if (m_loopExecutionHappened)
@@ -767,57 +806,83 @@ void BMC::checkCondition(
 			" This is due to the possibility that the actual called contract"
 			" has the same ABI but implements the function differently.";
 
+	m_queries.emplace_back(BMCQuery{
+		{move(_condition), move(expressionsToEvaluate)},
+		move(expressionNames),
+		_callStack,
+		_location,
+		_errorHappens,
+		_errorMightHappen,
+		_description,
+		move(extraComment)
+	});
+}
+
+void BMC::checkQueries()
+{
+	vector<smtutil::SMTSolverPool::Query> queries;
+	for (auto const& query: m_queries)
+		queries.emplace_back(query.query);
+	auto results = m_interface->check(queries);
+	for (size_t i = 0; i < m_queries.size(); ++i)
+	{
+		auto [result, values] = runCheck([&]() { return results[i].get(); });
+		reportQueryResult(m_queries[i], result, values);
+	}
+	m_queries.clear();
+}
+
+void BMC::reportQueryResult(BMCQuery const& _query, smtutil::CheckResult _result, vector<string> const& _values)
+{
 	SecondarySourceLocation secondaryLocation{};
-	secondaryLocation.append(extraComment, SourceLocation{});
+	secondaryLocation.append(_query.extraComment, SourceLocation{});
 
-	switch (result)
+	switch (_result)
 	{
 	case smtutil::CheckResult::SATISFIABLE:
 	{
 		std::ostringstream message;
-		message << _description << " happens here";
-		if (_callStack.size())
+		message << _query.description << " happens here";
+		if (_query.callStack.size())
 		{
 			std::ostringstream modelMessage;
 			modelMessage << "  for:\n";
-			solAssert(values.size() == expressionNames.size(), "");
+			solAssert(_values.size() == _query.expressionNames.size(), "");
 			map<string, string> sortedModel;
-			for (size_t i = 0; i < values.size(); ++i)
-				if (expressionsToEvaluate.at(i).name != values.at(i))
-					sortedModel[expressionNames.at(i)] = values.at(i);
+			for (size_t i = 0; i < _values.size(); ++i)
+				if (_query.query.expressionsToEvaluate.at(i).name != _values.at(i))
+					sortedModel[_query.expressionNames.at(i)] = _values.at(i);
 
 			for (auto const& eval: sortedModel)
 				modelMessage << "  " << eval.first << " = " << eval.second << "\n";
 			m_errorReporter.warning(
-				_errorHappens,
-				_location,
+				_query.errorHappens,
+				_query.location,
 				message.str(),
 				SecondarySourceLocation().append(modelMessage.str(), SourceLocation{})
-				.append(SMTEncoder::callStackMessage(_callStack))
+				.append(SMTEncoder::callStackMessage(_query.callStack))
 				.append(move(secondaryLocation))
 			);
 		}
 		else
 		{
 			message << ".";
-			m_errorReporter.warning(6084_error, _location, message.str(), secondaryLocation);
+			m_errorReporter.warning(6084_error, _query.location, message.str(), secondaryLocation);
 		}
 		break;
 	}
 	case smtutil::CheckResult::UNSATISFIABLE:
 		break;
 	case smtutil::CheckResult::UNKNOWN:
-		m_errorReporter.warning(_errorMightHappen, _location, _description + " might happen here.", secondaryLocation);
+		m_errorReporter.warning(_query.errorMightHappen, _query.location, _query.description + " might happen here.", secondaryLocation);
 		break;
 	case smtutil::CheckResult::CONFLICTING:
-		m_errorReporter.warning(1584_error, _location, "At least two SMT solvers provided conflicting answers. Results might not be sound.");
+		m_errorReporter.warning(1584_error, _query.location, "At least two SMT solvers provided conflicting answers. Results might not be sound.");
 		break;
 	case smtutil::CheckResult::ERROR:
-		m_errorReporter.warning(1823_error, _location, "Error trying to invoke SMT solver.");
+		m_errorReporter.warning(1823_error, _query.location, "Error trying to invoke SMT solver.");
 		break;
 	}
-
-	m_interface->pop();
 }
 
 void BMC::checkBooleanNotConstant(
@@ -880,12 +945,19 @@ void BMC::checkBooleanNotConstant(
 
 pair<smtutil::CheckResult, vector<string>>
 BMC::checkSatisfiableAndGenerateModel(vector<smtutil::Expression> const& _expressionsToEvaluate)
+{
+	return runCheck([&]() { return m_interface->check(_expressionsToEvaluate); });
+}
+
+pair<smtutil::CheckResult, vector<string>> BMC::runCheck(
+	function<pair<smtutil::CheckResult, vector<string>>()> const& _check
+)
 {
 	smtutil::CheckResult result;
 	vector<string> values;
 	try
 	{
-		tie(result, values) = m_interface->check(_expressionsToEvaluate);
+		tie(result, values) = _check();
 	}
 	catch (smtutil::SolverError const& _e)
 	{
@@ -34,9 +34,12 @@
 
 #include <libsolidity/interface/ReadFile.h>
 
+#include <libsmtutil/SMTQueryCache.h>
+#include <libsmtutil/SMTSolverPool.h>
 #include <libsmtutil/SolverInterface.h>
 #include <liblangutil/ErrorReporter.h>
 
+#include <functional>
 #include <set>
 #include <string>
 #include <vector>
@@ -61,7 +64,9 @@ public:
 		langutil::ErrorReporter& _errorReporter,
 		std::map<h256, std::string> const& _smtlib2Responses,
 		ReadCallback::Callback const& _smtCallback,
-		smtutil::SMTSolverChoice _enabledSolvers
+		smtutil::SMTSolverChoice _enabledSolvers,
+		size_t _parallelism = 1,
+		std::shared_ptr<smtutil::SMTQueryCache const> _cache = nullptr
 	);
 
 	void analyze(SourceUnit const& _sources, std::map<ASTNode const*, std::set<VerificationTarget::Type>> _solvedTargets);
@@ -145,6 +150,7 @@ private:
 	/// Solver related.
 	//@{
 	/// Check that a condition can be satisfied.
+	/// The check only runs in checkQueries().
 	void checkCondition(
 		smtutil::Expression _condition,
 		std::vector<CallStackEntry> const& _callStack,
@@ -168,9 +174,31 @@ private:
 	checkSatisfiableAndGenerateModel(std::vector<smtutil::Expression> const& _expressionsToEvaluate);
 
 	smtutil::CheckResult checkSatisfiable();
+
+	/// Runs @a _check, turning solver errors into warnings, and formats the model values.
+	std::pair<smtutil::CheckResult, std::vector<std::string>> runCheck(
+		std::function<std::pair<smtutil::CheckResult, std::vector<std::string>>()> const& _check
+	);
+
+	/// Condition check requested by checkCondition.
+	struct BMCQuery
+	{
+		smtutil::SMTSolverPool::Query query;
+		std::vector<std::string> expressionNames;
+		std::vector<CallStackEntry> callStack;
+		langutil::SourceLocation location;
+		langutil::ErrorId errorHappens;
+		langutil::ErrorId errorMightHappen;
+		std::string description;
+		std::string extraComment;
+	};
+	/// Checks all requested conditions concurrently and reports the results
+	/// in the order in which the checks were requested.
+	void checkQueries();
+	void reportQueryResult(BMCQuery const& _query, smtutil::CheckResult _result, std::vector<std::string> const& _values);
 	//@}
 
-	std::unique_ptr<smtutil::SolverInterface> m_interface;
+	std::unique_ptr<smtutil::SMTSolverPool> m_interface;
 
 	/// Flags used for better warning messages.
 	bool m_loopExecutionHappened = false;
@@ -181,6 +209,9 @@ private:
 
 	std::vector<BMCVerificationTarget> m_verificationTargets;
 
+	/// Condition checks that have not run yet.
+	std::vector<BMCQuery> m_queries;
+
 	/// Targets that were already proven.
 	std::map<ASTNode const*, std::set<VerificationTarget::Type>> m_solvedTargets;
 };
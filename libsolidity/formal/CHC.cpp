@@ -41,40 +41,52 @@ CHC::CHC(
 	ErrorReporter& _errorReporter,
 	map<util::h256, string> const& _smtlib2Responses,
 	ReadCallback::Callback const& _smtCallback,
-	[[maybe_unused]] smtutil::SMTSolverChoice _enabledSolvers
+	[[maybe_unused]] smtutil::SMTSolverChoice _enabledSolvers,
+	size_t _parallelism,
+	shared_ptr<smtutil::SMTQueryCache const> _cache
 ):
 	SMTEncoder(_context),
 	m_outerErrorReporter(_errorReporter),
 	m_enabledSolvers(_enabledSolvers)
 {
+	vector<unique_ptr<smtutil::CHCSolverInterface>> contexts;
+	vector<smtutil::SolverInterface*> variableSolvers;
+	string solvers;
 #ifdef HAVE_Z3
 	if (_enabledSolvers.z3)
-		m_interface = make_unique<smtutil::Z3CHCInterface>();
+	{
+		for (size_t i = 0; i < smtutil::CHCSolverPool::numContexts; ++i)
+		{
+			auto z3Interface = make_unique<smtutil::Z3CHCInterface>();
+			variableSolvers.emplace_back(z3Interface->z3Interface());
+			contexts.emplace_back(move(z3Interface));
+		}
+		solvers = "z3 " + smtutil::Z3Interface::version();
+	}
 #endif
-	if (!m_interface)
-		m_interface = make_unique<smtutil::CHCSmtLib2Interface>(_smtlib2Responses, _smtCallback);
+	// The queries are only collected in this case, which is not worth parallelising.
+	// Since they are answered by the callback, they are not cached either.
+	if (contexts.empty())
+	{
+		auto smtlib2Interface = make_unique<smtutil::CHCSmtLib2Interface>(_smtlib2Responses, _smtCallback);
+		variableSolvers.emplace_back(smtlib2Interface->smtlib2Interface());
+		contexts.emplace_back(move(smtlib2Interface));
+		_cache = nullptr;
+	}
+	m_interface = make_unique<smtutil::CHCSolverPool>(
+		move(contexts),
+		move(variableSolvers),
+		max<size_t>(_parallelism, 1),
+		move(_cache),
+		move(solvers)
+	);
 }
 
 void CHC::analyze(SourceUnit const& _source)
 {
 	solAssert(_source.annotation().experimentalFeatures.count(ExperimentalFeature::SMTChecker), "");
 
-	bool usesZ3 = false;
-#ifdef HAVE_Z3
-	usesZ3 = m_enabledSolvers.z3;
-	if (usesZ3)
-	{
-		auto z3Interface = dynamic_cast<smtutil::Z3CHCInterface const*>(m_interface.get());
-		solAssert(z3Interface, "");
-		m_context.setSolver(z3Interface->z3Interface());
-	}
-#endif
-	if (!usesZ3)
-	{
-		auto smtlib2Interface = dynamic_cast<smtutil::CHCSmtLib2Interface const*>(m_interface.get());
-		solAssert(smtlib2Interface, "");
-		m_context.setSolver(smtlib2Interface->smtlib2Interface());
-	}
+	m_context.setSolver(m_interface->declarations());
 	m_context.clear();
 	m_context.setAssertionAccumulation(false);
 	m_variableUsage.setFunctionInlining(false);
@@ -102,10 +114,11 @@ void CHC::analyze(SourceUnit const& _source)
 
 vector<string> CHC::unhandledQueries() const
 {
-	if (auto smtlib2 = dynamic_cast<smtutil::CHCSmtLib2Interface const*>(m_interface.get()))
-		return smtlib2->unhandledQueries();
-
-	return {};
+	vector<string> queries;
+	for (auto const& context: m_interface->contexts())
+		if (auto smtlib2 = dynamic_cast<smtutil::CHCSmtLib2Interface const*>(context.get()))
+			queries += smtlib2->unhandledQueries();
+	return queries;
 }
 
 bool CHC::visit(ContractDefinition const& _contract)
@@ -934,11 +947,8 @@ void CHC::createErrorBlock()
 
 void CHC::connectBlocks(smtutil::Expression const& _from, smtutil::Expression const& _to, smtutil::Expression const& _constraints)
 {
-	smtutil::Expression edge = smtutil::Expression::implies(
-		_from && m_context.assertions() && _constraints,
-		_to
-	);
-	addRule(edge, _from.name + "_to_" + _to.name);
+	auto [rule, ruleName] = edge(_from, _to, _constraints);
+	addRule(rule, ruleName);
 }
 
 vector<smtutil::Expression> CHC::initialStateVariables()
@@ -1074,27 +1084,16 @@ void CHC::addRule(smtutil::Expression const& _rule, string const& _ruleName)
 	m_interface->addRule(_rule, _ruleName);
 }
 
-pair<smtutil::CheckResult, vector<string>> CHC::query(smtutil::Expression const& _query, langutil::SourceLocation const& _location)
+pair<smtutil::Expression, string> CHC::edge(
+	smtutil::Expression const& _from,
+	smtutil::Expression const& _to,
+	smtutil::Expression const& _constraints
+)
 {
-	smtutil::CheckResult result;
-	vector<string> values;
-	tie(result, values) = m_interface->query(_query);
-	switch (result)
-	{
-	case smtutil::CheckResult::SATISFIABLE:
-		break;
-	case smtutil::CheckResult::UNSATISFIABLE:
-		break;
-	case smtutil::CheckResult::UNKNOWN:
-		break;
-	case smtutil::CheckResult::CONFLICTING:
-		m_outerErrorReporter.warning(1988_error, _location, "At least two SMT solvers provided conflicting answers. Results might not be sound.");
-		break;
-	case smtutil::CheckResult::ERROR:
-		m_outerErrorReporter.warning(1218_error, _location, "Error trying to invoke SMT solver.");
-		break;
-	}
-	return {result, values};
+	return {
+		smtutil::Expression::implies(_from && m_context.assertions() && _constraints, _to),
+		_from.name + "_to_" + _to.name
+	};
 }
 
 void CHC::addVerificationTarget(
@@ -1130,10 +1129,11 @@ void CHC::addArrayPopVerificationTarget(ASTNode const* _scope, smtutil::Expressi
 
 void CHC::checkVerificationTargets()
 {
+	vector<CHCQuery> queries;
 	for (auto const& [scope, target]: m_verificationTargets)
 	{
 		if (target.type == VerificationTarget::Type::Assert)
-			checkAssertTarget(scope, target);
+			addAssertTargetQueries(scope, target, queries);
 		else
 		{
 			string satMsg;
@@ -1150,12 +1150,19 @@ void CHC::checkVerificationTargets()
 
 			auto it = m_errorIds.find(scope->id());
 			solAssert(it != m_errorIds.end(), "");
-			checkAndReportTarget(scope, target, it->second, satMsg, unknownMsg);
+			queries.emplace_back(targetQuery(scope, target, it->second, satMsg, unknownMsg));
 		}
 	}
+
+	vector<smtutil::CHCSolverPool::Query> solverQueries;
+	for (auto const& query: queries)
+		solverQueries.emplace_back(query.query);
+	auto results = m_interface->query(solverQueries);
+	for (size_t i = 0; i < queries.size(); ++i)
+		reportTarget(queries[i], results[i].get().first);
 }
 
-void CHC::checkAssertTarget(ASTNode const* _scope, CHCVerificationTarget const& _target)
+void CHC::addAssertTargetQueries(ASTNode const* _scope, CHCVerificationTarget const& _target, vector<CHCQuery>& _queries)
 {
 	solAssert(_target.type == VerificationTarget::Type::Assert, "");
 	auto assertions = transactionAssertions(_scope);
@@ -1163,20 +1170,12 @@ void CHC::checkAssertTarget(ASTNode const* _scope, CHCVerificationTarget const&
 	{
 		auto it = m_errorIds.find(assertion->id());
 		solAssert(it != m_errorIds.end(), "");
-		unsigned errorId = it->second;
-
-		createErrorBlock();
-		connectBlocks(_target.value, error(), _target.constraints && (_target.errorId == errorId));
-		auto [result, model] = query(error(), assertion->location());
-		// This should be fine but it's a bug in the old compiler
-		(void)model;
-		if (result == smtutil::CheckResult::UNSATISFIABLE)
-			m_safeTargets[assertion].insert(_target.type);
+		_queries.emplace_back(targetQuery(assertion, _target, it->second, "", ""));
 	}
 }
 
-void CHC::checkAndReportTarget(
-	ASTNode const* _scope,
+CHC::CHCQuery CHC::targetQuery(
+	ASTNode const* _node,
 	CHCVerificationTarget const& _target,
 	unsigned _errorId,
 	string _satMsg,
@@ -1184,27 +1183,44 @@ void CHC::checkAndReportTarget(
 )
 {
 	createErrorBlock();
-	connectBlocks(_target.value, error(), _target.constraints && (_target.errorId == _errorId));
-	auto [result, model] = query(error(), _scope->location());
-	// This should be fine but it's a bug in the old compiler
-	(void)model;
-	if (result == smtutil::CheckResult::UNSATISFIABLE)
-		m_safeTargets[_scope].insert(_target.type);
-	else if (result == smtutil::CheckResult::SATISFIABLE)
+	auto [rule, ruleName] = edge(_target.value, error(), _target.constraints && (_target.errorId == _errorId));
+	return CHCQuery{{move(rule), move(ruleName), error()}, _node, _target.type, move(_satMsg), move(_unknownMsg)};
+}
+
+void CHC::reportTarget(CHCQuery const& _query, smtutil::CheckResult _result)
+{
+	switch (_result)
+	{
+	case smtutil::CheckResult::SATISFIABLE:
+		break;
+	case smtutil::CheckResult::UNSATISFIABLE:
+		break;
+	case smtutil::CheckResult::UNKNOWN:
+		break;
+	case smtutil::CheckResult::CONFLICTING:
+		m_outerErrorReporter.warning(1988_error, _query.node->location(), "At least two SMT solvers provided conflicting answers. Results might not be sound.");
+		break;
+	case smtutil::CheckResult::ERROR:
+		m_outerErrorReporter.warning(1218_error, _query.node->location(), "Error trying to invoke SMT solver.");
+		break;
+	}
+
+	if (_result == smtutil::CheckResult::UNSATISFIABLE)
+		m_safeTargets[_query.node].insert(_query.type);
+	else if (_result == smtutil::CheckResult::SATISFIABLE && !_query.satMsg.empty())
 	{
-		solAssert(!_satMsg.empty(), "");
-		m_unsafeTargets[_scope].insert(_target.type);
+		m_unsafeTargets[_query.node].insert(_query.type);
 		m_outerErrorReporter.warning(
 			2529_error,
-			_scope->location(),
-			_satMsg
+			_query.node->location(),
+			_query.satMsg
 		);
 	}
-	else if (!_unknownMsg.empty())
+	else if (_result != smtutil::CheckResult::SATISFIABLE && !_query.unknownMsg.empty())
 		m_outerErrorReporter.warning(
 			1147_error,
-			_scope->location(),
-			_unknownMsg
+			_query.node->location(),
+			_query.unknownMsg
 		);
 }
 
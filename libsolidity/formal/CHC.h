@@ -35,7 +35,7 @@
 
 #include <libsolidity/interface/ReadFile.h>
 
-#include <libsmtutil/CHCSolverInterface.h>
+#include <libsmtutil/CHCSolverPool.h>
 
 #include <map>
 #include <set>
@@ -51,7 +51,9 @@ public:
 		langutil::ErrorReporter& _errorReporter,
 		std::map<util::h256, std::string> const& _smtlib2Responses,
 		ReadCallback::Callback const& _smtCallback,
-		smtutil::SMTSolverChoice _enabledSolvers
+		smtutil::SMTSolverChoice _enabledSolvers,
+		size_t _parallelism = 1,
+		std::shared_ptr<smtutil::SMTQueryCache const> _cache = nullptr
 	);
 
 	void analyze(SourceUnit const& _sources);
@@ -185,27 +187,44 @@ private:
 
 	/// Solver related.
 	//@{
+	/// @returns the Horn rule for the edge from @a _from to @a _to and its name.
+	std::pair<smtutil::Expression, std::string> edge(
+		smtutil::Expression const& _from,
+		smtutil::Expression const& _to,
+		smtutil::Expression const& _constraints = smtutil::Expression(true)
+	);
 	/// Adds Horn rule to the solver.
 	void addRule(smtutil::Expression const& _rule, std::string const& _ruleName);
-	/// @returns <true, empty> if query is unsatisfiable (safe).
-	/// @returns <false, model> otherwise.
-	std::pair<smtutil::CheckResult, std::vector<std::string>> query(smtutil::Expression const& _query, langutil::SourceLocation const& _location);
 
 	void addVerificationTarget(ASTNode const* _scope, VerificationTarget::Type _type, smtutil::Expression _from, smtutil::Expression _constraints, smtutil::Expression _errorId);
 	void addAssertVerificationTarget(ASTNode const* _scope, smtutil::Expression _from, smtutil::Expression _constraints, smtutil::Expression _errorId);
 	void addArrayPopVerificationTarget(ASTNode const* _scope, smtutil::Expression _errorId);
 
+	/// Creates the queries of all verification targets, solves them concurrently
+	/// and reports the results in the order of the targets.
 	void checkVerificationTargets();
 	// Forward declaration. Definition is below.
 	struct CHCVerificationTarget;
-	void checkAssertTarget(ASTNode const* _scope, CHCVerificationTarget const& _target);
-	void checkAndReportTarget(
-		ASTNode const* _scope,
+	/// Reachability query of a verification target.
+	struct CHCQuery
+	{
+		smtutil::CHCSolverPool::Query query;
+		/// Node that is reported as (un)safe.
+		ASTNode const* node;
+		VerificationTarget::Type type;
+		/// Messages for a reachable or unknown error, no message is reported if they are empty.
+		std::string satMsg;
+		std::string unknownMsg;
+	};
+	void addAssertTargetQueries(ASTNode const* _scope, CHCVerificationTarget const& _target, std::vector<CHCQuery>& _queries);
+	CHCQuery targetQuery(
+		ASTNode const* _node,
 		CHCVerificationTarget const& _target,
 		unsigned _errorId,
 		std::string _satMsg,
 		std::string _unknownMsg
 	);
+	void reportTarget(CHCQuery const& _query, smtutil::CheckResult _result);
 	//@}
 
 	/// Misc.
@@ -311,7 +330,7 @@ private:
 	//@}
 
 	/// CHC solver.
-	std::unique_ptr<smtutil::CHCSolverInterface> m_interface;
+	std::unique_ptr<smtutil::CHCSolverPool> m_interface;
 
 	/// ErrorReporter that comes from CompilerStack.
 	langutil::ErrorReporter& m_outerErrorReporter;
@@ -18,21 +18,43 @@
 
 #include <libsolidity/formal/ModelChecker.h>
 
+#include <memory>
+#include <mutex>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::langutil;
 using namespace solidity::frontend;
 
+namespace
+{
+
+/// @returns a callback that can be called from several threads at the same time.
+ReadCallback::Callback synchronised(ReadCallback::Callback const& _callback, size_t _parallelism)
+{
+	if (!_callback || _parallelism <= 1)
+		return _callback;
+	auto callbackMutex = make_shared<mutex>();
+	return [=](string const& _kind, string const& _query) {
+		lock_guard<mutex> lock(*callbackMutex);
+		return _callback(_kind, _query);
+	};
+}
+
+}
+
 ModelChecker::ModelChecker(
 	ErrorReporter& _errorReporter,
 	map<h256, string> const& _smtlib2Responses,
 	ReadCallback::Callback const& _smtCallback,
-	smtutil::SMTSolverChoice _enabledSolvers
+	smtutil::SMTSolverChoice _enabledSolvers,
+	size_t _parallelism,
+	shared_ptr<smtutil::SMTQueryCache const> _cache
 ):
 	m_context(),
-	m_bmc(m_context, _errorReporter, _smtlib2Responses, _smtCallback, _enabledSolvers),
-	m_chc(m_context, _errorReporter, _smtlib2Responses, _smtCallback, _enabledSolvers)
+	m_bmc(m_context, _errorReporter, _smtlib2Responses, synchronised(_smtCallback, _parallelism), _enabledSolvers, _parallelism, _cache),
+	m_chc(m_context, _errorReporter, _smtlib2Responses, synchronised(_smtCallback, _parallelism), _enabledSolvers, _parallelism, _cache)
 {
 }
 
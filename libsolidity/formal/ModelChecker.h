@@ -29,6 +29,7 @@
 
 #include <libsolidity/interface/ReadFile.h>
 
+#include <libsmtutil/SMTQueryCache.h>
 #include <libsmtutil/SolverInterface.h>
 #include <liblangutil/ErrorReporter.h>
 
@@ -46,11 +47,16 @@ class ModelChecker
 public:
 	/// @param _enabledSolvers represents a runtime choice of which SMT solvers
 	/// should be used, even if all are available. The default choice is to use all.
+	/// @param _parallelism is the number of threads the engines may use to solve
+	/// queries concurrently. The reported results do not depend on it.
+	/// @param _cache if given, stores the results of the integrated solvers across runs.
 	ModelChecker(
 		langutil::ErrorReporter& _errorReporter,
 		std::map<solidity::util::h256, std::string> const& _smtlib2Responses,
 		ReadCallback::Callback const& _smtCallback = ReadCallback::Callback(),
-		smtutil::SMTSolverChoice _enabledSolvers = smtutil::SMTSolverChoice::All()
+		smtutil::SMTSolverChoice _enabledSolvers = smtutil::SMTSolverChoice::All(),
+		size_t _parallelism = 1,
+		std::shared_ptr<smtutil::SMTQueryCache const> _cache = nullptr
 	);
 
 	void analyze(SourceUnit const& _sources);
@@ -0,0 +1,106 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/interface/CompilationCache.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+
+#include <boost/filesystem.hpp>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::frontend;
+
+namespace fs = boost::filesystem;
+
+CompilationCache::CompilationCache(string _directory):
+	m_directory(move(_directory))
+{
+	boost::system::error_code error;
+	fs::create_directories(m_directory, error);
+}
+
+optional<Json::Value> CompilationCache::load(h256 const& _key) const
+{
+	fs::path file = fs::path(m_directory) / (_key.hex() + ".json");
+	string content = readFileAsString(file.string());
+	Json::Value entry;
+	if (content.empty() || !jsonParseStrict(content, entry) || !entry.isObject())
+		return nullopt;
+	return entry;
+}
+
+void CompilationCache::store(h256 const& _key, Json::Value const& _entry) const
+{
+	fs::path file = fs::path(m_directory) / (_key.hex() + ".json");
+	writeFileAtomically(file.string(), jsonCompactPrint(_entry));
+}
+
+Json::Value CompilationCache::linkerObjectToJson(evmasm::LinkerObject const& _object)
+{
+	Json::Value json{Json::objectValue};
+	json["bytecode"] = toHex(_object.bytecode);
+	json["linkReferences"] = Json::objectValue;
+	for (auto const& [offset, library]: _object.linkReferences)
+		json["linkReferences"][to_string(offset)] = library;
+	json["immutableReferences"] = Json::objectValue;
+	for (auto const& [hash, reference]: _object.immutableReferences)
+	{
+		Json::Value& immutable = json["immutableReferences"][hash.str()];
+		immutable["name"] = reference.first;
+		immutable["offsets"] = Json::arrayValue;
+		for (size_t offset: reference.second)
+			immutable["offsets"].append(Json::UInt64(offset));
+	}
+	return json;
+}
+
+optional<evmasm::LinkerObject> CompilationCache::linkerObjectFromJson(Json::Value const& _json)
+{
+	if (
+		!_json.isObject() ||
+		!_json["bytecode"].isString() ||
+		!_json["linkReferences"].isObject() ||
+		!_json["immutableReferences"].isObject()
+	)
+		return nullopt;
+
+	try
+	{
+		evmasm::LinkerObject object;
+		object.bytecode = fromHex(_json["bytecode"].asString(), WhenError::Throw);
+		for (string const& offset: _json["linkReferences"].getMemberNames())
+			object.linkReferences[stoul(offset)] = _json["linkReferences"][offset].asString();
+		for (string const& hash: _json["immutableReferences"].getMemberNames())
+		{
+			Json::Value const& immutable = _json["immutableReferences"][hash];
+			auto& reference = object.immutableReferences[u256(hash)];
+			reference.first = immutable["name"].asString();
+			for (Json::Value const& offset: immutable["offsets"])
+				reference.second.emplace_back(offset.asUInt64());
+		}
+		return object;
+	}
+	catch (std::exception const&)
+	{
+		return nullopt;
+	}
+}
@@ -0,0 +1,65 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * On-disk cache for the compilation results of contracts.
+ */
+
+#pragma once
+
+#include <libevmasm/LinkerObject.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <json/json.h>
+
+#include <optional>
+#include <string>
+
+namespace solidity::frontend
+{
+
+/**
+ * Directory of compilation results, one JSON file per entry, named after the key of the entry.
+ *
+ * The cache is best-effort: Entries that cannot be read or written are treated as missing.
+ * Entries are written to a temporary file first and then renamed, so that several compiler
+ * processes can share the same directory.
+ * Entries are never removed, the directory can be deleted at any time.
+ */
+class CompilationCache
+{
+public:
+	/// Creates a cache in the directory @a _directory, which is created if it does not exist yet.
+	explicit CompilationCache(std::string _directory);
+
+	std::string const& directory() const { return m_directory; }
+
+	/// @returns the entry stored under @a _key or nullopt if there is none.
+	std::optional<Json::Value> load(util::h256 const& _key) const;
+	/// Stores @a _entry under @a _key, replacing any previous entry.
+	void store(util::h256 const& _key, Json::Value const& _entry) const;
+
+	static Json::Value linkerObjectToJson(evmasm::LinkerObject const& _object);
+	/// @returns the object encoded by linkerObjectToJson or nullopt if @a _json is malformed.
+	static std::optional<evmasm::LinkerObject> linkerObjectFromJson(Json::Value const& _json);
+
+private:
+	std::string m_directory;
+};
+
+}
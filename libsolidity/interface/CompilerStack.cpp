@@ -46,6 +46,7 @@
 #include <libsolidity/codegen/Compiler.h>
 #include <libsolidity/formal/ModelChecker.h>
 #include <libsolidity/interface/ABI.h>
+#include <libsolidity/interface/CompilationCache.h>
 #include <libsolidity/interface/Natspec.h>
 #include <libsolidity/interface/GasEstimator.h>
 #include <libsolidity/interface/StorageLayout.h>
@@ -64,12 +65,16 @@
 #include <libevmasm/Exceptions.h>
 
 #include <libsolutil/SwarmHash.h>
+#include <libsolutil/ThreadPool.h>
 #include <libsolutil/IpfsHash.h>
 #include <libsolutil/JSON.h>
 
 #include <json/json.h>
 
 #include <boost/algorithm/string/replace.hpp>
+
+#include <atomic>
+#include <future>
 #include <utility>
 
 using namespace std;
@@ -80,9 +85,12 @@ using namespace solidity::frontend;
 using solidity::util::errinfo_comment;
 using solidity::util::toHex;
 
-static int g_compilerStackCounts = 0;
+/// Number of CompilerStack instances on the current thread.
+static thread_local int t_compilerStackCounts = 0;
 
 CompilerStack::CompilerStack(ReadCallback::Callback _readFile):
+	m_typeProvider{make_unique<TypeProvider>()},
+	m_yulStringRepository{make_unique<yul::YulStringRepository>()},
 	m_readFile{std::move(_readFile)},
 	m_enabledSMTSolvers{smtutil::SMTSolverChoice::All()},
 	m_generateIR{false},
@@ -90,16 +98,20 @@ CompilerStack::CompilerStack(ReadCallback::Callback _readFile):
 	m_errorList{},
 	m_errorReporter{m_errorList}
 {
-	// Because TypeProvider is currently a singleton API, we must ensure that
-	// no more than one entity is actually using it at a time.
-	solAssert(g_compilerStackCounts == 0, "You shall not have another CompilerStack aside me.");
-	++g_compilerStackCounts;
+	// Types are requested through the static TypeProvider API, which uses the provider
+	// of the current thread. We must thus ensure that no more than one CompilerStack
+	// is using it at a time.
+	solAssert(t_compilerStackCounts == 0, "You shall not have another CompilerStack aside me.");
+	++t_compilerStackCounts;
+	TypeProvider::setCurrent(m_typeProvider.get());
+	m_previousYulStringRepository = yul::YulStringRepository::setCurrent(m_yulStringRepository.get());
 }
 
 CompilerStack::~CompilerStack()
 {
-	--g_compilerStackCounts;
-	TypeProvider::reset();
+	--t_compilerStackCounts;
+	TypeProvider::setCurrent(nullptr);
+	yul::YulStringRepository::setCurrent(m_previousYulStringRepository);
 }
 
 std::optional<CompilerStack::Remapping> CompilerStack::parseRemapping(string const& _remapping)
@@ -174,6 +186,23 @@ void CompilerStack::setRevertStringBehaviour(RevertStrings _revertStrings)
 	m_revertStrings = _revertStrings;
 }
 
+void CompilerStack::setCacheDirectory(string const& _directory)
+{
+	if (_directory.empty())
+		m_cache.reset();
+	else
+		m_cache = make_unique<CompilationCache>(_directory);
+}
+
+void CompilerStack::setModelCheckerCacheDirectory(string const& _directory)
+{
+	if (_directory.empty())
+		m_modelCheckerCache.reset();
+	else
+		// The resource limits of the solvers are part of the compiler.
+		m_modelCheckerCache = make_shared<smtutil::SMTQueryCache>(_directory, VersionString);
+}
+
 void CompilerStack::useMetadataLiteralSources(bool _metadataLiteralSources)
 {
 	if (m_stackState >= ParsingPerformed)
@@ -210,6 +239,9 @@ void CompilerStack::reset(bool _keepSettings)
 		m_enabledSMTSolvers = smtutil::SMTSolverChoice::All();
 		m_generateIR = false;
 		m_generateEwasm = false;
+		m_parallelism = 1;
+		m_cache.reset();
+		m_modelCheckerCache.reset();
 		m_revertStrings = RevertStrings::Default;
 		m_optimiserSettings = OptimiserSettings::minimal();
 		m_metadataLiteralSources = false;
@@ -219,7 +251,7 @@ void CompilerStack::reset(bool _keepSettings)
 	m_sourceOrder.clear();
 	m_contracts.clear();
 	m_errorReporter.clear();
-	TypeProvider::reset();
+	m_typeProvider->clear();
 }
 
 void CompilerStack::setSources(StringMap _sources)
@@ -233,6 +265,24 @@ void CompilerStack::setSources(StringMap _sources)
 	m_stackState = SourcesSet;
 }
 
+namespace
+{
+
+/// Parser of a single source together with the errors it reported.
+struct SourceParser: boost::noncopyable
+{
+	SourceParser(EVMVersion _evmVersion, bool _errorRecovery):
+		parser(errorReporter, _evmVersion, _errorRecovery)
+	{}
+
+	ErrorList errors;
+	ErrorReporter errorReporter{errors};
+	Parser parser;
+	ASTPointer<SourceUnit> ast;
+};
+
+}
+
 bool CompilerStack::parse()
 {
 	if (m_stackState != SourcesSet)
@@ -242,30 +292,63 @@ bool CompilerStack::parse()
 	if (SemVerVersion{string(VersionString)}.isPrerelease())
 		m_errorReporter.warning(3805_error, "This is a pre-release compiler version, please do not use it in production.");
 
-	Parser parser{m_errorReporter, m_evmVersion, m_parserErrorRecovery};
-
+	// The sources are parsed in waves: All sources of a wave are parsed concurrently and the
+	// sources they import form the next wave. Afterwards, the results are processed in the order
+	// of the sources, which is the order sequential parsing with a single parser would use.
+	// Node IDs and errors thus do not depend on the number of threads.
 	vector<string> sourcesToParse;
 	for (auto const& s: m_sources)
 		sourcesToParse.push_back(s.first);
-	for (size_t i = 0; i < sourcesToParse.size(); ++i)
+	util::ThreadPool pool{m_parallelism};
+	int64_t nodeIDCount = 0;
+	for (size_t waveBegin = 0; waveBegin < sourcesToParse.size();)
 	{
-		string const& path = sourcesToParse[i];
-		Source& source = m_sources[path];
-		source.scanner->reset();
-		source.ast = parser.parse(source.scanner);
-		if (!source.ast)
-			solAssert(!Error::containsOnlyWarnings(m_errorReporter.errors()), "Parser returned null but did not report error.");
-		else
+		size_t const waveEnd = sourcesToParse.size();
+		vector<unique_ptr<SourceParser>> parsers;
+		vector<future<void>> parsed;
+		for (size_t i = waveBegin; i < waveEnd; ++i)
+		{
+			parsers.emplace_back(make_unique<SourceParser>(m_evmVersion, m_parserErrorRecovery));
+			SourceParser* sourceParser = parsers.back().get();
+			shared_ptr<Scanner> scanner = m_sources.at(sourcesToParse[i]).scanner;
+			parsed.emplace_back(pool.submit([this, sourceParser, scanner]() {
+				yul::YulStringRepository::Scope yulStringScope{*m_yulStringRepository};
+				scanner->reset();
+				sourceParser->ast = sourceParser->parser.parse(scanner);
+			}));
+		}
+		// All tasks have to finish before the first exception is rethrown.
+		for (auto& result: parsed)
+			result.wait();
+		for (auto& result: parsed)
+			result.get();
+
+		for (size_t i = waveBegin; i < waveEnd; ++i)
 		{
-			source.ast->annotation().path = path;
-			for (auto const& newSource: loadMissingSources(*source.ast, path))
+			string const& path = sourcesToParse[i];
+			SourceParser& sourceParser = *parsers[i - waveBegin];
+			// IDs of the previous sources precede the IDs of this source.
+			sourceParser.parser.shiftNodeIDs(nodeIDCount);
+			nodeIDCount += sourceParser.parser.nodeIDCount();
+			m_errorReporter.append(sourceParser.errors);
+
+			Source& source = m_sources[path];
+			source.ast = sourceParser.ast;
+			if (!source.ast)
+				solAssert(!Error::containsOnlyWarnings(sourceParser.errors), "Parser returned null but did not report error.");
+			else
 			{
-				string const& newPath = newSource.first;
-				string const& newContents = newSource.second;
-				m_sources[newPath].scanner = make_shared<Scanner>(CharStream(newContents, newPath));
-				sourcesToParse.push_back(newPath);
+				source.ast->annotation().path = path;
+				for (auto const& newSource: loadMissingSources(*source.ast, path))
+				{
+					string const& newPath = newSource.first;
+					string const& newContents = newSource.second;
+					m_sources[newPath].scanner = make_shared<Scanner>(CharStream(newContents, newPath));
+					sourcesToParse.push_back(newPath);
+				}
 			}
 		}
+		waveBegin = waveEnd;
 	}
 
 	m_stackState = ParsingPerformed;
@@ -446,7 +529,14 @@ bool CompilerStack::analyze()
 
 		if (noErrors)
 		{
-			ModelChecker modelChecker(m_errorReporter, m_smtlib2Responses, m_readFile, m_enabledSMTSolvers);
+			ModelChecker modelChecker(
+				m_errorReporter,
+				m_smtlib2Responses,
+				m_readFile,
+				m_enabledSMTSolvers,
+				m_parallelism,
+				m_modelCheckerCache
+			);
 			for (Source const* source: m_sourceOrder)
 				if (source->ast)
 					modelChecker.analyze(*source->ast);
@@ -509,20 +599,63 @@ bool CompilerStack::compile()
 	if (m_hasError)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Called compile with errors."));
 
+	resolveGasProfileFunctions();
+
+	// Contracts found in the cache are not compiled, unless the code of another contract
+	// that is not found in the cache depends on them.
+	set<ContractDefinition const*> cachedContracts;
+	if (m_cache)
+		for (Source const* source: m_sourceOrder)
+			for (ASTPointer<ASTNode> const& node: source->ast->nodes())
+				if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
+					if (isRequestedContract(*contract) && contract->canBeDeployed())
+						if (loadFromCache(m_contracts.at(contract->fullyQualifiedName())))
+							cachedContracts.insert(contract);
+
 	// Only compile contracts individually which have been requested.
 	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	vector<ContractDefinition const*> compiledContracts;
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
-				if (isRequestedContract(*contract))
+				if (isRequestedContract(*contract) && !cachedContracts.count(contract))
 				{
-					compileContract(*contract, otherCompilers);
+					compileContract(*contract, otherCompilers, compiledContracts);
 					if (m_generateIR || m_generateEwasm)
 						generateIR(*contract);
 					if (m_generateEwasm)
 						generateEwasm(*contract);
 				}
+	assembleContracts(compiledContracts);
 	m_stackState = CompilationSuccessful;
+
+	if (m_cache)
+		for (ContractDefinition const* contract: compiledContracts)
+			storeInCache(m_contracts.at(contract->fullyQualifiedName()));
+
+	vector<ContractDefinition const*> deployableContracts = compiledContracts;
+	for (ContractDefinition const* contract: cachedContracts)
+		if (!util::contains(compiledContracts, contract))
+			deployableContracts.push_back(contract);
+	for (ContractDefinition const* contract: deployableContracts)
+	{
+		Contract const& compiledContract = m_contracts.at(contract->fullyQualifiedName());
+		// Throw a warning if EIP-170 limits are exceeded:
+		//   If contract creation initialization returns data with length of more than 0x6000 (214 + 213) bytes,
+		//   contract creation fails with an out of gas error.
+		if (
+			m_evmVersion >= langutil::EVMVersion::spuriousDragon() &&
+			compiledContract.runtimeObject.bytecode.size() > 0x6000
+		)
+			m_errorReporter.warning(
+				5574_error,
+				contract->location(),
+				"Contract code size exceeds 24576 bytes (a limit introduced in Spurious Dragon). "
+				"This contract may not be deployable on mainnet. "
+				"Consider enabling the optimizer (with a low \"runs\" value!), "
+				"turning off revert strings, or using libraries."
+			);
+	}
 	this->link();
 	return true;
 }
@@ -689,6 +822,8 @@ string CompilerStack::assemblyString(string const& _contractName, StringMap _sou
 	Contract const& currentContract = contract(_contractName);
 	if (currentContract.compiler)
 		return currentContract.compiler->assemblyString(_sourceCodes);
+	else if (currentContract.cachedAssembly)
+		return *currentContract.cachedAssembly;
 	else
 		return string();
 }
@@ -703,7 +838,7 @@ Json::Value CompilerStack::assemblyJSON(string const& _contractName) const
 	if (currentContract.compiler)
 		return currentContract.compiler->assemblyJSON(sourceIndices());
 	else
-		return Json::Value();
+		return currentContract.cachedAssemblyJSON;
 }
 
 vector<string> CompilerStack::sourceNames() const
@@ -1036,7 +1171,8 @@ bool onlySafeExperimentalFeaturesActivated(set<ExperimentalFeature> const& featu
 
 void CompilerStack::compileContract(
 	ContractDefinition const& _contract,
-	map<ContractDefinition const*, shared_ptr<Compiler const>>& _otherCompilers
+	map<ContractDefinition const*, shared_ptr<Compiler const>>& _otherCompilers,
+	vector<ContractDefinition const*>& _compiledContracts
 )
 {
 	solAssert(m_stackState >= AnalysisPerformed, "");
@@ -1046,11 +1182,12 @@ void CompilerStack::compileContract(
 	if (_otherCompilers.count(&_contract) || !_contract.canBeDeployed())
 		return;
 	for (auto const* dependency: _contract.annotation().contractDependencies)
-		compileContract(*dependency, _otherCompilers);
+		compileContract(*dependency, _otherCompilers, _compiledContracts);
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
 	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	compiler->setCompilationCache(m_cache.get());
 	compiledContract.compiler = compiler;
 
 	bytes cborEncodedMetadata = createCBORMetadata(
@@ -1058,10 +1195,97 @@ void CompilerStack::compileContract(
 		!onlySafeExperimentalFeaturesActivated(_contract.sourceUnit().annotation().experimentalFeatures)
 	);
 
+	compiler->compileContract(_contract, _otherCompilers, cborEncodedMetadata);
+
+	_otherCompilers[compiledContract.contract] = compiler;
+	_compiledContracts.push_back(&_contract);
+}
+
+void CompilerStack::assembleContracts(vector<ContractDefinition const*> const& _contracts)
+{
+	// Optimising a contract also re-optimises the assemblies of all contracts it creates
+	// (directly or indirectly), since they are embedded as sub-assemblies.
+	// Contracts sharing such an assembly are processed in order of compilation, all others
+	// are independent. This keeps the result identical to sequential processing.
+	map<ContractDefinition const*, set<ContractDefinition const*>> embeddedContracts;
+	for (ContractDefinition const* contract: _contracts)
+	{
+		set<ContractDefinition const*>& embedded = embeddedContracts[contract];
+		embedded.insert(contract);
+		// Dependencies are always compiled before the contracts depending on them.
+		for (ContractDefinition const* dependency: contract->annotation().contractDependencies)
+			if (embeddedContracts.count(dependency))
+				embedded += embeddedContracts.at(dependency);
+	}
+
+	size_t const numContracts = _contracts.size();
+	vector<vector<size_t>> successors(numContracts);
+	vector<atomic<size_t>> pendingPredecessors(numContracts);
+	for (size_t i = 0; i < numContracts; ++i)
+		for (size_t j = i + 1; j < numContracts; ++j)
+		{
+			auto const& first = embeddedContracts.at(_contracts[i]);
+			auto const& second = embeddedContracts.at(_contracts[j]);
+			if (any_of(first.begin(), first.end(), [&](auto const* _c) { return second.count(_c); }))
+			{
+				successors[i].push_back(j);
+				++pendingPredecessors[j];
+			}
+		}
+
+	vector<exception_ptr> exceptions(numContracts);
+	vector<atomic<bool>> skip(numContracts);
+	{
+		// Declared before the pool, whose destructor waits for the tasks that still use it.
+		function<void(size_t)> process;
+		util::ThreadPool pool{min(m_parallelism, numContracts)};
+		// The threads that are not needed for contracts running concurrently
+		// are used to optimise the contracts themselves.
+		size_t const threadsPerContract = max<size_t>(m_parallelism / pool.threads(), 1);
+		process = [&](size_t _index)
+		{
+			if (!skip[_index])
+				try
+				{
+					assembleContract(m_contracts.at(_contracts[_index]->fullyQualifiedName()), threadsPerContract);
+				}
+				catch (...)
+				{
+					exceptions[_index] = current_exception();
+				}
+			for (size_t successor: successors[_index])
+			{
+				if (exceptions[_index] || skip[_index])
+					skip[successor] = true;
+				if (--pendingPredecessors[successor] == 0)
+					pool.submit([&process, successor]() { process(successor); });
+			}
+		};
+		// The contracts without predecessors are determined before the first one is processed,
+		// since processing a contract can already reduce the counts of its successors to zero.
+		vector<size_t> independent;
+		for (size_t i = 0; i < numContracts; ++i)
+			if (pendingPredecessors[i] == 0)
+				independent.push_back(i);
+		for (size_t i: independent)
+			pool.submit([&process, i]() { process(i); });
+	}
+
+	// Report the first failure in order of compilation, just like sequential processing would.
+	for (exception_ptr const& exception: exceptions)
+		if (exception)
+			rethrow_exception(exception);
+}
+
+void CompilerStack::assembleContract(Contract& _compiledContract, size_t _threads)
+{
+	solAssert(_compiledContract.compiler, "");
+	Compiler& compiler = *_compiledContract.compiler;
+
 	try
 	{
-		// Run optimiser and compile the contract.
-		compiler->compileContract(_contract, _otherCompilers, cborEncodedMetadata);
+		// Run optimiser.
+		compiler.optimise(_threads);
 	}
 	catch(evmasm::OptimizerException const&)
 	{
@@ -1071,7 +1295,7 @@ void CompilerStack::compileContract(
 	try
 	{
 		// Assemble deployment (incl. runtime)  object.
-		compiledContract.object = compiler->assembledObject();
+		_compiledContract.object = compiler.assembledObject();
 	}
 	catch(evmasm::AssemblyException const&)
 	{
@@ -1081,30 +1305,120 @@ void CompilerStack::compileContract(
 	try
 	{
 		// Assemble runtime object.
-		compiledContract.runtimeObject = compiler->runtimeObject();
+		_compiledContract.runtimeObject = compiler.runtimeObject();
 	}
 	catch(evmasm::AssemblyException const&)
 	{
 		solAssert(false, "Assembly exception for deployed bytecode");
 	}
+}
+
+void CompilerStack::resolveGasProfileFunctions()
+{
+	if (!m_optimiserSettings.gasProfile || m_optimiserSettings.gasProfile->functions().empty())
+		return;
+
+	evmasm::GasProfile profile = *m_optimiserSettings.gasProfile;
+	for (auto const& [sourceName, contracts]: profile.functions())
+	{
+		if (!m_sources.count(sourceName) || !m_sources.at(sourceName).ast)
+			continue;
+		for (ASTPointer<ASTNode> const& node: m_sources.at(sourceName).ast->nodes())
+			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
+				if (auto functions = contracts.find(contract->name()); functions != contracts.end())
+					for (FunctionDefinition const* function: contract->definedFunctions())
+					{
+						string name = function->name();
+						if (function->isFallback())
+							name = "fallback";
+						else if (function->isReceive())
+							name = "receive";
+						if (auto executions = functions->second.find(name); executions != functions->second.end())
+							profile.addRange({
+								sourceName,
+								function->location().start,
+								function->location().end,
+								executions->second
+							});
+					}
+	}
+	// The hash stays the same, so this does not change the metadata.
+	m_optimiserSettings.gasProfile = make_shared<evmasm::GasProfile const>(move(profile));
+}
 
-	// Throw a warning if EIP-170 limits are exceeded:
-	//   If contract creation initialization returns data with length of more than 0x6000 (214 + 213) bytes,
-	//   contract creation fails with an out of gas error.
+h256 CompilerStack::cacheKey(Contract const& _contract) const
+{
+	// The metadata covers the compiler version, the settings and the hashes of all
+	// sources the contract depends on. The source indices in source mappings depend on
+	// all the other sources as well.
+	Json::Value key{Json::objectValue};
+	key["version"] = VersionString;
+	key["metadata"] = metadata(_contract);
+	key["sources"] = Json::arrayValue;
+	for (string const& sourceName: sourceNames())
+		key["sources"].append(sourceName + ":" + source(sourceName).keccak256().hex());
+	key["ir"] = m_generateIR || m_generateEwasm;
+	key["ewasm"] = m_generateEwasm;
+	return util::keccak256(util::jsonCompactPrint(key));
+}
+
+bool CompilerStack::loadFromCache(Contract& _contract)
+{
+	solAssert(m_cache, "");
+	optional<Json::Value> entry = m_cache->load(cacheKey(_contract));
+	if (!entry)
+		return false;
+
+	optional<evmasm::LinkerObject> object = CompilationCache::linkerObjectFromJson((*entry)["object"]);
+	optional<evmasm::LinkerObject> runtimeObject = CompilationCache::linkerObjectFromJson((*entry)["runtimeObject"]);
+	optional<evmasm::LinkerObject> ewasmObject = CompilationCache::linkerObjectFromJson((*entry)["ewasmObject"]);
 	if (
-		m_evmVersion >= langutil::EVMVersion::spuriousDragon() &&
-		compiledContract.runtimeObject.bytecode.size() > 0x6000
+		!object ||
+		!runtimeObject ||
+		!ewasmObject ||
+		!(*entry)["assembly"].isString() ||
+		!(*entry)["sourceMap"].isString() ||
+		!(*entry)["runtimeSourceMap"].isString() ||
+		!(*entry)["ir"].isString() ||
+		!(*entry)["irOptimized"].isString() ||
+		!(*entry)["ewasm"].isString()
 	)
-		m_errorReporter.warning(
-			5574_error,
-			_contract.location(),
-			"Contract code size exceeds 24576 bytes (a limit introduced in Spurious Dragon). "
-			"This contract may not be deployable on mainnet. "
-			"Consider enabling the optimizer (with a low \"runs\" value!), "
-			"turning off revert strings, or using libraries."
-		);
+		return false;
+
+	_contract.object = move(*object);
+	_contract.runtimeObject = move(*runtimeObject);
+	_contract.cachedAssembly = (*entry)["assembly"].asString();
+	_contract.cachedAssemblyJSON = (*entry)["legacyAssembly"];
+	_contract.sourceMapping.emplace((*entry)["sourceMap"].asString());
+	_contract.runtimeSourceMapping.emplace((*entry)["runtimeSourceMap"].asString());
+	_contract.yulIR = (*entry)["ir"].asString();
+	_contract.yulIROptimized = (*entry)["irOptimized"].asString();
+	_contract.ewasm = (*entry)["ewasm"].asString();
+	_contract.ewasmObject = move(*ewasmObject);
+	return true;
+}
 
-	_otherCompilers[compiledContract.contract] = compiler;
+void CompilerStack::storeInCache(Contract const& _contract) const
+{
+	solAssert(m_cache && _contract.compiler, "");
+	string const& name = _contract.contract->fullyQualifiedName();
+
+	StringMap sourceCodes;
+	for (auto const& [sourceName, source]: m_sources)
+		sourceCodes[sourceName] = source.scanner->source();
+
+	Json::Value entry{Json::objectValue};
+	entry["object"] = CompilationCache::linkerObjectToJson(_contract.object);
+	entry["runtimeObject"] = CompilationCache::linkerObjectToJson(_contract.runtimeObject);
+	entry["assembly"] = assemblyString(name, sourceCodes);
+	entry["legacyAssembly"] = assemblyJSON(name);
+	entry["sourceMap"] = *sourceMapping(name);
+	entry["runtimeSourceMap"] = *runtimeSourceMapping(name);
+	entry["ir"] = _contract.yulIR;
+	entry["irOptimized"] = _contract.yulIROptimized;
+	entry["ewasm"] = _contract.ewasm;
+	entry["ewasmObject"] = CompilationCache::linkerObjectToJson(_contract.ewasmObject);
+	m_cache->store(cacheKey(_contract), entry);
 }
 
 void CompilerStack::generateIR(ContractDefinition const& _contract)
@@ -1255,6 +1569,11 @@ string CompilerStack::createMetadata(Contract const& _contract) const
 		details["deduplicate"] = m_optimiserSettings.runDeduplicate;
 		details["cse"] = m_optimiserSettings.runCSE;
 		details["constantOptimizer"] = m_optimiserSettings.runConstantOptimiser;
+		// Only present if enabled, so that the metadata of existing settings does not change.
+		if (m_optimiserSettings.runSuperoptimiser)
+			details["superoptimizer"] = true;
+		if (m_optimiserSettings.gasProfile)
+			details["gasProfile"] = "0x" + m_optimiserSettings.gasProfile->hash().hex();
 		details["yul"] = m_optimiserSettings.runYulOptimiser;
 		if (m_optimiserSettings.runYulOptimiser)
 		{
@@ -1418,6 +1737,9 @@ Json::Value CompilerStack::gasEstimates(string const& _contractName) const
 	if (m_stackState != CompilationSuccessful)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Compilation was not successful."));
 
+	if (contract(_contractName).cachedAssembly)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Gas estimates are not available for contracts loaded from the compilation cache."));
+
 	if (!assemblyItems(_contractName) && !runtimeAssemblyItems(_contractName))
 		return Json::Value();
 
@@ -29,6 +29,7 @@
 #include <libsolidity/interface/Version.h>
 #include <libsolidity/interface/DebugSettings.h>
 
+#include <libsmtutil/SMTQueryCache.h>
 #include <libsmtutil/SolverInterface.h>
 
 #include <liblangutil/ErrorReporter.h>
@@ -44,6 +45,7 @@
 #include <boost/noncopyable.hpp>
 #include <json/json.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <ostream>
@@ -57,6 +59,11 @@ class Scanner;
 }
 
 
+namespace solidity::yul
+{
+class YulStringRepository;
+}
+
 namespace solidity::evmasm
 {
 class Assembly;
@@ -76,6 +83,8 @@ class Compiler;
 class GlobalContext;
 class Natspec;
 class DeclarationContainer;
+class TypeProvider;
+class CompilationCache;
 
 /**
  * Easy to use and self-contained Solidity compiler with as few header dependencies as possible.
@@ -83,6 +92,12 @@ class DeclarationContainer;
  * before compilation to bytecode) or run the whole compilation in one call.
  * If error recovery is active, it is possible to progress through the stages even when
  * there are errors. In any case, producing code is only possible without errors.
+ *
+ * The types and YulStrings of a compilation are owned by the TypeProvider and the
+ * YulStringRepository of its CompilerStack, which are made the current ones of the constructing
+ * thread. Hence a CompilerStack can only be used from the thread that created it, and there can
+ * only be one CompilerStack per thread at a time.
+ * CompilerStacks on different threads are independent of each other.
  */
 class CompilerStack: boost::noncopyable
 {
@@ -121,6 +136,9 @@ public:
 	/// @returns the current state.
 	State state() const { return m_stackState; }
 
+	/// @returns the type provider owning the types of this compilation.
+	TypeProvider const& typeProvider() const { return *m_typeProvider; }
+
 	bool hasError() const { return m_hasError; }
 
 	bool compilationSuccessful() const { return m_stackState >= CompilationSuccessful; }
@@ -182,6 +200,22 @@ public:
 	/// Enable experimental generation of Ewasm code. If enabled, IR is also generated.
 	void enableEwasmGeneration(bool _enable = true) { m_generateEwasm = _enable; }
 
+	/// Sets the number of threads used to parse the sources, to optimise and assemble the
+	/// compiled contracts and to solve the queries of the SMTChecker.
+	/// Values of 0 and 1 disable parallel processing. The output does not depend on this setting.
+	void setParallelism(size_t _threads) { m_parallelism = std::max<size_t>(_threads, 1); }
+
+	/// Enables the on-disk cache of compiled contracts in @a _directory.
+	/// Contracts found in the cache are not compiled again. Assembly items and thus gas
+	/// estimates are not available for them, so the cache must not be used if those are needed.
+	/// An empty string disables the cache.
+	void setCacheDirectory(std::string const& _directory);
+
+	/// Enables the on-disk cache of the results of the SMT solvers used by the SMTChecker
+	/// in @a _directory. Queries found in the cache are not solved again.
+	/// An empty string disables the cache.
+	void setModelCheckerCacheDirectory(std::string const& _directory);
+
 	/// @arg _metadataLiteralSources When true, store sources as literals in the contract metadata.
 	/// Must be set before parsing.
 	void useMetadataLiteralSources(bool _metadataLiteralSources);
@@ -268,10 +302,12 @@ public:
 	/// @returns the runtime object for the contract.
 	evmasm::LinkerObject const& runtimeObject(std::string const& _contractName) const;
 
-	/// @returns normal contract assembly items
+	/// @returns normal contract assembly items or nullptr if the contract was not compiled
+	/// or loaded from the compilation cache
 	evmasm::AssemblyItems const* assemblyItems(std::string const& _contractName) const;
 
-	/// @returns runtime contract assembly items
+	/// @returns runtime contract assembly items or nullptr if the contract was not compiled
+	/// or loaded from the compilation cache
 	evmasm::AssemblyItems const* runtimeAssemblyItems(std::string const& _contractName) const;
 
 	/// @returns the string that provides a mapping between bytecode and sourcecode or a nullptr
@@ -315,6 +351,7 @@ public:
 	std::string const& metadata(std::string const& _contractName) const;
 
 	/// @returns a JSON representing the estimated gas usage for contract creation, internal and external functions
+	/// Throws a CompilerError if the contract was loaded from the compilation cache.
 	Json::Value gasEstimates(std::string const& _contractName) const;
 
 	/// Overwrites the release/prerelease flag. Should only be used for testing.
@@ -352,6 +389,9 @@ private:
 		util::LazyInit<Json::Value const> devDocumentation;
 		mutable std::optional<std::string const> sourceMapping;
 		mutable std::optional<std::string const> runtimeSourceMapping;
+		/// Text and JSON representation of the assembly if the contract was loaded from the cache.
+		std::optional<std::string> cachedAssembly;
+		Json::Value cachedAssemblyJSON;
 	};
 
 	/// Loads the missing sources from @a _ast (named @a _path) using the callback
@@ -367,14 +407,37 @@ private:
 	/// @returns true if the contract is requested to be compiled.
 	bool isRequestedContract(ContractDefinition const& _contract) const;
 
-	/// Compile a single contract.
+	/// Generate the (unoptimised) assembly of a single contract and of the contracts it depends on.
 	/// @param _otherCompilers provides access to compilers of other contracts, to get
 	///                        their bytecode if needed. Only filled after they have been compiled.
+	/// @param _compiledContracts the contracts compiled so far, in order of compilation.
 	void compileContract(
 		ContractDefinition const& _contract,
-		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers
+		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers,
+		std::vector<ContractDefinition const*>& _compiledContracts
 	);
 
+	/// Optimise and assemble the given contracts, using up to m_parallelism threads.
+	/// @param _contracts the compiled contracts in order of compilation.
+	void assembleContracts(std::vector<ContractDefinition const*> const& _contracts);
+
+	/// Optimise and assemble a single compiled contract, using @a _threads threads to optimise it.
+	void assembleContract(Contract& _compiledContract, size_t _threads = 1);
+
+	/// Adds the ranges of the function definitions the gas profile lists by name to it.
+	void resolveGasProfileFunctions();
+
+	/// @returns the key of the given contract in the compilation cache. It covers everything
+	/// the compilation result of the contract depends on.
+	util::h256 cacheKey(Contract const& _contract) const;
+
+	/// Fills the compilation results of @a _contract from the cache.
+	/// @returns false if there is no usable cache entry for the contract.
+	bool loadFromCache(Contract& _contract);
+
+	/// Stores the compilation results of @a _contract in the cache.
+	void storeInCache(Contract const& _contract) const;
+
 	/// Generate Yul IR for a single contract.
 	/// The IR is stored but otherwise unused.
 	void generateIR(ContractDefinition const& _contract);
@@ -431,14 +494,22 @@ private:
 		FunctionDefinition const& _function
 	) const;
 
+	/// Declared first so that it is destroyed after everything that might refer to types.
+	std::unique_ptr<TypeProvider> m_typeProvider;
+	std::unique_ptr<yul::YulStringRepository> m_yulStringRepository;
+	/// Repository that was current before this CompilerStack was created.
+	yul::YulStringRepository* m_previousYulStringRepository = nullptr;
 	ReadCallback::Callback m_readFile;
 	OptimiserSettings m_optimiserSettings;
 	RevertStrings m_revertStrings = RevertStrings::Default;
+	std::unique_ptr<CompilationCache const> m_cache;
+	std::shared_ptr<smtutil::SMTQueryCache const> m_modelCheckerCache;
 	langutil::EVMVersion m_evmVersion;
 	smtutil::SMTSolverChoice m_enabledSMTSolvers;
 	std::map<std::string, std::set<std::string>> m_requestedContractNames;
 	bool m_generateIR;
 	bool m_generateEwasm;
+	size_t m_parallelism = 1;
 	std::map<std::string, util::h160> m_libraries;
 	/// list of path prefix remappings, e.g. mylibrary: github.com/ethereum = /usr/local/ethereum
 	/// "context:prefix=target"
@@ -23,7 +23,10 @@
 
 #pragma once
 
+#include <libevmasm/GasProfile.h>
+
 #include <cstddef>
+#include <memory>
 #include <string>
 
 namespace solidity::frontend
@@ -92,10 +95,13 @@ struct OptimiserSettings
 			runDeduplicate == _other.runDeduplicate &&
 			runCSE == _other.runCSE &&
 			runConstantOptimiser == _other.runConstantOptimiser &&
+			runSuperoptimiser == _other.runSuperoptimiser &&
 			optimizeStackAllocation == _other.optimizeStackAllocation &&
 			runYulOptimiser == _other.runYulOptimiser &&
 			yulOptimiserSteps == _other.yulOptimiserSteps &&
-			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment;
+			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment &&
+			!gasProfile == !_other.gasProfile &&
+			(!gasProfile || gasProfile->hash() == _other.gasProfile->hash());
 	}
 
 	/// Move literals to the right of commutative binary operators during code generation.
@@ -112,6 +118,9 @@ struct OptimiserSettings
 	/// Constant optimizer, which tries to find better representations that satisfy the given
 	/// size/cost-trade-off.
 	bool runConstantOptimiser = false;
+	/// Replace short sequences of stack operations by the cheaper equivalents found offline
+	/// by the superoptimiser, as part of the peephole optimiser.
+	bool runSuperoptimiser = false;
 	/// Perform more efficient stack allocation for variables during code generation from Yul to bytecode.
 	bool optimizeStackAllocation = false;
 	/// Yul optimiser with default settings. Will only run on certain parts of the code for now.
@@ -124,6 +133,9 @@ struct OptimiserSettings
 	/// This specifies an estimate on how often each opcode in this assembly will be executed,
 	/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 	size_t expectedExecutionsPerDeployment = 200;
+	/// Execution counts of parts of the runtime code that replace expectedExecutionsPerDeployment
+	/// there, e.g. taken from traces. Can be null.
+	std::shared_ptr<evmasm::GasProfile const> gasProfile;
 };
 
 }
@@ -24,10 +24,13 @@
 #include <libsolidity/interface/StandardCompiler.h>
 
 #include <libsolidity/ast/ASTJsonConverter.h>
+#include <libsolidity/interface/CompilationCache.h>
+#include <libsolidity/interface/Version.h>
 #include <libyul/AssemblyStack.h>
 #include <libyul/Exceptions.h>
 #include <libyul/optimiser/Suite.h>
 #include <liblangutil/SourceReferenceFormatter.h>
+#include <libevmasm/GasProfile.h>
 #include <libevmasm/Instruction.h>
 #include <libsmtutil/Exceptions.h>
 #include <libsolutil/JSON.h>
@@ -257,6 +260,28 @@ bool isBinaryRequested(Json::Value const& _outputSelection)
 	return false;
 }
 
+/// @returns true if gas estimates were requested for any contract.
+bool areGasEstimatesRequested(Json::Value const& _outputSelection)
+{
+	if (!_outputSelection.isObject())
+		return false;
+
+	for (auto const& fileRequests: _outputSelection)
+		for (auto const& requests: fileRequests)
+			if (isArtifactRequested(requests, "evm.gasEstimates", false))
+				return true;
+	return false;
+}
+
+/// @returns true if @a _output contains an error that is not a warning.
+bool hasErrors(Json::Value const& _output)
+{
+	for (auto const& error: _output["errors"])
+		if (error["severity"] != "warning")
+			return true;
+	return false;
+}
+
 /// @returns true if any Ewasm code was requested. Note that as an exception, '*' does not
 /// yet match "ewasm.wast" or "ewasm"
 bool isEwasmRequested(Json::Value const& _outputSelection)
@@ -384,19 +409,19 @@ std::optional<Json::Value> checkAuxiliaryInputKeys(Json::Value const& _input)
 
 std::optional<Json::Value> checkSettingsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "optimizer", "outputSelection", "remappings"};
+	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "optimizer", "outputSelection", "parallelism", "remappings"};
 	return checkKeys(_input, keys, "settings");
 }
 
 std::optional<Json::Value> checkOptimizerKeys(Json::Value const& _input)
 {
-	static set<string> keys{"details", "enabled", "runs"};
+	static set<string> keys{"details", "enabled", "gasProfile", "runs"};
 	return checkKeys(_input, keys, "settings.optimizer");
 }
 
 std::optional<Json::Value> checkOptimizerDetailsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"peephole", "jumpdestRemover", "orderLiterals", "deduplicate", "cse", "constantOptimizer", "yul", "yulDetails"};
+	static set<string> keys{"peephole", "jumpdestRemover", "orderLiterals", "deduplicate", "cse", "constantOptimizer", "superoptimizer", "yul", "yulDetails"};
 	return checkKeys(_input, keys, "settings.optimizer.details");
 }
 
@@ -521,6 +546,18 @@ std::variant<OptimiserSettings, Json::Value> parseOptimizerSettings(Json::Value
 		settings.expectedExecutionsPerDeployment = _jsonInput["runs"].asUInt();
 	}
 
+	if (_jsonInput.isMember("gasProfile"))
+	{
+		try
+		{
+			settings.gasProfile = make_shared<evmasm::GasProfile const>(evmasm::GasProfile::fromJson(_jsonInput["gasProfile"]));
+		}
+		catch (evmasm::GasProfileError const& _error)
+		{
+			return formatFatalError("JSONError", "Invalid \"gasProfile\" setting: " + *boost::get_error_info<util::errinfo_comment>(_error));
+		}
+	}
+
 	if (_jsonInput.isMember("details"))
 	{
 		Json::Value const& details = _jsonInput["details"];
@@ -539,6 +576,8 @@ std::variant<OptimiserSettings, Json::Value> parseOptimizerSettings(Json::Value
 			return *error;
 		if (auto error = checkOptimizerDetail(details, "constantOptimizer", settings.runConstantOptimiser))
 			return *error;
+		if (auto error = checkOptimizerDetail(details, "superoptimizer", settings.runSuperoptimiser))
+			return *error;
 		if (auto error = checkOptimizerDetail(details, "yul", settings.runYulOptimiser))
 			return *error;
 		settings.optimizeStackAllocation = settings.runYulOptimiser;
@@ -754,6 +793,13 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 			ret.optimiserSettings = std::get<OptimiserSettings>(std::move(optimiserSettings));
 	}
 
+	if (settings.isMember("parallelism"))
+	{
+		if (!settings["parallelism"].isUInt() || settings["parallelism"].asUInt() == 0)
+			return formatFatalError("JSONError", "\"settings.parallelism\" must be a positive integer.");
+		ret.parallelism = settings["parallelism"].asUInt();
+	}
+
 	Json::Value jsonLibraries = settings.get("libraries", Json::Value(Json::objectValue));
 	if (!jsonLibraries.isObject())
 		return formatFatalError("JSONError", "\"libraries\" is not a JSON object.");
@@ -844,6 +890,11 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 
 	compilerStack.enableEwasmGeneration(isEwasmRequested(_inputsAndSettings.outputSelection));
 
+	compilerStack.setParallelism(_inputsAndSettings.parallelism);
+	// Gas estimates need the assembly items, which are not stored for contracts in the cache.
+	compilerStack.setCacheDirectory(areGasEstimatesRequested(_inputsAndSettings.outputSelection) ? "" : m_cacheDirectory);
+	compilerStack.setModelCheckerCacheDirectory(m_modelCheckerCacheDirectory);
+
 	Json::Value errors = std::move(_inputsAndSettings.errors);
 
 	bool const binariesRequested = isBinaryRequested(_inputsAndSettings.outputSelection);
@@ -974,6 +1025,12 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	if (compilerStack.hasError() && !_inputsAndSettings.parserErrorRecovery)
 		analysisPerformed = false;
 
+	// Sources loaded through the read callback are not part of the input, but the output depends on them.
+	if (analysisPerformed)
+		for (string const& sourceName: compilerStack.sourceNames())
+			if (!sourceList.count(sourceName))
+				m_importedSources[sourceName] = util::keccak256(compilerStack.scanner(sourceName).source());
+
 	/// Inconsistent state - stop here to receive error reports from users
 	if (((binariesRequested && !compilationSuccess) || !analysisPerformed) && errors.empty())
 		return formatFatalError("InternalCompilerError", "No error reported, but compilation failed.");
@@ -1182,7 +1239,8 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 
 Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 {
-	YulStringRepository::reset();
+	// Frees all YulStrings of this compilation once it is done.
+	YulStringRepository::Scope yulStringScope;
 
 	try
 	{
@@ -1190,12 +1248,27 @@ Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 		if (std::holds_alternative<Json::Value>(parsed))
 			return std::get<Json::Value>(std::move(parsed));
 		InputsAndSettings settings = std::get<InputsAndSettings>(std::move(parsed));
+
+		optional<util::h256> cacheKey;
+		if (!m_cacheDirectory.empty())
+		{
+			cacheKey = outputCacheKey(_input, settings);
+			if (optional<Json::Value> output = loadOutputFromCache(*cacheKey))
+				return std::move(*output);
+		}
+
+		m_importedSources.clear();
+		Json::Value output;
 		if (settings.language == "Solidity")
-			return compileSolidity(std::move(settings));
+			output = compileSolidity(std::move(settings));
 		else if (settings.language == "Yul")
-			return compileYul(std::move(settings));
+			output = compileYul(std::move(settings));
 		else
 			return formatFatalError("JSONError", "Only \"Solidity\" or \"Yul\" is supported as a language.");
+
+		if (cacheKey && !hasErrors(output))
+			storeOutputInCache(*cacheKey, output);
+		return output;
 	}
 	catch (Json::LogicError const& _exception)
 	{
@@ -1215,6 +1288,51 @@ Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 	}
 }
 
+util::h256 StandardCompiler::outputCacheKey(Json::Value const& _input, InputsAndSettings const& _inputsAndSettings)
+{
+	// Sources are given by their hashes, since they can also be specified by URLs.
+	// The number of threads does not change the output.
+	Json::Value key{Json::objectValue};
+	key["version"] = VersionString;
+	key["language"] = _input["language"];
+	key["settings"] = _input["settings"];
+	key["settings"].removeMember("parallelism");
+	key["auxiliaryInput"] = _input["auxiliaryInput"];
+	key["sources"] = Json::objectValue;
+	for (auto const& [sourceName, content]: _inputsAndSettings.sources)
+		key["sources"][sourceName] = util::keccak256(content).hex();
+	return util::keccak256(util::jsonCompactPrint(key));
+}
+
+optional<Json::Value> StandardCompiler::loadOutputFromCache(util::h256 const& _key) const
+{
+	optional<Json::Value> entry = CompilationCache(m_cacheDirectory).load(_key);
+	if (!entry || !(*entry)["output"].isObject() || !(*entry)["importedSources"].isObject())
+		return nullopt;
+
+	// The imported files may have changed since the entry was stored.
+	Json::Value const& importedSources = (*entry)["importedSources"];
+	for (string const& sourceName: importedSources.getMemberNames())
+	{
+		if (!m_readFile || !importedSources[sourceName].isString())
+			return nullopt;
+		ReadCallback::Result result = m_readFile(ReadCallback::kindString(ReadCallback::Kind::ReadFile), sourceName);
+		if (!result.success || util::keccak256(result.responseOrErrorMessage).hex() != importedSources[sourceName].asString())
+			return nullopt;
+	}
+	return (*entry)["output"];
+}
+
+void StandardCompiler::storeOutputInCache(util::h256 const& _key, Json::Value const& _output) const
+{
+	Json::Value entry{Json::objectValue};
+	entry["output"] = _output;
+	entry["importedSources"] = Json::objectValue;
+	for (auto const& [sourceName, hash]: m_importedSources)
+		entry["importedSources"][sourceName] = hash.hex();
+	CompilationCache(m_cacheDirectory).store(_key, entry);
+}
+
 string StandardCompiler::compile(string const& _input) noexcept
 {
 	Json::Value input;
@@ -54,6 +54,15 @@ public:
 	/// output. Parsing errors are returned as regular errors.
 	std::string compile(std::string const& _input) noexcept;
 
+	/// Enables the on-disk cache of compiled contracts in @a _directory,
+	/// see CompilerStack::setCacheDirectory. The complete output is stored there as well
+	/// and returned without parsing the sources if the input and the imported files match.
+	/// Outputs with errors are not stored.
+	void setCacheDirectory(std::string _directory) { m_cacheDirectory = std::move(_directory); }
+	/// Enables the on-disk cache of SMT query results in @a _directory,
+	/// see CompilerStack::setModelCheckerCacheDirectory.
+	void setModelCheckerCacheDirectory(std::string _directory) { m_modelCheckerCacheDirectory = std::move(_directory); }
+
 private:
 	struct InputsAndSettings
 	{
@@ -66,6 +75,7 @@ private:
 		std::vector<CompilerStack::Remapping> remappings;
 		RevertStrings revertStrings = RevertStrings::Default;
 		OptimiserSettings optimiserSettings = OptimiserSettings::minimal();
+		size_t parallelism = 1;
 		std::map<std::string, util::h160> libraries;
 		bool metadataLiteralSources = false;
 		CompilerStack::MetadataHash metadataHash = CompilerStack::MetadataHash::IPFS;
@@ -79,7 +89,19 @@ private:
 	Json::Value compileSolidity(InputsAndSettings _inputsAndSettings);
 	Json::Value compileYul(InputsAndSettings _inputsAndSettings);
 
+	/// @returns the key of the output for @a _input in the compilation cache.
+	static util::h256 outputCacheKey(Json::Value const& _input, InputsAndSettings const& _inputsAndSettings);
+	/// @returns the output stored under @a _key or nullopt if there is none or if one of the
+	/// files imported by the sources has changed since.
+	std::optional<Json::Value> loadOutputFromCache(util::h256 const& _key) const;
+	/// Stores @a _output together with the hashes of the files imported by the last compilation.
+	void storeOutputInCache(util::h256 const& _key, Json::Value const& _output) const;
+
 	ReadCallback::Callback m_readFile;
+	/// Hashes of the sources of the last compilation that were loaded through @a m_readFile.
+	std::map<std::string, util::h256> m_importedSources;
+	std::string m_cacheDirectory;
+	std::string m_modelCheckerCacheDirectory;
 };
 
 }
@@ -65,7 +65,7 @@ public:
 		solAssert(m_location.source, "");
 		if (m_location.end < 0)
 			markEndPosition();
-		return make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
+		return m_parser.registerNode(make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...));
 	}
 
 	SourceLocation const& location() const noexcept { return m_location; }
@@ -122,6 +122,13 @@ ASTPointer<SourceUnit> Parser::parse(shared_ptr<Scanner> const& _scanner)
 	}
 }
 
+void Parser::shiftNodeIDs(int64_t _offset)
+{
+	for (auto const& weakNode: m_nodes)
+		if (auto node = weakNode.lock())
+			node->shiftID(_offset);
+}
+
 void Parser::parsePragmaVersion(SourceLocation const& _location, vector<Token> const& _tokens, vector<string> const& _literals)
 {
 	SemVerMatchExpressionParser parser(_tokens, _literals);
@@ -171,7 +178,7 @@ ASTPointer<PragmaDirective> Parser::parsePragmaDirective()
 			parserError(6281_error, "Token incompatible with Solidity parser as part of pragma directive.");
 		else
 		{
-			string literal = m_scanner->currentLiteral();
+			string literal{m_scanner->currentLiteral()};
 			if (literal.empty() && TokenTraits::toString(token))
 				literal = TokenTraits::toString(token);
 			literals.push_back(literal);
@@ -1241,7 +1248,7 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 		BOOST_THROW_EXCEPTION(FatalError());
 
 	location.end = block->location.end;
-	return make_shared<InlineAssembly>(nextID(), location, _docString, dialect, block);
+	return registerNode(make_shared<InlineAssembly>(nextID(), location, _docString, dialect, block));
 }
 
 ASTPointer<IfStatement> Parser::parseIfStatement(ASTPointer<ASTString> const& _docString)
@@ -1856,7 +1863,7 @@ ASTPointer<Expression> Parser::parsePrimaryExpression()
 	case Token::StringLiteral:
 	case Token::HexStringLiteral:
 	{
-		string literal = m_scanner->currentLiteral();
+		string literal{m_scanner->currentLiteral()};
 		Token firstToken = m_scanner->currentToken();
 		while (m_scanner->peekNextToken() == firstToken)
 		{
@@ -2215,9 +2222,15 @@ ASTPointer<ASTString> Parser::expectIdentifierToken()
 
 ASTPointer<ASTString> Parser::getLiteralAndAdvance()
 {
-	ASTPointer<ASTString> identifier = make_shared<ASTString>(m_scanner->currentLiteral());
+	string_view literal = m_scanner->currentLiteral();
+	auto interned = m_literals.find(literal);
+	if (interned == m_literals.end())
+	{
+		auto value = make_shared<ASTString>(literal);
+		interned = m_literals.emplace(*value, value).first;
+	}
 	m_scanner->next();
-	return identifier;
+	return interned->second;
 }
 
 }
@@ -27,6 +27,9 @@
 #include <liblangutil/ParserBase.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <string_view>
+#include <unordered_map>
+
 namespace solidity::langutil
 {
 class Scanner;
@@ -49,6 +52,12 @@ public:
 
 	ASTPointer<SourceUnit> parse(std::shared_ptr<langutil::Scanner> const& _scanner);
 
+	/// @returns the number of node IDs assigned by this parser so far.
+	int64_t nodeIDCount() const { return m_currentNodeID; }
+	/// Adds @a _offset to the IDs of all nodes created by this parser that still exist.
+	/// Used to combine sources parsed by different parsers into one ID space.
+	void shiftNodeIDs(int64_t _offset);
+
 private:
 	class ASTNodeFactory;
 
@@ -180,6 +189,13 @@ private:
 
 	/// Returns the next AST node ID
 	int64_t nextID() { return ++m_currentNodeID; }
+	/// Registers a newly created node, so that its ID can be shifted later.
+	template <class NodeType>
+	ASTPointer<NodeType> registerNode(ASTPointer<NodeType> _node)
+	{
+		m_nodes.emplace_back(_node);
+		return _node;
+	}
 
 	std::pair<LookAheadInfo, IndexAccessedPath> tryParseIndexAccessedPath();
 	/// Performs limited look-ahead to distinguish between variable declaration and expression statement.
@@ -208,6 +224,11 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	/// Counter for the next AST node ID
 	int64_t m_currentNodeID = 0;
+	/// All nodes created by the parser.
+	std::vector<std::weak_ptr<ASTNode>> m_nodes;
+	/// Identifiers and number literals, so that each of them is only copied from the source once.
+	/// The keys refer to the values.
+	std::unordered_map<std::string_view, ASTPointer<ASTString>> m_literals;
 };
 
 }
@@ -69,6 +69,31 @@ string solidity::util::readFileAsString(string const& _file)
 	return readFile<string>(_file);
 }
 
+bool solidity::util::writeFileAtomically(string const& _file, string const& _content)
+{
+	boost::filesystem::path file(_file);
+	boost::filesystem::path temporaryFile =
+		file.parent_path() /
+		boost::filesystem::unique_path(file.filename().string() + "-%%%%%%%%.tmp");
+	boost::system::error_code error;
+	{
+		ofstream output(temporaryFile.string(), ios::binary);
+		output << _content;
+		if (!output)
+		{
+			boost::filesystem::remove(temporaryFile, error);
+			return false;
+		}
+	}
+	boost::filesystem::rename(temporaryFile, file, error);
+	if (error)
+	{
+		boost::filesystem::remove(temporaryFile, error);
+		return false;
+	}
+	return true;
+}
+
 string solidity::util::readStandardInput()
 {
 	string ret;
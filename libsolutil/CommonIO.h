@@ -35,6 +35,11 @@ namespace solidity::util
 /// If the file doesn't exist or isn't readable, returns an empty container / bytes.
 std::string readFileAsString(std::string const& _file);
 
+/// Writes @a _content to the file @a _file by writing to a temporary file in the same directory
+/// first and renaming it, so that concurrent readers never see a partially written file.
+/// @returns false if the file could not be written.
+bool writeFileAtomically(std::string const& _file, std::string const& _content);
+
 /// Retrieve and returns the contents of standard input (until EOF).
 std::string readStandardInput();
 
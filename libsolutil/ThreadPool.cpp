@@ -0,0 +1,141 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/ThreadPool.h>
+
+using namespace std;
+using namespace solidity::util;
+
+namespace
+{
+
+/// Pool the current thread is a worker of, if any.
+thread_local ThreadPool const* t_currentPool = nullptr;
+/// Index of the current thread within t_currentPool.
+thread_local size_t t_currentWorker = 0;
+
+}
+
+ThreadPool::ThreadPool(size_t _threads)
+{
+	if (_threads <= 1)
+		return;
+
+	for (size_t i = 0; i < _threads; ++i)
+		m_queues.emplace_back(make_unique<Queue>());
+	for (size_t i = 0; i < _threads; ++i)
+		m_workers.emplace_back([this, i]() { work(i); });
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		lock_guard<mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+	m_wakeUp.notify_all();
+	for (thread& worker: m_workers)
+		worker.join();
+}
+
+size_t ThreadPool::hardwareConcurrency()
+{
+	return max<size_t>(thread::hardware_concurrency(), 1);
+}
+
+void ThreadPool::enqueue(function<void()> _task)
+{
+	size_t index =
+		t_currentPool == this ?
+		t_currentWorker :
+		m_nextQueue.fetch_add(1, memory_order_relaxed) % m_queues.size();
+	{
+		lock_guard<mutex> lock(m_queues[index]->mutex);
+		m_queues[index]->tasks.emplace_back(move(_task));
+	}
+	{
+		lock_guard<mutex> lock(m_mutex);
+		++m_pending;
+	}
+	m_wakeUp.notify_one();
+}
+
+void ThreadPool::work(size_t _index)
+{
+	t_currentPool = this;
+	t_currentWorker = _index;
+	while (true)
+	{
+		{
+			unique_lock<mutex> lock(m_mutex);
+			m_wakeUp.wait(lock, [&]() { return m_stopping || m_pending > 0; });
+			if (m_pending == 0)
+				return;
+			// Claim one of the queued tasks. It is guaranteed to be found by take() below,
+			// because tasks are counted only after they have been queued.
+			--m_pending;
+		}
+		optional<function<void()>> task;
+		while (!task)
+			task = take(_index);
+		(*task)();
+	}
+}
+
+bool ThreadPool::runQueuedTask()
+{
+	if (m_workers.empty())
+		return false;
+	{
+		lock_guard<mutex> lock(m_mutex);
+		if (m_pending == 0)
+			return false;
+		--m_pending;
+	}
+	optional<function<void()>> task;
+	while (!task)
+		task = take(t_currentPool == this ? t_currentWorker : 0);
+	(*task)();
+	return true;
+}
+
+optional<function<void()>> ThreadPool::take(size_t _index)
+{
+	{
+		Queue& ownQueue = *m_queues[_index];
+		lock_guard<mutex> lock(ownQueue.mutex);
+		if (!ownQueue.tasks.empty())
+		{
+			function<void()> task = move(ownQueue.tasks.back());
+			ownQueue.tasks.pop_back();
+			return task;
+		}
+	}
+	for (size_t offset = 1; offset < m_queues.size(); ++offset)
+	{
+		Queue& victim = *m_queues[(_index + offset) % m_queues.size()];
+		lock_guard<mutex> lock(victim.mutex);
+		if (!victim.tasks.empty())
+		{
+			function<void()> task = move(victim.tasks.front());
+			victim.tasks.pop_front();
+			return task;
+		}
+	}
+	return nullopt;
+}
@@ -0,0 +1,124 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Fixed-size work-stealing thread pool.
+ */
+
+#pragma once
+
+#include <boost/noncopyable.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace solidity::util
+{
+
+/**
+ * Pool of a fixed number of worker threads.
+ *
+ * Every worker owns a task queue. Tasks submitted by a worker are pushed onto its own queue,
+ * tasks submitted from outside of the pool are distributed round-robin. A worker takes the
+ * most recently added task from its own queue and, if that is empty, steals the oldest task
+ * from the queue of another worker.
+ *
+ * A pool with at most one thread does not start any workers and runs every task synchronously
+ * inside submit(), so callers do not need a separate sequential code path.
+ *
+ * The destructor waits until all submitted tasks, including tasks submitted by other tasks,
+ * have finished.
+ *
+ * Tasks that wait for the results of other tasks have to use wait(), otherwise all workers
+ * can end up waiting for tasks that no worker is left to run.
+ */
+class ThreadPool: boost::noncopyable
+{
+public:
+	explicit ThreadPool(size_t _threads);
+	~ThreadPool();
+
+	/// @returns the number of threads tasks are executed on.
+	size_t threads() const { return std::max<size_t>(m_workers.size(), 1); }
+
+	/// Schedules @a _task for execution.
+	/// @returns a future that receives the result of the task or the exception thrown by it.
+	template <class Task>
+	std::future<std::invoke_result_t<Task>> submit(Task&& _task)
+	{
+		using Result = std::invoke_result_t<Task>;
+		auto packagedTask = std::make_shared<std::packaged_task<Result()>>(std::forward<Task>(_task));
+		std::future<Result> result = packagedTask->get_future();
+		if (m_workers.empty())
+			(*packagedTask)();
+		else
+			enqueue([packagedTask]() { (*packagedTask)(); });
+		return result;
+	}
+
+	/// Waits until @a _future is ready and runs queued tasks in the meantime.
+	template <class Result>
+	void wait(std::future<Result> const& _future)
+	{
+		while (_future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			if (!runQueuedTask())
+				_future.wait_for(std::chrono::microseconds(50));
+	}
+
+	/// @returns the number of concurrent threads supported by the hardware or 1 if unknown.
+	static size_t hardwareConcurrency();
+
+private:
+	struct Queue
+	{
+		std::mutex mutex;
+		std::deque<std::function<void()>> tasks;
+	};
+
+	void enqueue(std::function<void()> _task);
+	/// Main loop of the worker with the given index.
+	void work(size_t _index);
+	/// Runs one of the queued tasks on the current thread.
+	/// @returns false if there was no queued task.
+	bool runQueuedTask();
+	/// Removes a task from the queue of worker @a _index or steals it from another worker.
+	std::optional<std::function<void()>> take(size_t _index);
+
+	std::vector<std::unique_ptr<Queue>> m_queues;
+	std::vector<std::thread> m_workers;
+	std::atomic<size_t> m_nextQueue{0};
+
+	/// Protects m_pending and m_stopping.
+	std::mutex m_mutex;
+	std::condition_variable m_wakeUp;
+	/// Number of queued tasks that have not yet been claimed by a worker.
+	size_t m_pending = 0;
+	bool m_stopping = false;
+};
+
+}
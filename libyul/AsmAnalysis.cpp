@@ -49,7 +49,7 @@ bool AsmAnalyzer::analyze(Block const& _block)
 	auto watcher = m_errorReporter.errorWatcher();
 	try
 	{
-		if (!(ScopeFiller(m_info, m_errorReporter))(_block))
+		if (!(ScopeFiller(m_info, m_errorReporter, m_dialect.repository))(_block))
 			return false;
 
 		(*this)(_block);
@@ -84,18 +84,18 @@ vector<YulString> AsmAnalyzer::operator()(Literal const& _literal)
 	if (_literal.kind == LiteralKind::String && _literal.value.str().size() > 32)
 		m_errorReporter.typeError(
 			3069_error,
-			_literal.location,
+			sourceLocation(_literal.location),
 			"String literal too long (" + to_string(_literal.value.str().size()) + " > 32)"
 		);
 	else if (_literal.kind == LiteralKind::Number && bigint(_literal.value.str()) > u256(-1))
-		m_errorReporter.typeError(6708_error, _literal.location, "Number literal too large (> 256 bits)");
+		m_errorReporter.typeError(6708_error, sourceLocation(_literal.location), "Number literal too large (> 256 bits)");
 	else if (_literal.kind == LiteralKind::Boolean)
 		yulAssert(_literal.value == "true"_yulstring || _literal.value == "false"_yulstring, "");
 
 	if (!m_dialect.validTypeForLiteral(_literal.kind, _literal.value, _literal.type))
 		m_errorReporter.typeError(
 			5170_error,
-			_literal.location,
+			sourceLocation(_literal.location),
 			"Invalid type \"" + _literal.type.str() + "\" for literal \"" + _literal.value.str() + "\"."
 		);
 
@@ -115,7 +115,7 @@ vector<YulString> AsmAnalyzer::operator()(Identifier const& _identifier)
 			if (!m_activeVariables.count(&_var))
 				m_errorReporter.declarationError(
 					4990_error,
-					_identifier.location,
+					sourceLocation(_identifier.location),
 					"Variable " + _identifier.name.str() + " used before it was declared."
 				);
 			type = _var.type;
@@ -124,7 +124,7 @@ vector<YulString> AsmAnalyzer::operator()(Identifier const& _identifier)
 		{
 			m_errorReporter.typeError(
 				6041_error,
-				_identifier.location,
+				sourceLocation(_identifier.location),
 				"Function " + _identifier.name.str() + " used without being called."
 			);
 		}
@@ -140,7 +140,7 @@ vector<YulString> AsmAnalyzer::operator()(Identifier const& _identifier)
 		);
 		if (!found && watcher.ok())
 			// Only add an error message if the callback did not do it.
-			m_errorReporter.declarationError(8198_error, _identifier.location, "Identifier not found.");
+			m_errorReporter.declarationError(8198_error, sourceLocation(_identifier.location), "Identifier not found.");
 	}
 
 	return {type};
@@ -153,7 +153,7 @@ void AsmAnalyzer::operator()(ExpressionStatement const& _statement)
 	if (watcher.ok() && !types.empty())
 		m_errorReporter.typeError(
 			3083_error,
-			_statement.location,
+			sourceLocation(_statement.location),
 			"Top-level expressions are not supposed to return values (this expression returns " +
 			to_string(types.size()) +
 			" value" +
@@ -173,7 +173,7 @@ void AsmAnalyzer::operator()(Assignment const& _assignment)
 		if (!variables.insert(_variableName.name).second)
 			m_errorReporter.declarationError(
 				9005_error,
-				_assignment.location,
+				sourceLocation(_assignment.location),
 				"Variable " +
 				_variableName.name.str() +
 				" occurs multiple times on the left-hand side of the assignment."
@@ -184,7 +184,7 @@ void AsmAnalyzer::operator()(Assignment const& _assignment)
 	if (types.size() != numVariables)
 		m_errorReporter.declarationError(
 			8678_error,
-			_assignment.location,
+			sourceLocation(_assignment.location),
 			"Variable count does not match number of values (" +
 			to_string(numVariables) +
 			" vs. " +
@@ -217,7 +217,7 @@ void AsmAnalyzer::operator()(VariableDeclaration const& _varDecl)
 		if (types.size() != numVariables)
 			m_errorReporter.declarationError(
 				3812_error,
-				_varDecl.location,
+				sourceLocation(_varDecl.location),
 				"Variable count mismatch: " +
 				to_string(numVariables) +
 				" variables and " +
@@ -234,7 +234,7 @@ void AsmAnalyzer::operator()(VariableDeclaration const& _varDecl)
 			if (variable.type != givenType)
 				m_errorReporter.typeError(
 					3947_error,
-					variable.location,
+					sourceLocation(variable.location),
 					"Assigning value of type \"" + givenType.str() + "\" to variable of type \"" + variable.type.str() + "\"."
 				);
 		}
@@ -283,7 +283,7 @@ vector<YulString> AsmAnalyzer::operator()(FunctionCall const& _funCall)
 		{
 			m_errorReporter.typeError(
 				4202_error,
-				_funCall.functionName.location,
+				sourceLocation(_funCall.functionName.location),
 				"Attempt to call variable instead of function."
 			);
 		},
@@ -295,14 +295,14 @@ vector<YulString> AsmAnalyzer::operator()(FunctionCall const& _funCall)
 	}))
 	{
 		if (!validateInstructions(_funCall))
-			m_errorReporter.declarationError(4619_error, _funCall.functionName.location, "Function not found.");
+			m_errorReporter.declarationError(4619_error, sourceLocation(_funCall.functionName.location), "Function not found.");
 		yulAssert(!watcher.ok(), "Expected a reported error.");
 	}
 
 	if (parameterTypes && _funCall.arguments.size() != parameterTypes->size())
 		m_errorReporter.typeError(
 			7000_error,
-			_funCall.functionName.location,
+			sourceLocation(_funCall.functionName.location),
 			"Function expects " +
 			to_string(parameterTypes->size()) +
 			" arguments but got " +
@@ -326,7 +326,7 @@ vector<YulString> AsmAnalyzer::operator()(FunctionCall const& _funCall)
 			if (!holds_alternative<Literal>(arg))
 				m_errorReporter.typeError(
 					9114_error,
-					_funCall.functionName.location,
+					sourceLocation(_funCall.functionName.location),
 					"Function expects direct literals as arguments."
 				);
 			else if (
@@ -336,7 +336,7 @@ vector<YulString> AsmAnalyzer::operator()(FunctionCall const& _funCall)
 				if (!m_dataNames.count(std::get<Literal>(arg).value))
 					m_errorReporter.typeError(
 						3517_error,
-						_funCall.functionName.location,
+						sourceLocation(_funCall.functionName.location),
 						"Unknown data object \"" + std::get<Literal>(arg).value.str() + "\"."
 					);
 		}
@@ -373,7 +373,7 @@ void AsmAnalyzer::operator()(Switch const& _switch)
 	if (_switch.cases.size() == 1 && !_switch.cases[0].value)
 		m_errorReporter.warning(
 			9592_error,
-			_switch.location,
+			sourceLocation(_switch.location),
 			"\"switch\" statement with only a default case."
 		);
 
@@ -394,7 +394,7 @@ void AsmAnalyzer::operator()(Switch const& _switch)
 
 			/// Note: the parser ensures there is only one default case
 			if (watcher.ok() && !cases.insert(valueOfLiteral(*_case.value)).second)
-				m_errorReporter.declarationError(6792_error, _case.location, "Duplicate case defined.");
+				m_errorReporter.declarationError(6792_error, sourceLocation(_case.location), "Duplicate case defined.");
 		}
 
 		(*this)(_case.body);
@@ -442,7 +442,7 @@ YulString AsmAnalyzer::expectExpression(Expression const& _expr)
 	if (types.size() != 1)
 		m_errorReporter.typeError(
 			3950_error,
-			locationOf(_expr),
+			sourceLocation(locationOf(_expr)),
 			"Expected expression to evaluate to one value, but got " +
 			to_string(types.size()) +
 			" values instead."
@@ -464,7 +464,7 @@ void AsmAnalyzer::expectBoolExpression(Expression const& _expr)
 	if (type != m_dialect.boolType)
 		m_errorReporter.typeError(
 			1733_error,
-			locationOf(_expr),
+			sourceLocation(locationOf(_expr)),
 			"Expected a value of boolean type \"" +
 			m_dialect.boolType.str() +
 			"\" but got \"" +
@@ -483,11 +483,11 @@ void AsmAnalyzer::checkAssignment(Identifier const& _variable, YulString _valueT
 	{
 		// Check that it is a variable
 		if (!holds_alternative<Scope::Variable>(*var))
-			m_errorReporter.typeError(2657_error, _variable.location, "Assignment requires variable.");
+			m_errorReporter.typeError(2657_error, sourceLocation(_variable.location), "Assignment requires variable.");
 		else if (!m_activeVariables.count(&std::get<Scope::Variable>(*var)))
 			m_errorReporter.declarationError(
 				1133_error,
-				_variable.location,
+				sourceLocation(_variable.location),
 				"Variable " + _variable.name.str() + " used before it was declared."
 			);
 		else
@@ -506,11 +506,11 @@ void AsmAnalyzer::checkAssignment(Identifier const& _variable, YulString _valueT
 
 	if (!found && watcher.ok())
 		// Only add message if the callback did not.
-		m_errorReporter.declarationError(4634_error, _variable.location, "Variable not found or variable not lvalue.");
+		m_errorReporter.declarationError(4634_error, sourceLocation(_variable.location), "Variable not found or variable not lvalue.");
 	if (variableType && *variableType != _valueType)
 		m_errorReporter.typeError(
 			9547_error,
-			_variable.location,
+			sourceLocation(_variable.location),
 			"Assigning a value of type \"" +
 			_valueType.str() +
 			"\" to a variable of type \"" +
@@ -529,22 +529,27 @@ Scope& AsmAnalyzer::scope(Block const* _block)
 	return *scopePtr;
 }
 
-void AsmAnalyzer::expectValidType(YulString _type, SourceLocation const& _location)
+SourceLocation AsmAnalyzer::sourceLocation(Location const& _location) const
+{
+	return _location.toSourceLocation(m_dialect.repository);
+}
+
+void AsmAnalyzer::expectValidType(YulString _type, Location const& _location)
 {
 	if (!m_dialect.types.count(_type))
 		m_errorReporter.typeError(
 			5473_error,
-			_location,
+			sourceLocation(_location),
 			"\"" + _type.str() + "\" is not a valid type (user defined types are not yet supported)."
 		);
 }
 
-void AsmAnalyzer::expectType(YulString _expectedType, YulString _givenType, SourceLocation const& _location)
+void AsmAnalyzer::expectType(YulString _expectedType, YulString _givenType, Location const& _location)
 {
 	if (_expectedType != _givenType)
 		m_errorReporter.typeError(
 			3781_error,
-			_location,
+			sourceLocation(_location),
 			"Expected a value of type \"" +
 			_expectedType.str() +
 			"\" but got \"" +
@@ -553,7 +558,7 @@ void AsmAnalyzer::expectType(YulString _expectedType, YulString _givenType, Sour
 		);
 }
 
-bool AsmAnalyzer::validateInstructions(std::string const& _instructionIdentifier, langutil::SourceLocation const& _location)
+bool AsmAnalyzer::validateInstructions(std::string const& _instructionIdentifier, Location const& _location)
 {
 	auto const builtin = EVMDialect::strictAssemblyForEVM(EVMVersion{}).builtin(YulString(_instructionIdentifier));
 	if (builtin && builtin->instruction.has_value())
@@ -562,7 +567,7 @@ bool AsmAnalyzer::validateInstructions(std::string const& _instructionIdentifier
 		return false;
 }
 
-bool AsmAnalyzer::validateInstructions(evmasm::Instruction _instr, SourceLocation const& _location)
+bool AsmAnalyzer::validateInstructions(evmasm::Instruction _instr, Location const& _location)
 {
 	// We assume that returndatacopy, returndatasize and staticcall are either all available
 	// or all not available.
@@ -580,7 +585,7 @@ bool AsmAnalyzer::validateInstructions(evmasm::Instruction _instr, SourceLocatio
 	auto errorForVM = [&](ErrorId _errorId, string const& vmKindMessage) {
 		m_errorReporter.typeError(
 			_errorId,
-			_location,
+			sourceLocation(_location),
 			"The \"" +
 			boost::to_lower_copy(instructionInfo(_instr).name)
 			+ "\" instruction is " +
@@ -614,7 +619,7 @@ bool AsmAnalyzer::validateInstructions(evmasm::Instruction _instr, SourceLocatio
 	else if (_instr == evmasm::Instruction::PC)
 		m_errorReporter.warning(
 			2450_error,
-			_location,
+			sourceLocation(_location),
 			"The \"" +
 			boost::to_lower_copy(instructionInfo(_instr).name) +
 			"\" instruction is deprecated and will be removed in the next breaking release."
@@ -108,11 +108,13 @@ private:
 	void checkAssignment(Identifier const& _variable, YulString _valueType);
 
 	Scope& scope(Block const* _block);
-	void expectValidType(YulString _type, langutil::SourceLocation const& _location);
-	void expectType(YulString _expectedType, YulString _givenType, langutil::SourceLocation const& _location);
+	/// @returns @a _location in the form used for error messages.
+	langutil::SourceLocation sourceLocation(Location const& _location) const;
+	void expectValidType(YulString _type, Location const& _location);
+	void expectType(YulString _expectedType, YulString _givenType, Location const& _location);
 
-	bool validateInstructions(evmasm::Instruction _instr, langutil::SourceLocation const& _location);
-	bool validateInstructions(std::string const& _instrIdentifier, langutil::SourceLocation const& _location);
+	bool validateInstructions(evmasm::Instruction _instr, Location const& _location);
+	bool validateInstructions(std::string const& _instrIdentifier, Location const& _location);
 	bool validateInstructions(FunctionCall const& _functionCall)
 	{
 		return validateInstructions(_functionCall.functionName.name.str(), _functionCall.functionName.location);
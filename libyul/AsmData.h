@@ -35,54 +35,84 @@ namespace solidity::yul
 
 using Type = YulString;
 
-struct TypedName { langutil::SourceLocation location; YulString name; Type type; };
+/// Source location of a Yul AST node.
+/// In contrast to langutil::SourceLocation, it refers to its source by an index into the table
+/// of a YulStringRepository instead of a shared pointer. This makes it half the size and avoids
+/// reference counting when nodes are copied.
+/// Conversions from and to langutil::SourceLocation need the repository the AST belongs to.
+struct Location
+{
+	Location() = default;
+	Location(langutil::SourceLocation const& _location, YulStringRepository& _repository):
+		start(_location.start),
+		end(_location.end),
+		sourceIndex(_repository.sourceIndex(_location.source))
+	{}
+
+	langutil::SourceLocation toSourceLocation(YulStringRepository const& _repository) const
+	{
+		return langutil::SourceLocation{start, end, _repository.source(sourceIndex)};
+	}
+
+	bool operator==(Location const& _other) const
+	{
+		return sourceIndex == _other.sourceIndex && start == _other.start && end == _other.end;
+	}
+	bool operator!=(Location const& _other) const { return !operator==(_other); }
+
+	int start = -1;
+	int end = -1;
+	unsigned sourceIndex = 0;
+};
+
+struct TypedName { Location location; YulString name; Type type; };
 using TypedNameList = std::vector<TypedName>;
 
 /// Literal number or string (up to 32 bytes)
 enum class LiteralKind { Number, Boolean, String };
-struct Literal { langutil::SourceLocation location; LiteralKind kind; YulString value; Type type; };
+struct Literal { Location location; LiteralKind kind; YulString value; Type type; };
 /// External / internal identifier or label reference
-struct Identifier { langutil::SourceLocation location; YulString name; };
+struct Identifier { Location location; YulString name; };
 /// Assignment ("x := mload(20:u256)", expects push-1-expression on the right hand
 /// side and requires x to occupy exactly one stack slot.
 ///
 /// Multiple assignment ("x, y := f()"), where the left hand side variables each occupy
 /// a single stack slot and expects a single expression on the right hand returning
 /// the same amount of items as the number of variables.
-struct Assignment { langutil::SourceLocation location; std::vector<Identifier> variableNames; std::unique_ptr<Expression> value; };
-struct FunctionCall { langutil::SourceLocation location; Identifier functionName; std::vector<Expression> arguments; };
+struct Assignment { Location location; std::vector<Identifier> variableNames; std::unique_ptr<Expression> value; };
+struct FunctionCall { Location location; Identifier functionName; std::vector<Expression> arguments; };
 /// Statement that contains only a single expression
-struct ExpressionStatement { langutil::SourceLocation location; Expression expression; };
+struct ExpressionStatement { Location location; Expression expression; };
 /// Block-scope variable declaration ("let x:u256 := mload(20:u256)"), non-hoisted
-struct VariableDeclaration { langutil::SourceLocation location; TypedNameList variables; std::unique_ptr<Expression> value; };
+struct VariableDeclaration { Location location; TypedNameList variables; std::unique_ptr<Expression> value; };
 /// Block that creates a scope (frees declared stack variables)
-struct Block { langutil::SourceLocation location; std::vector<Statement> statements; };
+struct Block { Location location; std::vector<Statement> statements; };
 /// Function definition ("function f(a, b) -> (d, e) { ... }")
-struct FunctionDefinition { langutil::SourceLocation location; YulString name; TypedNameList parameters; TypedNameList returnVariables; Block body; };
+struct FunctionDefinition { Location location; YulString name; TypedNameList parameters; TypedNameList returnVariables; Block body; };
 /// Conditional execution without "else" part.
-struct If { langutil::SourceLocation location; std::unique_ptr<Expression> condition; Block body; };
+struct If { Location location; std::unique_ptr<Expression> condition; Block body; };
 /// Switch case or default case
-struct Case { langutil::SourceLocation location; std::unique_ptr<Literal> value; Block body; };
+struct Case { Location location; std::unique_ptr<Literal> value; Block body; };
 /// Switch statement
-struct Switch { langutil::SourceLocation location; std::unique_ptr<Expression> expression; std::vector<Case> cases; };
-struct ForLoop { langutil::SourceLocation location; Block pre; std::unique_ptr<Expression> condition; Block post; Block body; };
+struct Switch { Location location; std::unique_ptr<Expression> expression; std::vector<Case> cases; };
+struct ForLoop { Location location; Block pre; std::unique_ptr<Expression> condition; Block post; Block body; };
 /// Break statement (valid within for loop)
-struct Break { langutil::SourceLocation location; };
+struct Break { Location location; };
 /// Continue statement (valid within for loop)
-struct Continue { langutil::SourceLocation location; };
+struct Continue { Location location; };
 /// Leave statement (valid within function)
-struct Leave { langutil::SourceLocation location; };
+struct Leave { Location location; };
 
 struct LocationExtractor
 {
-	template <class T> langutil::SourceLocation operator()(T const& _node) const
+	template <class T> Location operator()(T const& _node) const
 	{
 		return _node.location;
 	}
 };
 
 /// Extracts the source location from an inline assembly node.
-template <class T> inline langutil::SourceLocation locationOf(T const& _node)
+template <class T> inline Location locationOf(T const& _node)
 {
 	return std::visit(LocationExtractor(), _node);
 }
@@ -28,6 +28,7 @@
 namespace solidity::yul
 {
 
+struct Location;
 struct Literal;
 struct Label;
 struct Identifier;
@@ -180,7 +180,7 @@ Json::Value AsmJsonConverter::operator()(Leave const& _node) const
 	return createAstNode(_node.location, "YulLeave");
 }
 
-Json::Value AsmJsonConverter::createAstNode(langutil::SourceLocation const& _location, string _nodeType) const
+Json::Value AsmJsonConverter::createAstNode(Location const& _location, string _nodeType) const
 {
 	Json::Value ret{Json::objectValue};
 	ret["nodeType"] = std::move(_nodeType);
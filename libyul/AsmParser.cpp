@@ -64,9 +64,9 @@ unique_ptr<Block> Parser::parse(std::shared_ptr<Scanner> const& _scanner, bool _
 std::map<string, evmasm::Instruction> const& Parser::instructions()
 {
 	// Allowed instructions, lowercase names.
-	static map<string, evmasm::Instruction> s_instructions;
-	if (s_instructions.empty())
+	static map<string, evmasm::Instruction> const s_instructions = []()
 	{
+		map<string, evmasm::Instruction> instructions;
 		for (auto const& instruction: evmasm::c_instructions)
 		{
 			if (
@@ -76,9 +76,10 @@ std::map<string, evmasm::Instruction> const& Parser::instructions()
 				continue;
 			string name = instruction.first;
 			transform(name.begin(), name.end(), name.begin(), [](unsigned char _c) { return tolower(_c); });
-			s_instructions[name] = instruction.second;
+			instructions[name] = instruction.second;
 		}
-	}
+		return instructions;
+	}();
 	return s_instructions;
 }
 
@@ -315,13 +316,13 @@ Parser::ElementaryOperation Parser::parseElementaryOperation()
 		YulString literal{currentLiteral()};
 		if (m_dialect.builtin(literal))
 		{
-			Identifier identifier{currentLocation(), literal};
+			Identifier identifier{currentNodeLocation(), literal};
 			advance();
 			expectToken(Token::LParen, false);
 			return FunctionCall{identifier.location, identifier, {}};
 		}
 		else
-			ret = Identifier{currentLocation(), literal};
+			ret = Identifier{currentNodeLocation(), literal};
 		advance();
 		break;
 	}
@@ -337,7 +338,7 @@ Parser::ElementaryOperation Parser::parseElementaryOperation()
 			kind = LiteralKind::String;
 			break;
 		case Token::Number:
-			if (!isValidNumberLiteral(currentLiteral()))
+			if (!isValidNumberLiteral(string(currentLiteral())))
 				fatalParserError(4828_error, "Invalid number literal.");
 			kind = LiteralKind::Number;
 			break;
@@ -350,7 +351,7 @@ Parser::ElementaryOperation Parser::parseElementaryOperation()
 		}
 
 		Literal literal{
-			currentLocation(),
+			currentNodeLocation(),
 			kind,
 			YulString{currentLiteral()},
 			kind == LiteralKind::Boolean ? m_dialect.boolType : m_dialect.defaultType
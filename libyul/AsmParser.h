@@ -73,11 +73,14 @@ protected:
 		return m_locationOverride ? *m_locationOverride : ParserBase::currentLocation();
 	}
 
+	/// @returns the current source location in the form stored in the AST.
+	Location currentNodeLocation() const { return Location{currentLocation(), m_dialect.repository}; }
+
 	/// Creates an inline assembly node with the current source location.
 	template <class T> T createWithLocation() const
 	{
 		T r;
-		r.location = currentLocation();
+		r.location = currentNodeLocation();
 		return r;
 	}
 
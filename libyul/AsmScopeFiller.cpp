@@ -39,8 +39,8 @@ using namespace solidity::yul;
 using namespace solidity::util;
 using namespace solidity::langutil;
 
-ScopeFiller::ScopeFiller(AsmAnalysisInfo& _info, ErrorReporter& _errorReporter):
-	m_info(_info), m_errorReporter(_errorReporter)
+ScopeFiller::ScopeFiller(AsmAnalysisInfo& _info, ErrorReporter& _errorReporter, YulStringRepository const& _repository):
+	m_info(_info), m_errorReporter(_errorReporter), m_repository(_repository)
 {
 	m_currentScope = &scope(nullptr);
 }
@@ -134,14 +134,14 @@ bool ScopeFiller::operator()(Block const& _block)
 	return success;
 }
 
-bool ScopeFiller::registerVariable(TypedName const& _name, SourceLocation const& _location, Scope& _scope)
+bool ScopeFiller::registerVariable(TypedName const& _name, Location const& _location, Scope& _scope)
 {
 	if (!_scope.registerVariable(_name.name, _name.type))
 	{
 		//@TODO secondary location
 		m_errorReporter.declarationError(
 			1395_error,
-			_location,
+			_location.toSourceLocation(m_repository),
 			"Variable name " + _name.name.str() + " already taken in this scope."
 		);
 		return false;
@@ -162,7 +162,7 @@ bool ScopeFiller::registerFunction(FunctionDefinition const& _funDef)
 		//@TODO secondary location
 		m_errorReporter.declarationError(
 			6052_error,
-			_funDef.location,
+			_funDef.location.toSourceLocation(m_repository),
 			"Function name " + _funDef.name.str() + " already taken in this scope."
 		);
 		return false;
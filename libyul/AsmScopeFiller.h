@@ -38,6 +38,7 @@ namespace solidity::yul
 struct TypedName;
 struct Scope;
 struct AsmAnalysisInfo;
+class YulStringRepository;
 
 /**
  * Fills scopes with identifiers and checks for name clashes.
@@ -46,7 +47,8 @@ struct AsmAnalysisInfo;
 class ScopeFiller
 {
 public:
-	ScopeFiller(AsmAnalysisInfo& _info, langutil::ErrorReporter& _errorReporter);
+	/// @param _repository the repository of the analysed AST, used to report source locations.
+	ScopeFiller(AsmAnalysisInfo& _info, langutil::ErrorReporter& _errorReporter, YulStringRepository const& _repository);
 
 	bool operator()(Literal const&) { return true; }
 	bool operator()(Identifier const&) { return true; }
@@ -66,7 +68,7 @@ public:
 private:
 	bool registerVariable(
 		TypedName const& _name,
-		langutil::SourceLocation const& _location,
+		Location const& _location,
 		Scope& _scope
 	);
 	bool registerFunction(FunctionDefinition const& _funDef);
@@ -76,6 +78,7 @@ private:
 	Scope* m_currentScope = nullptr;
 	AsmAnalysisInfo& m_info;
 	langutil::ErrorReporter& m_errorReporter;
+	YulStringRepository const& m_repository;
 };
 
 }
@@ -22,32 +22,227 @@
 
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
+#include <libyul/AsmData.h>
 
 #include <libyul/backends/evm/EVMCodeTransform.h>
 #include <libyul/backends/evm/NoOutputAssembly.h>
+#include <libyul/optimiser/ASTCopier.h>
 
 #include <liblangutil/EVMVersion.h>
 
+#include <libsolutil/Visitor.h>
+
+#include <boost/range/adaptor/reversed.hpp>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
 using namespace solidity::util;
 
+namespace
+{
+
+/// Stack slots that can be reached by DUP and SWAP instructions.
+size_t const c_reachableStackSlots = 16;
+
+/**
+ * Computes upper bounds of the stack height during the code transform. Variables are assumed
+ * to stay on the stack until the end of their block, the return label of a function call is
+ * pushed before its arguments and the cases of a switch keep its expression and a case value
+ * with a copy of the expression on the stack.
+ */
+class StackHeightBound
+{
+public:
+	explicit StackHeightBound(Dialect const& _dialect): m_dialect(_dialect) {}
+
+	size_t operator()(Block const& _block, size_t _height) const
+	{
+		size_t peak = _height;
+		for (Statement const& statement: _block.statements)
+		{
+			peak = max(peak, (*this)(statement, _height));
+			if (auto const* varDecl = get_if<VariableDeclaration>(&statement))
+				_height += varDecl->variables.size();
+		}
+		return peak;
+	}
+
+	size_t operator()(Statement const& _statement, size_t _height) const
+	{
+		return std::visit(GenericVisitor{
+			[&](ExpressionStatement const& _expressionStatement) {
+				return _height + (*this)(_expressionStatement.expression);
+			},
+			[&](Assignment const& _assignment) {
+				return _height + max(_assignment.variableNames.size(), (*this)(*_assignment.value));
+			},
+			[&](VariableDeclaration const& _varDecl) {
+				return _height + max(_varDecl.variables.size(), _varDecl.value ? (*this)(*_varDecl.value) : 0);
+			},
+			[&](If const& _if) {
+				return max(_height + (*this)(*_if.condition), (*this)(_if.body, _height));
+			},
+			[&](Switch const& _switch) {
+				size_t peak = _height + max<size_t>((*this)(*_switch.expression), 3);
+				for (Case const& c: _switch.cases)
+					peak = max(peak, (*this)(c.body, _height + 1));
+				return peak;
+			},
+			[&](ForLoop const& _forLoop) {
+				size_t innerHeight = _height;
+				for (Statement const& statement: _forLoop.pre.statements)
+					if (auto const* varDecl = get_if<VariableDeclaration>(&statement))
+						innerHeight += varDecl->variables.size();
+				return max({
+					(*this)(_forLoop.pre, _height),
+					innerHeight + (*this)(*_forLoop.condition),
+					(*this)(_forLoop.body, innerHeight),
+					(*this)(_forLoop.post, innerHeight)
+				});
+			},
+			[&](Block const& _block) { return (*this)(_block, _height); },
+			// Functions are transformed with their own stack.
+			[&](FunctionDefinition const&) { return _height; },
+			[&](Break const&) { return _height; },
+			[&](Continue const&) { return _height; },
+			[&](Leave const&) { return _height; }
+		}, _statement);
+	}
+
+	/// @returns the bound of the height relative to the height before evaluating @a _expression.
+	size_t operator()(Expression const& _expression) const
+	{
+		if (auto const* functionCall = get_if<FunctionCall>(&_expression))
+		{
+			size_t returnLabel = m_dialect.builtin(functionCall->functionName.name) ? 0 : 1;
+			size_t peak = max<size_t>(returnLabel + functionCall->arguments.size(), 1);
+			size_t evaluated = 0;
+			for (Expression const& argument: functionCall->arguments | boost::adaptors::reversed)
+				peak = max(peak, returnLabel + evaluated++ + (*this)(argument));
+			return peak;
+		}
+		return 1;
+	}
+
+private:
+	Dialect const& m_dialect;
+};
+
+/**
+ * Copies the code of an object, but replaces the bodies of functions that do not have to be
+ * checked by empty blocks.
+ */
+class CodePruner: public ASTCopier
+{
+public:
+	CodePruner(Dialect const& _dialect, optional<set<YulString>> const& _functions):
+		m_dialect(_dialect), m_functions(_functions)
+	{}
+
+	using ASTCopier::operator();
+	Statement operator()(FunctionDefinition const& _function) override
+	{
+		if (needsCheck(_function))
+			return ASTCopier::operator()(_function);
+		return FunctionDefinition{
+			_function.location,
+			_function.name,
+			translateVector(_function.parameters),
+			translateVector(_function.returnVariables),
+			Block{_function.body.location, {}}
+		};
+	}
+
+	/// @returns true if @a _block contains a function that has to be checked.
+	bool containsFunctionToCheck(Block const& _block)
+	{
+		bool found = false;
+		forEachFunction(_block, [&](FunctionDefinition const& _function) {
+			found = found || needsCheck(_function);
+		});
+		return found;
+	}
+
+private:
+	bool needsCheck(FunctionDefinition const& _function)
+	{
+		if (!m_needsCheck.count(&_function))
+			m_needsCheck[&_function] =
+				(
+					(!m_functions || m_functions->count(_function.name)) &&
+					CompilabilityChecker::stackHeightBound(m_dialect, _function) > c_reachableStackSlots
+				) ||
+				containsFunctionToCheck(_function.body);
+		return m_needsCheck.at(&_function);
+	}
+
+	/// Calls @a _callback for the functions defined in @a _block outside of other functions.
+	template <typename Callback>
+	static void forEachFunction(Block const& _block, Callback const& _callback)
+	{
+		for (Statement const& statement: _block.statements)
+			std::visit(GenericVisitor{
+				[&](FunctionDefinition const& _function) { _callback(_function); },
+				[&](Block const& _nested) { forEachFunction(_nested, _callback); },
+				[&](If const& _if) { forEachFunction(_if.body, _callback); },
+				[&](Switch const& _switch) {
+					for (Case const& c: _switch.cases)
+						forEachFunction(c.body, _callback);
+				},
+				[&](ForLoop const& _forLoop) {
+					forEachFunction(_forLoop.pre, _callback);
+					forEachFunction(_forLoop.body, _callback);
+					forEachFunction(_forLoop.post, _callback);
+				},
+				[&](auto const&) {}
+			}, statement);
+	}
+
+	Dialect const& m_dialect;
+	optional<set<YulString>> const& m_functions;
+	map<FunctionDefinition const*, bool> m_needsCheck;
+};
+
+}
+
 map<YulString, int> CompilabilityChecker::run(
 	Dialect const& _dialect,
 	Object const& _object,
-	bool _optimizeStackAllocation
+	bool _optimizeStackAllocation,
+	optional<set<YulString>> const& _functions
 )
 {
 	if (auto const* evmDialect = dynamic_cast<EVMDialect const*>(&_dialect))
 	{
 		NoOutputEVMDialect noOutputDialect(*evmDialect);
 
+		CodePruner pruner(_dialect, _functions);
+		Object prunedObject;
+		prunedObject.name = _object.name;
+		prunedObject.subObjects = _object.subObjects;
+		prunedObject.subIndexByName = _object.subIndexByName;
+		prunedObject.code = make_shared<Block>(pruner.translate(*_object.code));
+
+		// After the function grouper, the outermost block is the first statement. It is not
+		// generated if it does not have to be checked and does not define functions to be checked.
+		Block& code = *prunedObject.code;
+		if (
+			!code.statements.empty() &&
+			holds_alternative<Block>(code.statements.front()) &&
+			!pruner.containsFunctionToCheck(std::get<Block>(_object.code->statements.front())) &&
+			(
+				(_functions && !_functions->count({})) ||
+				StackHeightBound{_dialect}(std::get<Block>(_object.code->statements.front()), 0) <= c_reachableStackSlots
+			)
+		)
+			code.statements.front() = Block{std::get<Block>(code.statements.front()).location, {}};
+
 		yul::AsmAnalysisInfo analysisInfo =
-			yul::AsmAnalyzer::analyzeStrictAssertCorrect(noOutputDialect, _object);
+			yul::AsmAnalyzer::analyzeStrictAssertCorrect(noOutputDialect, prunedObject);
 
 		BuiltinContext builtinContext;
-		builtinContext.currentObject = &_object;
+		builtinContext.currentObject = &prunedObject;
 		if (!_object.name.empty())
 			builtinContext.subIDs[_object.name] = 1;
 		for (auto const& subNode: _object.subObjects)
@@ -56,19 +251,28 @@ map<YulString, int> CompilabilityChecker::run(
 		CodeTransform transform(
 			assembly,
 			analysisInfo,
-			*_object.code,
+			code,
 			noOutputDialect,
 			builtinContext,
 			_optimizeStackAllocation
 		);
-		transform(*_object.code);
+		transform(code);
 
 		std::map<YulString, int> functions;
 		for (StackTooDeepError const& error: transform.stackErrors())
-			functions[error.functionName] = max(error.depth, functions[error.functionName]);
+			// Functions with pruned bodies can still report errors for their parameters and return variables.
+			if (!_functions || _functions->count(error.functionName))
+				functions[error.functionName] = max(error.depth, functions[error.functionName]);
 
 		return functions;
 	}
 	else
 		return {};
 }
+
+size_t CompilabilityChecker::stackHeightBound(Dialect const& _dialect, FunctionDefinition const& _function)
+{
+	// Return label, arguments and return variables.
+	size_t height = 1 + _function.parameters.size() + _function.returnVariables.size();
+	return StackHeightBound{_dialect}(_function.body, height);
+}
@@ -27,6 +27,8 @@
 
 #include <map>
 #include <memory>
+#include <optional>
+#include <set>
 
 namespace solidity::yul
 {
@@ -40,15 +42,25 @@ namespace solidity::yul
  * functions are not nested. Otherwise, it might miss reporting some functions.
  *
  * Only checks the code of the object itself, does not descend into sub-objects.
+ *
+ * Code is only generated for functions whose stack height cannot be bounded by 16 without
+ * generating code, the others are known to be compilable.
  */
 class CompilabilityChecker
 {
 public:
+	/// @param _functions if given, only these functions are checked and the others are assumed
+	/// to be compilable. The empty name stands for the outermost block.
 	static std::map<YulString, int> run(
 		Dialect const& _dialect,
 		Object const& _object,
-		bool _optimizeStackAllocation
+		bool _optimizeStackAllocation,
+		std::optional<std::set<YulString>> const& _functions = std::nullopt
 	);
+
+	/// @returns an upper bound of the stack height the code transform reaches in the body
+	/// of @a _function, not counting functions defined inside.
+	static size_t stackHeightBound(Dialect const& _dialect, FunctionDefinition const& _function);
 };
 
 }
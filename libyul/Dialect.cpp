@@ -29,8 +29,8 @@ using namespace solidity::langutil;
 Literal Dialect::zeroLiteralForType(solidity::yul::YulString _type) const
 {
 	if (_type == boolType && _type != defaultType)
-		return {SourceLocation{}, LiteralKind::Boolean, "false"_yulstring, _type};
-	return {SourceLocation{}, LiteralKind::Number, "0"_yulstring, _type};
+		return {Location{}, LiteralKind::Boolean, "false"_yulstring, _type};
+	return {Location{}, LiteralKind::Number, "0"_yulstring, _type};
 }
 
 bool Dialect::validTypeForLiteral(LiteralKind _kind, YulString, YulString _type) const
@@ -43,13 +43,9 @@ bool Dialect::validTypeForLiteral(LiteralKind _kind, YulString, YulString _type)
 
 Dialect const& Dialect::yulDeprecated()
 {
-	static unique_ptr<Dialect> dialect;
-	static YulStringRepository::ResetCallback callback{[&] { dialect.reset(); }};
-
-	if (!dialect)
-	{
+	return YulStringRepository::instance().cached<Dialect>("yulDeprecated", []() {
 		// TODO will probably change, especially the list of types.
-		dialect = make_unique<Dialect>();
+		auto dialect = make_unique<Dialect>();
 		dialect->defaultType = "u256"_yulstring;
 		dialect->boolType = "bool"_yulstring;
 		dialect->types = {
@@ -65,7 +61,6 @@ Dialect const& Dialect::yulDeprecated()
 			"u256"_yulstring,
 			"s256"_yulstring
 		};
-	};
-
-	return *dialect;
+		return dialect;
+	});
 }
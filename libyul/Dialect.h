@@ -59,6 +59,9 @@ struct Dialect: boost::noncopyable
 	/// Type used for the literals "true" and "false".
 	YulString boolType;
 	std::set<YulString> types = {{}};
+	/// Repository of the strings of the dialect and thus of the ASTs it is used with. Source
+	/// locations of these ASTs are converted using it.
+	YulStringRepository& repository = YulStringRepository::instance();
 
 	/// @returns the builtin function of the given name or a nullptr if it is not a builtin function.
 	virtual BuiltinFunction const* builtin(YulString /*_name*/) const { return nullptr; }
@@ -125,7 +125,7 @@ void ObjectParser::parseData(Object& _containingObject)
 		expectToken(Token::HexStringLiteral, false);
 	else
 		expectToken(Token::StringLiteral, false);
-	addNamedSubObject(_containingObject, name, make_shared<Data>(name, asBytes(currentLiteral())));
+	addNamedSubObject(_containingObject, name, make_shared<Data>(name, asBytes(string(currentLiteral()))));
 	advance();
 }
 
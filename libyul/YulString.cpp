@@ -0,0 +1,152 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/YulString.h>
+
+#include <liblangutil/CharStream.h>
+
+#include <limits>
+#include <utility>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+namespace
+{
+
+/// Empty string the ID zero refers to.
+string const c_emptyString;
+
+/// Repository installed for the current thread, if any.
+thread_local YulStringRepository* t_currentRepository = nullptr;
+
+atomic<uint64_t> g_nextGeneration{0};
+
+/// Most recent result of sourceIndex() on the current thread. Consecutive lookups almost always
+/// ask for the same source, because nodes are created while parsing one source at a time.
+struct SourceIndexCache
+{
+	uint64_t generation = numeric_limits<uint64_t>::max();
+	langutil::CharStream const* source = nullptr;
+	unsigned index = 0;
+};
+thread_local SourceIndexCache t_sourceIndexCache;
+
+}
+
+YulStringRepository::YulStringRepository():
+	m_generation(g_nextGeneration.fetch_add(1, memory_order_relaxed)),
+	m_sources{nullptr}
+{
+	m_strings.publish(0, &c_emptyString);
+	m_sourceTable.publish(0, &m_sources.front());
+}
+
+YulStringRepository::~YulStringRepository() = default;
+
+YulStringRepository& YulStringRepository::instance()
+{
+	if (t_currentRepository)
+		return *t_currentRepository;
+	static YulStringRepository defaultRepository;
+	return defaultRepository;
+}
+
+YulStringRepository* YulStringRepository::setCurrent(YulStringRepository* _repository)
+{
+	return exchange(t_currentRepository, _repository);
+}
+
+YulStringRepository::Scope::Scope():
+	m_ownedRepository(make_unique<YulStringRepository>()),
+	m_repository(m_ownedRepository.get()),
+	m_previous(setCurrent(m_repository))
+{
+}
+
+YulStringRepository::Scope::Scope(YulStringRepository& _repository):
+	m_repository(&_repository),
+	m_previous(setCurrent(m_repository))
+{
+}
+
+YulStringRepository::Scope::~Scope()
+{
+	setCurrent(m_previous);
+}
+
+unsigned YulStringRepository::sourceIndex(shared_ptr<langutil::CharStream> const& _source)
+{
+	if (!_source)
+		return 0;
+	SourceIndexCache& cache = t_sourceIndexCache;
+	if (cache.generation == m_generation && cache.source == _source.get())
+		return cache.index;
+
+	unsigned index = 0;
+	{
+		shared_lock<shared_mutex> lock(m_sourcesMutex);
+		auto it = m_sourceIndices.find(_source.get());
+		if (it != m_sourceIndices.end())
+			index = it->second;
+	}
+	if (!index)
+	{
+		unique_lock<shared_mutex> lock(m_sourcesMutex);
+		auto [it, inserted] = m_sourceIndices.emplace(_source.get(), static_cast<unsigned>(m_sources.size()));
+		if (inserted)
+			m_sourceTable.publish(it->second, &m_sources.emplace_back(_source));
+		index = it->second;
+	}
+	cache = SourceIndexCache{m_generation, _source.get(), index};
+	return index;
+}
+
+YulStringRepository::Handle YulStringRepository::stringToHandle(string_view _string)
+{
+	if (_string.empty())
+		return { 0, emptyHash() };
+	uint64_t h = hash(_string);
+	Shard& shard = m_shards[h % c_shardCount];
+	{
+		shared_lock<shared_mutex> lock(shard.mutex);
+		if (optional<size_t> id = find(shard, h, _string))
+			return Handle{*id, h};
+	}
+
+	unique_lock<shared_mutex> lock(shard.mutex);
+	// Another thread might have added the string in the meantime.
+	if (optional<size_t> id = find(shard, h, _string))
+		return Handle{*id, h};
+	string const& stored = shard.strings.emplace_back(string(_string));
+	size_t id = m_nextID.fetch_add(1, memory_order_relaxed);
+	m_strings.publish(id, &stored);
+	shard.hashToID.emplace(h, id);
+
+	return Handle{id, h};
+}
+
+optional<size_t> YulStringRepository::find(Shard const& _shard, uint64_t _hash, string_view _string) const
+{
+	auto range = _shard.hashToID.equal_range(_hash);
+	for (auto it = range.first; it != range.second; ++it)
+		if (idToString(it->second) == _string)
+			return it->second;
+	return nullopt;
+}
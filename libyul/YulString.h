@@ -23,11 +23,24 @@
 
 #include <boost/noncopyable.hpp>
 
-#include <unordered_map>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <map>
 #include <memory>
-#include <vector>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <string>
-#include <functional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace solidity::langutil
+{
+class CharStream;
+}
 
 namespace solidity::yul
 {
@@ -36,7 +49,17 @@ namespace solidity::yul
 /// Owns the string data for all YulStrings, which can be referenced by a Handle.
 /// A Handle consists of an ID (that depends on the insertion order of YulStrings and is potentially
 /// non-deterministic) and a deterministic string hash.
-class YulStringRepository
+///
+/// Every thread uses the repository installed via setCurrent() or a Scope, or the process-wide
+/// default repository if there is none. YulStrings of different repositories must not be mixed.
+///
+/// The repository can be used from multiple threads concurrently: Strings are interned into one
+/// of several shards selected by their hash, each protected by its own lock, and looking up the
+/// string of an ID does not lock at all, since stored strings are never moved or removed.
+///
+/// As Yul ASTs are bound to the repository of their strings anyway, it also keeps the sources
+/// their locations refer to, see yul::Location. Looking up a source does not lock either.
+class YulStringRepository: boost::noncopyable
 {
 public:
 	struct Handle
@@ -45,30 +68,63 @@ public:
 		std::uint64_t hash;
 	};
 
-	static YulStringRepository& instance()
+	YulStringRepository();
+	~YulStringRepository();
+
+	/// @returns the repository of the current thread.
+	static YulStringRepository& instance();
+	/// Sets the repository used by the current thread, nullptr selects the default repository.
+	/// @returns the previously set repository.
+	static YulStringRepository* setCurrent(YulStringRepository* _repository);
+
+	/// Installs a repository as the current one of this thread for the lifetime of the object.
+	/// If no repository is given, a new one is created and destroyed together with the scope.
+	class Scope: boost::noncopyable
 	{
-		static YulStringRepository inst;
-		return inst;
-	}
+	public:
+		Scope();
+		explicit Scope(YulStringRepository& _repository);
+		~Scope();
+
+		YulStringRepository& repository() const { return *m_repository; }
+
+	private:
+		std::unique_ptr<YulStringRepository> m_ownedRepository;
+		YulStringRepository* m_repository = nullptr;
+		YulStringRepository* m_previous = nullptr;
+	};
+
+	Handle stringToHandle(std::string_view _string);
+	std::string const& idToString(size_t _id) const { return *m_strings[_id]; }
 
-	Handle stringToHandle(std::string const& _string)
+	/// @returns the number of distinct strings in the repository, including the empty string.
+	size_t size() const { return m_nextID.load(std::memory_order_relaxed); }
+
+	/// @returns the object stored under @a _key, which is created by calling @a _create on first
+	/// access. Objects referring to YulStrings, like dialects, are cached here instead of in
+	/// static variables, so that they are never used with the strings of another repository.
+	template <class T, class Create>
+	T const& cached(std::string const& _key, Create&& _create)
 	{
-		if (_string.empty())
-			return { 0, emptyHash() };
-		std::uint64_t h = hash(_string);
-		auto range = m_hashToID.equal_range(h);
-		for (auto it = range.first; it != range.second; ++it)
-			if (*m_strings[it->second] == _string)
-				return Handle{it->second, h};
-		m_strings.emplace_back(std::make_shared<std::string>(_string));
-		size_t id = m_strings.size() - 1;
-		m_hashToID.emplace_hint(range.second, std::make_pair(h, id));
-
-		return Handle{id, h};
+		{
+			std::lock_guard<std::mutex> lock(m_cacheMutex);
+			auto it = m_cache.find(_key);
+			if (it != m_cache.end())
+				return *static_cast<T const*>(it->second.get());
+		}
+		// Create the object without holding the lock, since it might access the cache itself.
+		std::shared_ptr<T const> object = _create();
+		std::lock_guard<std::mutex> lock(m_cacheMutex);
+		return *static_cast<T const*>(m_cache.emplace(_key, std::move(object)).first->second.get());
 	}
-	std::string const& idToString(size_t _id) const	{ return *m_strings.at(_id); }
 
-	static std::uint64_t hash(std::string const& v)
+	/// @returns the index of @a _source in the table of sources referenced by Yul AST nodes,
+	/// adding it if needed. Index zero stands for no source.
+	unsigned sourceIndex(std::shared_ptr<langutil::CharStream> const& _source);
+	/// @returns the source with index @a _index, which has to be returned by sourceIndex() before.
+	std::shared_ptr<langutil::CharStream> const& source(unsigned _index) const { return *m_sourceTable[_index]; }
+
+	static std::uint64_t hash(std::string_view v)
 	{
 		// FNV hash - can be replaced by a better one, e.g. xxhash64
 		std::uint64_t hash = emptyHash();
@@ -81,41 +137,87 @@ public:
 		return hash;
 	}
 	static constexpr std::uint64_t emptyHash() { return 14695981039346656037u; }
-	/// Clear the repository.
-	/// Use with care - there cannot be any dangling YulString references.
-	/// If references need to be cleared manually, register the callback via
-	/// resetCallback.
-	static void reset()
-	{
-		for (auto const& cb: resetCallbacks())
-			cb();
-		instance() = YulStringRepository{};
-	}
-	/// Struct that registers a reset callback as a side-effect of its construction.
-	/// Useful as static local variable to register a reset callback once.
-	struct ResetCallback
+
+private:
+	/// Interned strings with the same hash modulo this number share a lock.
+	static constexpr size_t c_shardCount = 64;
+
+	/// Table of pointers to the entries with consecutive IDs. The pointers are stored in segments
+	/// that are never reallocated, so that they can be read without locking. The first segment
+	/// has c_firstSegmentSize entries and every further segment is twice as large as the previous one.
+	template <class T>
+	class Table: boost::noncopyable
 	{
-		ResetCallback(std::function<void()> _fun)
+	public:
+		~Table()
 		{
-			YulStringRepository::resetCallbacks().emplace_back(std::move(_fun));
+			for (auto& segment: m_segments)
+				delete[] segment.load(std::memory_order_relaxed);
 		}
-	};
 
-private:
-	YulStringRepository() = default;
-	YulStringRepository(YulStringRepository const&) = delete;
-	YulStringRepository(YulStringRepository&&) = default;
-	YulStringRepository& operator=(YulStringRepository const& _rhs) = delete;
-	YulStringRepository& operator=(YulStringRepository&& _rhs) = default;
+		T const* operator[](size_t _id) const
+		{
+			size_t segment = segmentOf(_id);
+			return m_segments[segment].load(std::memory_order_acquire)[_id - segmentStart(segment)];
+		}
+
+		/// Publishes the location of the entry with ID @a _id, allocating a new segment if needed.
+		void publish(size_t _id, T const* _entry)
+		{
+			size_t segment = segmentOf(_id);
+			T const** entries = m_segments[segment].load(std::memory_order_acquire);
+			if (!entries)
+			{
+				T const** allocated = new T const*[c_firstSegmentSize << segment]();
+				if (m_segments[segment].compare_exchange_strong(entries, allocated, std::memory_order_acq_rel))
+					entries = allocated;
+				else
+					// Another thread was faster, ``entries`` now holds its segment.
+					delete[] allocated;
+			}
+			entries[_id - segmentStart(segment)] = _entry;
+		}
 
-	static std::vector<std::function<void()>>& resetCallbacks()
+	private:
+		static constexpr size_t c_firstSegmentSize = 1024;
+		static constexpr size_t c_segmentCount = 48;
+
+		static size_t segmentOf(size_t _id)
+		{
+			size_t segment = 0;
+			for (size_t blocks = _id / c_firstSegmentSize + 1; blocks > 1; blocks >>= 1)
+				++segment;
+			return segment;
+		}
+		static size_t segmentStart(size_t _segment) { return ((size_t(1) << _segment) - 1) * c_firstSegmentSize; }
+
+		std::array<std::atomic<T const**>, c_segmentCount> m_segments{};
+	};
+
+	struct Shard
 	{
-		static std::vector<std::function<void()>> callbacks;
-		return callbacks;
-	}
+		std::shared_mutex mutex;
+		std::unordered_multimap<std::uint64_t, size_t> hashToID;
+		/// Storage of the strings; a deque does not move its elements when growing.
+		std::deque<std::string> strings;
+	};
+
+	/// @returns the ID of @a _string if it is stored in @a _shard. Requires the shard to be locked.
+	std::optional<size_t> find(Shard const& _shard, std::uint64_t _hash, std::string_view _string) const;
+	std::array<Shard, c_shardCount> m_shards;
+	Table<std::string> m_strings;
+	std::atomic<size_t> m_nextID{1};
+
+	std::mutex m_cacheMutex;
+	std::map<std::string, std::shared_ptr<void const>> m_cache;
 
-	std::vector<std::shared_ptr<std::string>> m_strings = {std::make_shared<std::string>()};
-	std::unordered_multimap<std::uint64_t, size_t> m_hashToID = {{emptyHash(), 0}};
+	/// Distinguishes repositories that were allocated at the same address.
+	std::uint64_t const m_generation;
+	std::shared_mutex m_sourcesMutex;
+	/// Storage of the sources; a deque does not move its elements when growing.
+	std::deque<std::shared_ptr<langutil::CharStream>> m_sources;
+	std::map<langutil::CharStream const*, unsigned> m_sourceIndices;
+	Table<std::shared_ptr<langutil::CharStream>> m_sourceTable;
 };
 
 /// Wrapper around handles into the YulString repository.
@@ -126,7 +228,7 @@ class YulString
 {
 public:
 	YulString() = default;
-	explicit YulString(std::string const& _s): m_handle(YulStringRepository::instance().stringToHandle(_s)) {}
+	explicit YulString(std::string_view _s): m_handle(YulStringRepository::instance().stringToHandle(_s)) {}
 	YulString(YulString const&) = default;
 	YulString(YulString&&) = default;
 	YulString& operator=(YulString const&) = default;
@@ -156,6 +258,9 @@ public:
 	}
 
 	uint64_t hash() const { return m_handle.hash; }
+	/// @returns the ID of the string, which identifies it within its repository, but depends
+	/// on the order in which strings were added to it.
+	size_t id() const { return m_handle.id; }
 
 private:
 	/// Handle of the string. Assumes that the empty string has ID zero.
@@ -164,7 +269,7 @@ private:
 
 inline YulString operator "" _yulstring(char const* _string, std::size_t _size)
 {
-	return YulString(std::string(_string, _size));
+	return YulString(std::string_view(_string, _size));
 }
 
 }
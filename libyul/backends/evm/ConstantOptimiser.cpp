@@ -26,8 +26,15 @@
 #include <libyul/AsmData.h>
 #include <libyul/Utilities.h>
 
+#include <libevmasm/AssemblyItem.h>
+#include <libevmasm/ConstantOptimiser.h>
+#include <libevmasm/GasProfile.h>
+
 #include <libsolutil/CommonData.h>
 
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/range/adaptor/reversed.hpp>
+
 #include <variant>
 
 using namespace std;
@@ -88,6 +95,50 @@ struct MiniEVMInterpreter
 
 	EVMDialect const& m_dialect;
 };
+
+/// Appends the items that evaluate @a _expression, which only consists of number literals
+/// and calls to builtins for instructions, to @a _routine.
+void appendRoutine(Expression const& _expression, EVMDialect const& _dialect, evmasm::AssemblyItems& _routine)
+{
+	if (auto const* literal = get_if<Literal>(&_expression))
+		_routine.emplace_back(valueOfLiteral(*literal));
+	else
+	{
+		FunctionCall const& functionCall = std::get<FunctionCall>(_expression);
+		// The first argument ends up on top of the stack.
+		for (auto const& argument: functionCall.arguments | boost::adaptors::reversed)
+			appendRoutine(argument, _dialect, _routine);
+		BuiltinFunctionForEVM const* builtin = _dialect.builtin(functionCall.functionName.name);
+		yulAssert(builtin && builtin->instruction, "Expected EVM instruction.");
+		_routine.emplace_back(*builtin->instruction);
+	}
+}
+
+/// Inverse of appendRoutine, using @a _location for all nodes.
+Expression expressionFromRoutine(evmasm::AssemblyItems const& _routine, Location const& _location)
+{
+	vector<Expression> stack;
+	for (evmasm::AssemblyItem const& item: _routine)
+		if (item.type() == evmasm::Push)
+			stack.emplace_back(Literal{_location, LiteralKind::Number, YulString{formatNumber(item.data())}, {}});
+		else
+		{
+			yulAssert(item.type() == evmasm::Operation && stack.size() >= item.arguments(), "");
+			FunctionCall functionCall{
+				_location,
+				Identifier{_location, YulString{boost::algorithm::to_lower_copy(evmasm::instructionInfo(item.instruction()).name)}},
+				{}
+			};
+			for (size_t i = 0; i < item.arguments(); ++i)
+			{
+				functionCall.arguments.emplace_back(move(stack.back()));
+				stack.pop_back();
+			}
+			stack.emplace_back(move(functionCall));
+		}
+	yulAssert(stack.size() == 1, "");
+	return move(stack.back());
+}
 }
 
 void ConstantOptimiser::visit(Expression& _e)
@@ -98,12 +149,41 @@ void ConstantOptimiser::visit(Expression& _e)
 		if (literal.kind != LiteralKind::Number)
 			return;
 
-		if (
-			Expression const* repr =
-				RepresentationFinder(m_dialect, m_meter, locationOf(_e), m_cache)
-				.tryFindRepresentation(valueOfLiteral(literal))
-		)
-			_e = ASTCopier{}.translate(*repr);
+		u256 value = valueOfLiteral(literal);
+		if (value < 0x10000)
+			// Very small value, not worth computing
+			return;
+
+		size_t runs = m_meter.runs();
+		if (m_gasProfile && !m_meter.isCreation())
+			runs = m_gasProfile->executions(literal.location.toSourceLocation(m_dialect.repository)).value_or(runs);
+		evmasm::AssemblyItems routine = evmasm::ConstantRoutineCache::routine(
+			{
+				evmasm::ConstantRoutineCache::CostModel::Yul,
+				value,
+				runs,
+				m_meter.isCreation(),
+				0,
+				m_dialect.evmVersion()
+			},
+			[&]() {
+				GasMeter meter(m_dialect, m_meter.isCreation(), runs);
+				map<u256, Representation> cache;
+				evmasm::AssemblyItems items;
+				if (
+					Expression const* repr =
+						RepresentationFinder(m_dialect, meter, {}, cache)
+						.tryFindRepresentation(value)
+				)
+					appendRoutine(*repr, m_dialect, items);
+				else
+					items.emplace_back(value);
+				return items;
+			}
+		);
+		// A single item is the literal itself.
+		if (routine.size() > 1)
+			_e = expressionFromRoutine(routine, locationOf(_e));
 	}
 	else
 		ASTModifier::visit(_e);
@@ -111,9 +191,6 @@ void ConstantOptimiser::visit(Expression& _e)
 
 Expression const* RepresentationFinder::tryFindRepresentation(u256 const& _value)
 {
-	if (_value < 0x10000)
-		return nullptr;
-
 	Representation const& repr = findRepresentation(_value);
 	if (holds_alternative<Literal>(*repr.expression))
 		return nullptr;
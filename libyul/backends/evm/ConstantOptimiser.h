@@ -35,6 +35,11 @@
 #include <map>
 #include <memory>
 
+namespace solidity::evmasm
+{
+class GasProfile;
+}
+
 namespace solidity::yul
 {
 struct Dialect;
@@ -43,14 +48,24 @@ class GasMeter;
 /**
  * Optimisation stage that replaces constants by expressions that compute them.
  *
+ * The cheapest representations are memoised in the evmasm::ConstantRoutineCache,
+ * which is shared among all runs and with the legacy constant optimiser.
+ * If a gas profile is given, the executions it lists for the location of a literal
+ * in runtime code replace the runs of the gas meter.
+ *
  * Prerequisite: None
  */
 class ConstantOptimiser: public ASTModifier
 {
 public:
-	ConstantOptimiser(EVMDialect const& _dialect, GasMeter const& _meter):
+	ConstantOptimiser(
+		EVMDialect const& _dialect,
+		GasMeter const& _meter,
+		evmasm::GasProfile const* _gasProfile = nullptr
+	):
 		m_dialect(_dialect),
-		m_meter(_meter)
+		m_meter(_meter),
+		m_gasProfile(_gasProfile)
 	{}
 
 	void visit(Expression& _e) override;
@@ -64,7 +79,7 @@ public:
 private:
 	EVMDialect const& m_dialect;
 	GasMeter const& m_meter;
-	std::map<u256, Representation> m_cache;
+	evmasm::GasProfile const* m_gasProfile = nullptr;
 };
 
 class RepresentationFinder
@@ -74,7 +89,7 @@ public:
 	RepresentationFinder(
 		EVMDialect const& _dialect,
 		GasMeter const& _meter,
-		langutil::SourceLocation _location,
+		Location _location,
 		std::map<u256, Representation>& _cache
 	):
 		m_dialect(_dialect),
@@ -84,7 +99,7 @@ public:
 	{}
 
 	/// @returns a cheaper representation for the number than its representation
-	/// as a literal or nullptr otherwise.
+	/// as a literal or nullptr otherwise. Numbers below 0x10000 are not worth computing.
 	Expression const* tryFindRepresentation(u256 const& _value);
 
 private:
@@ -100,7 +115,7 @@ private:
 
 	EVMDialect const& m_dialect;
 	GasMeter const& m_meter;
-	langutil::SourceLocation m_location;
+	Location m_location;
 	/// Counter for the complexity of optimization, will stop when it reaches zero.
 	size_t m_maxSteps = 10000;
 	std::map<u256, Representation>& m_cache;
@@ -26,10 +26,14 @@
 #include <libyul/AsmData.h>
 #include <libyul/Utilities.h>
 
+#include <libevmasm/GasMeter.h>
+
 #include <liblangutil/Exceptions.h>
 
 #include <boost/range/adaptor/reversed.hpp>
 
+#include <algorithm>
+#include <functional>
 #include <utility>
 #include <variant>
 
@@ -38,6 +42,65 @@ using namespace solidity;
 using namespace solidity::yul;
 using namespace solidity::util;
 
+namespace
+{
+
+using evmasm::GasMeter;
+using evmasm::Instruction;
+
+/// Gas of comparing the switch expression with a constant and jumping on the result.
+double switchComparisonCost(Instruction _comparison)
+{
+	return
+		2 * GasMeter::runGas(Instruction::PUSH1) +
+		GasMeter::runGas(Instruction::DUP2) +
+		GasMeter::runGas(_comparison) +
+		GasMeter::runGas(Instruction::JUMPI);
+}
+
+/// Expected gas of comparing the switch expression with @a _cases values one after the
+/// other until one matches, assuming that all cases and the default case are taken equally often.
+/// If @a _jumpToDefault is true, the default case is reached through a jump.
+double linearSwitchCost(size_t _cases, bool _jumpToDefault)
+{
+	double const cases = static_cast<double>(_cases);
+	double total =
+		switchComparisonCost(Instruction::EQ) * (cases * (cases + 1) / 2 + cases) +
+		GasMeter::runGas(Instruction::JUMPDEST) * cases;
+	if (_jumpToDefault)
+		total +=
+			GasMeter::runGas(Instruction::PUSH1) +
+			GasMeter::runGas(Instruction::JUMP) +
+			GasMeter::runGas(Instruction::JUMPDEST);
+	return total / (cases + 1);
+}
+
+double binarySwitchCost(size_t _cases);
+
+/// Expected gas of comparing the switch expression with the middle one of @a _cases sorted
+/// values and continuing the search in the lower or upper half.
+double splitSwitchCost(size_t _cases)
+{
+	size_t lower = _cases / 2;
+	// The default case is assumed to be taken equally often from both halves.
+	double lowerShare = (static_cast<double>(lower) + 0.5) / static_cast<double>(_cases + 1);
+	return
+		switchComparisonCost(Instruction::LT) +
+		lowerShare * (GasMeter::runGas(Instruction::JUMPDEST) + binarySwitchCost(lower)) +
+		(1 - lowerShare) * binarySwitchCost(_cases - lower);
+}
+
+/// Expected gas of the cheapest combination of splits and linear searches for @a _cases values.
+double binarySwitchCost(size_t _cases)
+{
+	double cost = linearSwitchCost(_cases, true);
+	if (_cases >= 2)
+		cost = min(cost, splitSwitchCost(_cases));
+	return cost;
+}
+
+}
+
 void VariableReferenceCounter::operator()(Identifier const& _identifier)
 {
 	increaseRefIfFound(_identifier.name);
@@ -187,13 +250,13 @@ void CodeTransform::operator()(VariableDeclaration const& _varDecl)
 	}
 	else
 	{
-		m_assembly.setSourceLocation(_varDecl.location);
+		setSourceLocation(_varDecl.location);
 		size_t variablesLeft = numVariables;
 		while (variablesLeft--)
 			m_assembly.appendConstant(u256(0));
 	}
 
-	m_assembly.setSourceLocation(_varDecl.location);
+	setSourceLocation(_varDecl.location);
 	bool atTopOfStack = true;
 	for (size_t varIndex = 0; varIndex < numVariables; ++varIndex)
 	{
@@ -247,13 +310,13 @@ void CodeTransform::operator()(Assignment const& _assignment)
 	std::visit(*this, *_assignment.value);
 	expectDeposit(static_cast<int>(_assignment.variableNames.size()), height);
 
-	m_assembly.setSourceLocation(_assignment.location);
+	setSourceLocation(_assignment.location);
 	generateMultiAssignment(_assignment.variableNames);
 }
 
 void CodeTransform::operator()(ExpressionStatement const& _statement)
 {
-	m_assembly.setSourceLocation(_statement.location);
+	setSourceLocation(_statement.location);
 	std::visit(*this, _statement.expression);
 }
 
@@ -267,7 +330,7 @@ void CodeTransform::operator()(FunctionCall const& _call)
 		});
 	else
 	{
-		m_assembly.setSourceLocation(_call.location);
+		setSourceLocation(_call.location);
 		EVMAssembly::LabelID returnLabel(numeric_limits<EVMAssembly::LabelID>::max()); // only used for evm 1.0
 		if (!m_evm15)
 		{
@@ -284,7 +347,7 @@ void CodeTransform::operator()(FunctionCall const& _call)
 		yulAssert(function->arguments.size() == _call.arguments.size(), "");
 		for (auto const& arg: _call.arguments | boost::adaptors::reversed)
 			visitExpression(arg);
-		m_assembly.setSourceLocation(_call.location);
+		setSourceLocation(_call.location);
 		if (m_evm15)
 			m_assembly.appendJumpsub(
 				functionEntryID(_call.functionName.name, *function),
@@ -305,7 +368,7 @@ void CodeTransform::operator()(FunctionCall const& _call)
 
 void CodeTransform::operator()(Identifier const& _identifier)
 {
-	m_assembly.setSourceLocation(_identifier.location);
+	setSourceLocation(_identifier.location);
 	// First search internals, then externals.
 	yulAssert(m_scope, "");
 	if (m_scope->lookup(_identifier.name, GenericVisitor{
@@ -337,19 +400,19 @@ void CodeTransform::operator()(Identifier const& _identifier)
 
 void CodeTransform::operator()(Literal const& _literal)
 {
-	m_assembly.setSourceLocation(_literal.location);
+	setSourceLocation(_literal.location);
 	m_assembly.appendConstant(valueOfLiteral(_literal));
 }
 
 void CodeTransform::operator()(If const& _if)
 {
 	visitExpression(*_if.condition);
-	m_assembly.setSourceLocation(_if.location);
+	setSourceLocation(_if.location);
 	m_assembly.appendInstruction(evmasm::Instruction::ISZERO);
 	AbstractAssembly::LabelID end = m_assembly.newLabelId();
 	m_assembly.appendJumpToIf(end);
 	(*this)(_if.body);
-	m_assembly.setSourceLocation(_if.location);
+	setSourceLocation(_if.location);
 	m_assembly.appendLabel(end);
 }
 
@@ -361,41 +424,97 @@ void CodeTransform::operator()(Switch const& _switch)
 	int expressionHeight = m_assembly.stackHeight();
 	map<Case const*, AbstractAssembly::LabelID> caseBodies;
 	AbstractAssembly::LabelID end = m_assembly.newLabelId();
-	for (Case const& c: _switch.cases)
+	size_t numValueCases = _switch.cases.size() - (_switch.cases.back().value ? 0 : 1);
+	if (binarySwitchCost(numValueCases) < linearSwitchCost(numValueCases, false))
 	{
-		if (c.value)
+		vector<pair<u256, Case const*>> sortedCases;
+		for (Case const& c: _switch.cases)
+			if (c.value)
+			{
+				sortedCases.emplace_back(valueOfLiteral(*c.value), &c);
+				caseBodies[&c] = m_assembly.newLabelId();
+			}
+		sort(sortedCases.begin(), sortedCases.end(), [](auto const& _a, auto const& _b) {
+			return _a.first < _b.first;
+		});
+		AbstractAssembly::LabelID defaultCase = m_assembly.newLabelId();
+
+		// Binary search over the case values that switches to linear search for small ranges.
+		function<void(size_t, size_t)> appendSearch = [&](size_t _begin, size_t _end)
 		{
-			(*this)(*c.value);
-			m_assembly.setSourceLocation(c.location);
-			AbstractAssembly::LabelID bodyLabel = m_assembly.newLabelId();
-			caseBodies[&c] = bodyLabel;
-			yulAssert(m_assembly.stackHeight() == expressionHeight + 1, "");
-			m_assembly.appendInstruction(evmasm::dupInstruction(2));
-			m_assembly.appendInstruction(evmasm::Instruction::EQ);
-			m_assembly.appendJumpToIf(bodyLabel);
-		}
-		else
-			// default case
-			(*this)(c.body);
+			yulAssert(m_assembly.stackHeight() == expressionHeight, "");
+			size_t numCases = _end - _begin;
+			if (numCases < 2 || linearSwitchCost(numCases, true) <= splitSwitchCost(numCases))
+			{
+				for (size_t i = _begin; i < _end; ++i)
+				{
+					setSourceLocation(sortedCases[i].second->location);
+					m_assembly.appendConstant(sortedCases[i].first);
+					m_assembly.appendInstruction(evmasm::dupInstruction(2));
+					m_assembly.appendInstruction(evmasm::Instruction::EQ);
+					m_assembly.appendJumpToIf(caseBodies.at(sortedCases[i].second));
+				}
+				setSourceLocation(_switch.location);
+				m_assembly.appendJumpTo(defaultCase);
+			}
+			else
+			{
+				size_t middle = _begin + numCases / 2;
+				AbstractAssembly::LabelID lowerHalf = m_assembly.newLabelId();
+				setSourceLocation(_switch.location);
+				m_assembly.appendConstant(sortedCases[middle].first);
+				m_assembly.appendInstruction(evmasm::dupInstruction(2));
+				m_assembly.appendInstruction(evmasm::Instruction::LT);
+				m_assembly.appendJumpToIf(lowerHalf);
+				appendSearch(middle, _end);
+				setSourceLocation(_switch.location);
+				m_assembly.appendLabel(lowerHalf);
+				appendSearch(_begin, middle);
+			}
+		};
+		appendSearch(0, sortedCases.size());
+
+		setSourceLocation(_switch.location);
+		m_assembly.appendLabel(defaultCase);
+		if (!_switch.cases.back().value)
+			(*this)(_switch.cases.back().body);
 	}
-	m_assembly.setSourceLocation(_switch.location);
+	else
+		for (Case const& c: _switch.cases)
+		{
+			if (c.value)
+			{
+				(*this)(*c.value);
+				setSourceLocation(c.location);
+				AbstractAssembly::LabelID bodyLabel = m_assembly.newLabelId();
+				caseBodies[&c] = bodyLabel;
+				yulAssert(m_assembly.stackHeight() == expressionHeight + 1, "");
+				m_assembly.appendInstruction(evmasm::dupInstruction(2));
+				m_assembly.appendInstruction(evmasm::Instruction::EQ);
+				m_assembly.appendJumpToIf(bodyLabel);
+			}
+			else
+				// default case
+				(*this)(c.body);
+		}
+	setSourceLocation(_switch.location);
 	m_assembly.appendJumpTo(end);
 
 	size_t numCases = caseBodies.size();
 	for (auto const& c: caseBodies)
 	{
-		m_assembly.setSourceLocation(c.first->location);
+		setSourceLocation(c.first->location);
 		m_assembly.appendLabel(c.second);
 		(*this)(c.first->body);
 		// Avoid useless "jump to next" for the last case.
 		if (--numCases > 0)
 		{
-			m_assembly.setSourceLocation(c.first->location);
+			setSourceLocation(c.first->location);
 			m_assembly.appendJumpTo(end);
 		}
 	}
 
-	m_assembly.setSourceLocation(_switch.location);
+	setSourceLocation(_switch.location);
 	m_assembly.appendLabel(end);
 	m_assembly.appendInstruction(evmasm::Instruction::POP);
 }
@@ -416,7 +535,7 @@ void CodeTransform::operator()(FunctionDefinition const& _function)
 		m_context->variableStackHeights[&var] = height++;
 	}
 
-	m_assembly.setSourceLocation(_function.location);
+	setSourceLocation(_function.location);
 	int const stackHeightBefore = m_assembly.stackHeight();
 
 	if (m_evm15)
@@ -533,11 +652,11 @@ void CodeTransform::operator()(ForLoop const& _forLoop)
 	AbstractAssembly::LabelID postPart = m_assembly.newLabelId();
 	AbstractAssembly::LabelID loopEnd = m_assembly.newLabelId();
 
-	m_assembly.setSourceLocation(_forLoop.location);
+	setSourceLocation(_forLoop.location);
 	m_assembly.appendLabel(loopStart);
 
 	visitExpression(*_forLoop.condition);
-	m_assembly.setSourceLocation(_forLoop.location);
+	setSourceLocation(_forLoop.location);
 	m_assembly.appendInstruction(evmasm::Instruction::ISZERO);
 	m_assembly.appendJumpToIf(loopEnd);
 
@@ -545,12 +664,12 @@ void CodeTransform::operator()(ForLoop const& _forLoop)
 	m_context->forLoopStack.emplace(Context::ForLoopLabels{ {postPart, stackHeightBody}, {loopEnd, stackHeightBody} });
 	(*this)(_forLoop.body);
 
-	m_assembly.setSourceLocation(_forLoop.location);
+	setSourceLocation(_forLoop.location);
 	m_assembly.appendLabel(postPart);
 
 	(*this)(_forLoop.post);
 
-	m_assembly.setSourceLocation(_forLoop.location);
+	setSourceLocation(_forLoop.location);
 	m_assembly.appendJumpTo(loopStart);
 	m_assembly.appendLabel(loopEnd);
 
@@ -570,7 +689,7 @@ int CodeTransform::appendPopUntil(int _targetDepth)
 void CodeTransform::operator()(Break const& _break)
 {
 	yulAssert(!m_context->forLoopStack.empty(), "Invalid break-statement. Requires surrounding for-loop in code generation.");
-	m_assembly.setSourceLocation(_break.location);
+	setSourceLocation(_break.location);
 
 	Context::JumpInfo const& jump = m_context->forLoopStack.top().done;
 	m_assembly.appendJumpTo(jump.label, appendPopUntil(jump.targetStackHeight));
@@ -579,7 +698,7 @@ void CodeTransform::operator()(Break const& _break)
 void CodeTransform::operator()(Continue const& _continue)
 {
 	yulAssert(!m_context->forLoopStack.empty(), "Invalid continue-statement. Requires surrounding for-loop in code generation.");
-	m_assembly.setSourceLocation(_continue.location);
+	setSourceLocation(_continue.location);
 
 	Context::JumpInfo const& jump = m_context->forLoopStack.top().post;
 	m_assembly.appendJumpTo(jump.label, appendPopUntil(jump.targetStackHeight));
@@ -588,7 +707,7 @@ void CodeTransform::operator()(Continue const& _continue)
 void CodeTransform::operator()(Leave const& _leaveStatement)
 {
 	yulAssert(!m_context->functionExitPoints.empty(), "Invalid leave-statement. Requires surrounding function in code generation.");
-	m_assembly.setSourceLocation(_leaveStatement.location);
+	setSourceLocation(_leaveStatement.location);
 
 	Context::JumpInfo const& jump = m_context->functionExitPoints.top();
 	m_assembly.appendJumpTo(jump.label, appendPopUntil(jump.targetStackHeight));
@@ -619,6 +738,11 @@ AbstractAssembly::LabelID CodeTransform::functionEntryID(YulString _name, Scope:
 	return m_context->functionEntryIDs[&_function];
 }
 
+void CodeTransform::setSourceLocation(Location const& _location)
+{
+	m_assembly.setSourceLocation(_location.toSourceLocation(m_dialect.repository));
+}
+
 void CodeTransform::visitExpression(Expression const& _expression)
 {
 	int height = m_assembly.stackHeight();
@@ -636,7 +760,7 @@ void CodeTransform::visitStatements(vector<Statement> const& _statements)
 		auto const* functionDefinition = std::get_if<FunctionDefinition>(&statement);
 		if (functionDefinition && !jumpTarget)
 		{
-			m_assembly.setSourceLocation(locationOf(statement));
+			setSourceLocation(locationOf(statement));
 			jumpTarget = m_assembly.newLabelId();
 			m_assembly.appendJumpTo(*jumpTarget, 0);
 		}
@@ -657,7 +781,7 @@ void CodeTransform::visitStatements(vector<Statement> const& _statements)
 
 void CodeTransform::finalizeBlock(Block const& _block, int blockStartStackHeight)
 {
-	m_assembly.setSourceLocation(_block.location);
+	setSourceLocation(_block.location);
 
 	freeUnusedVariables();
 
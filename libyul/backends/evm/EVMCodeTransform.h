@@ -192,6 +192,9 @@ private:
 
 	void visitStatements(std::vector<Statement> const& _statements);
 
+	/// Sets the source location of the following instructions to @a _location.
+	void setSourceLocation(Location const& _location);
+
 	/// Pops all variables declared in the block and checks that the stack height is equal
 	/// to @a _blackStartStackHeight.
 	void finalizeBlock(Block const& _block, int _blockStartStackHeight);
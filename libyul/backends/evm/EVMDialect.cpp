@@ -46,19 +46,21 @@ namespace
 void visitArguments(
 	AbstractAssembly& _assembly,
 	FunctionCall const& _call,
-	function<void(Expression const&)> _visitExpression
+	function<void(Expression const&)> _visitExpression,
+	YulStringRepository const& _repository
 )
 {
 	for (auto const& arg: _call.arguments | boost::adaptors::reversed)
 		_visitExpression(arg);
 
-	_assembly.setSourceLocation(_call.location);
+	_assembly.setSourceLocation(_call.location.toSourceLocation(_repository));
 }
 
 
 pair<YulString, BuiltinFunctionForEVM> createEVMFunction(
 	string const& _name,
-	evmasm::Instruction _instruction
+	evmasm::Instruction _instruction,
+	YulStringRepository const& _repository
 )
 {
 	evmasm::InstructionInfo info = evmasm::instructionInfo(_instruction);
@@ -72,13 +74,13 @@ pair<YulString, BuiltinFunctionForEVM> createEVMFunction(
 	f.isMSize = _instruction == evmasm::Instruction::MSIZE;
 	f.literalArguments.reset();
 	f.instruction = _instruction;
-	f.generateCode = [_instruction](
+	f.generateCode = [_instruction, &_repository](
 		FunctionCall const& _call,
 		AbstractAssembly& _assembly,
 		BuiltinContext&,
 		std::function<void(Expression const&)> _visitExpression
 	) {
-		visitArguments(_assembly, _call, _visitExpression);
+		visitArguments(_assembly, _call, _visitExpression, _repository);
 		_assembly.appendInstruction(_instruction);
 	};
 
@@ -112,7 +114,11 @@ pair<YulString, BuiltinFunctionForEVM> createFunction(
 	return {name, f};
 }
 
-map<YulString, BuiltinFunctionForEVM> createBuiltins(langutil::EVMVersion _evmVersion, bool _objectAccess)
+map<YulString, BuiltinFunctionForEVM> createBuiltins(
+	langutil::EVMVersion _evmVersion,
+	bool _objectAccess,
+	YulStringRepository const& _repository
+)
 {
 	map<YulString, BuiltinFunctionForEVM> builtins;
 	// NOTE: Parser::instructions() will filter JUMPDEST and PUSHnn too
@@ -126,7 +132,7 @@ map<YulString, BuiltinFunctionForEVM> createBuiltins(langutil::EVMVersion _evmVe
 			instr.second != evmasm::Instruction::JUMPDEST &&
 			_evmVersion.hasOpcode(instr.second)
 		)
-			builtins.emplace(createEVMFunction(instr.first, instr.second));
+			builtins.emplace(createEVMFunction(instr.first, instr.second, _repository));
 
 	if (_objectAccess)
 	{
@@ -190,13 +196,13 @@ map<YulString, BuiltinFunctionForEVM> createBuiltins(langutil::EVMVersion _evmVe
 			0,
 			SideEffects{false, false, false, false, true},
 			{},
-			[](
+			[&_repository](
 				FunctionCall const& _call,
 				AbstractAssembly& _assembly,
 				BuiltinContext&,
 				std::function<void(Expression const&)> _visitExpression
 			) {
-				visitArguments(_assembly, _call, _visitExpression);
+				visitArguments(_assembly, _call, _visitExpression, _repository);
 				_assembly.appendInstruction(evmasm::Instruction::CODECOPY);
 			}
 		));
@@ -206,7 +212,7 @@ map<YulString, BuiltinFunctionForEVM> createBuiltins(langutil::EVMVersion _evmVe
 			0,
 			SideEffects{false, false, false, false, true},
 			{true, false},
-			[](
+			[&_repository](
 				FunctionCall const& _call,
 				AbstractAssembly& _assembly,
 				BuiltinContext&,
@@ -215,7 +221,7 @@ map<YulString, BuiltinFunctionForEVM> createBuiltins(langutil::EVMVersion _evmVe
 				yulAssert(_call.arguments.size() == 2, "");
 
 				_visitExpression(_call.arguments[1]);
-				_assembly.setSourceLocation(_call.location);
+				_assembly.setSourceLocation(_call.location.toSourceLocation(_repository));
 				YulString identifier = std::get<Literal>(_call.arguments.front()).value;
 				_assembly.appendImmutableAssignment(identifier.str());
 			}
@@ -246,7 +252,7 @@ map<YulString, BuiltinFunctionForEVM> createBuiltins(langutil::EVMVersion _evmVe
 EVMDialect::EVMDialect(langutil::EVMVersion _evmVersion, bool _objectAccess):
 	m_objectAccess(_objectAccess),
 	m_evmVersion(_evmVersion),
-	m_functions(createBuiltins(_evmVersion, _objectAccess))
+	m_functions(createBuiltins(_evmVersion, _objectAccess, repository))
 {
 }
 
@@ -261,20 +267,16 @@ BuiltinFunctionForEVM const* EVMDialect::builtin(YulString _name) const
 
 EVMDialect const& EVMDialect::strictAssemblyForEVM(langutil::EVMVersion _version)
 {
-	static map<langutil::EVMVersion, unique_ptr<EVMDialect const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
-	if (!dialects[_version])
-		dialects[_version] = make_unique<EVMDialect>(_version, false);
-	return *dialects[_version];
+	return YulStringRepository::instance().cached<EVMDialect>("evm-" + _version.name(), [&]() {
+		return make_unique<EVMDialect>(_version, false);
+	});
 }
 
 EVMDialect const& EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion _version)
 {
-	static map<langutil::EVMVersion, unique_ptr<EVMDialect const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
-	if (!dialects[_version])
-		dialects[_version] = make_unique<EVMDialect>(_version, true);
-	return *dialects[_version];
+	return YulStringRepository::instance().cached<EVMDialect>("evmObjects-" + _version.name(), [&]() {
+		return make_unique<EVMDialect>(_version, true);
+	});
 }
 
 SideEffects EVMDialect::sideEffectsOfInstruction(evmasm::Instruction _instruction)
@@ -334,24 +336,24 @@ EVMDialectTyped::EVMDialectTyped(langutil::EVMVersion _evmVersion, bool _objectA
 	m_functions["popbool"_yulstring] = m_functions["pop"_yulstring];
 	m_functions["popbool"_yulstring].name = "popbool"_yulstring;
 	m_functions["popbool"_yulstring].parameters = {"bool"_yulstring};
-	m_functions.insert(createFunction("bool_to_u256", 1, 1, {}, {}, [](
+	m_functions.insert(createFunction("bool_to_u256", 1, 1, {}, {}, [this](
 		FunctionCall const& _call,
 		AbstractAssembly& _assembly,
 		BuiltinContext&,
 		std::function<void(Expression const&)> _visitExpression
 	) {
-		visitArguments(_assembly, _call, _visitExpression);
+		visitArguments(_assembly, _call, _visitExpression, repository);
 	}));
 	m_functions["bool_to_u256"_yulstring].parameters = {"bool"_yulstring};
 	m_functions["bool_to_u256"_yulstring].returns = {"u256"_yulstring};
-	m_functions.insert(createFunction("u256_to_bool", 1, 1, {}, {}, [](
+	m_functions.insert(createFunction("u256_to_bool", 1, 1, {}, {}, [this](
 		FunctionCall const& _call,
 		AbstractAssembly& _assembly,
 		BuiltinContext&,
 		std::function<void(Expression const&)> _visitExpression
 	) {
 		// A value larger than 1 causes an invalid instruction.
-		visitArguments(_assembly, _call, _visitExpression);
+		visitArguments(_assembly, _call, _visitExpression, repository);
 		_assembly.appendConstant(2);
 		_assembly.appendInstruction(evmasm::Instruction::DUP2);
 		_assembly.appendInstruction(evmasm::Instruction::LT);
@@ -388,9 +390,7 @@ BuiltinFunctionForEVM const* EVMDialectTyped::equalityFunction(YulString _type)
 
 EVMDialectTyped const& EVMDialectTyped::instance(langutil::EVMVersion _version)
 {
-	static map<langutil::EVMVersion, unique_ptr<EVMDialectTyped const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
-	if (!dialects[_version])
-		dialects[_version] = make_unique<EVMDialectTyped>(_version, true);
-	return *dialects[_version];
+	return YulStringRepository::instance().cached<EVMDialectTyped>("evmTyped-" + _version.name(), [&]() {
+		return make_unique<EVMDialectTyped>(_version, true);
+	});
 }
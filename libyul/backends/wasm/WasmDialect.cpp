@@ -152,17 +152,15 @@ BuiltinFunction const* WasmDialect::equalityFunction(YulString _type) const
 
 WasmDialect const& WasmDialect::instance()
 {
-	static std::unique_ptr<WasmDialect> dialect;
-	static YulStringRepository::ResetCallback callback{[&] { dialect.reset(); }};
-	if (!dialect)
-		dialect = make_unique<WasmDialect>();
-	return *dialect;
+	return YulStringRepository::instance().cached<WasmDialect>("wasm", []() {
+		return make_unique<WasmDialect>();
+	});
 }
 
 void WasmDialect::addEthereumExternals()
 {
-	// These are not YulStrings because that would be too complicated with regards
-	// to the YulStringRepository reset.
+	// These are not YulStrings because static YulStrings would refer to
+	// the YulStringRepository that happened to be current at first use.
 	static string const i64{"i64"};
 	static string const i32{"i32"};
 	static string const i32ptr{"i32"}; // Uses "i32" on purpose.
@@ -277,7 +277,7 @@ void WordSizeTransform::rewriteIdentifierList(vector<Identifier>& _ids)
 }
 
 vector<Statement> WordSizeTransform::handleSwitchInternal(
-	langutil::SourceLocation const& _location,
+	Location const& _location,
 	vector<YulString> const& _splitExpressions,
 	vector<Case> _cases,
 	YulString _runDefaultFlag,
@@ -25,6 +25,9 @@
 #include <libyul/YulString.h>
 #include <libyul/AsmData.h>
 
+#include <memory>
+#include <vector>
+
 namespace solidity::yul
 {
 
@@ -106,5 +109,78 @@ private:
 	size_t m_internalIdentifierCount = 0;
 };
 
+/**
+ * Exact description of a function definition that is cheap to compare.
+ * Two fingerprints are equal if and only if the functions are syntactically equal
+ * (apart from source locations). Their hash values are only used to tell different
+ * functions apart quickly, equal hash values are confirmed by comparing the descriptions.
+ *
+ * Names are described by their IDs, so fingerprints can only be compared if they
+ * were created using the same YulStringRepository.
+ */
+class FunctionFingerprint
+{
+public:
+	FunctionFingerprint() = default;
+
+	bool operator==(FunctionFingerprint const& _other) const
+	{
+		return m_hash == _other.m_hash && (m_words == _other.m_words || *m_words == *_other.m_words);
+	}
+	bool operator!=(FunctionFingerprint const& _other) const { return !(*this == _other); }
+
+	uint64_t hash() const { return m_hash; }
+
+private:
+	friend class FunctionHasher;
+
+	uint64_t m_hash = 0;
+	/// The serialised function. Shared, since fingerprints are copied into several caches.
+	std::shared_ptr<std::vector<uint64_t> const> m_words = std::make_shared<std::vector<uint64_t>>();
+};
+
+/**
+ * Optimiser component that calculates the fingerprint of a function definition.
+ * In contrast to BlockHasher, all names are taken into account.
+ */
+class FunctionHasher: public ASTWalker
+{
+public:
+	using ASTWalker::operator();
+
+	void operator()(Literal const&) override;
+	void operator()(Identifier const&) override;
+	void operator()(FunctionCall const& _funCall) override;
+	void operator()(ExpressionStatement const& _statement) override;
+	void operator()(Assignment const& _assignment) override;
+	void operator()(VariableDeclaration const& _varDecl) override;
+	void operator()(If const& _if) override;
+	void operator()(Switch const& _switch) override;
+	void operator()(FunctionDefinition const&) override;
+	void operator()(ForLoop const&) override;
+	void operator()(Break const&) override;
+	void operator()(Continue const&) override;
+	void operator()(Leave const&) override;
+	void operator()(Block const& _block) override;
+
+	static FunctionFingerprint run(FunctionDefinition const& _function);
+
+private:
+	FunctionHasher() = default;
+
+	/// Appends @a _value to the description. Every node starts with a distinct tag that
+	/// determines how many values and child nodes follow, so the description is unambiguous.
+	void hash64(uint64_t _value)
+	{
+		m_words.push_back(_value);
+		m_hash *= BlockHasher::fnvPrime;
+		m_hash ^= _value;
+	}
+	void hashTypedNames(TypedNameList const& _names);
+
+	uint64_t m_hash = BlockHasher::fnvEmptyHash;
+	std::vector<uint64_t> m_words;
+};
+
 
 }
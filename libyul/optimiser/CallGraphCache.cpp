@@ -0,0 +1,106 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Call graph and function side-effects that are kept across optimiser steps.
+ */
+
+#include <libyul/optimiser/CallGraphCache.h>
+
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/AsmData.h>
+
+#include <libsolutil/CommonData.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+CallGraph const& CallGraphCache::callGraph(Block const& _ast)
+{
+	if (update(_ast))
+		m_sideEffects.reset();
+	return m_callGraph;
+}
+
+map<YulString, SideEffects> const& CallGraphCache::sideEffects(Block const& _ast)
+{
+	if (update(_ast) || !m_sideEffects)
+		m_sideEffects = SideEffectsPropagator::sideEffects(m_dialect, m_callGraph);
+	return *m_sideEffects;
+}
+
+CallGraph CallGraphCache::callGraph(OptimiserStepContext& _context, Block const& _ast)
+{
+	if (_context.callGraphCache)
+		return _context.callGraphCache->callGraph(_ast);
+	return CallGraphGenerator::callGraph(_ast);
+}
+
+map<YulString, SideEffects> CallGraphCache::sideEffects(OptimiserStepContext& _context, Block const& _ast)
+{
+	if (_context.callGraphCache)
+		return _context.callGraphCache->sideEffects(_ast);
+	return SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast));
+}
+
+bool CallGraphCache::update(Block const& _ast)
+{
+	CallGraph outside = CallGraphGenerator::callGraphOutsideOfFunctions(_ast);
+	bool changed =
+		outside.functionCalls != m_outside.functionCalls ||
+		outside.functionsWithLoops != m_outside.functionsWithLoops;
+	m_outside = move(outside);
+
+	map<YulString, FunctionCalls> functions;
+	for (Statement const& statement: _ast.statements)
+		if (auto const* function = get_if<FunctionDefinition>(&statement))
+		{
+			auto fingerprint = m_fingerprints.find(function->name);
+			if (fingerprint == m_fingerprints.end())
+				fingerprint = m_fingerprints.emplace(function->name, FunctionHasher::run(*function)).first;
+			auto cached = m_functions.find(function->name);
+			if (cached != m_functions.end() && cached->second.fingerprint == fingerprint->second)
+				functions.emplace(function->name, move(cached->second));
+			else
+			{
+				functions.emplace(function->name, FunctionCalls{
+					fingerprint->second,
+					CallGraphGenerator::callGraph(*function)
+				});
+				changed = true;
+			}
+		}
+	// Detects removed functions.
+	changed = changed || functions.size() != m_functions.size();
+	m_functions = move(functions);
+
+	if (changed)
+	{
+		m_callGraph = m_outside;
+		for (auto const& function: m_functions)
+		{
+			m_callGraph.functionCalls.insert(
+				function.second.callGraph.functionCalls.begin(),
+				function.second.callGraph.functionCalls.end()
+			);
+			m_callGraph.functionsWithLoops += function.second.callGraph.functionsWithLoops;
+		}
+	}
+	return changed;
+}
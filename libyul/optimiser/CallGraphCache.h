@@ -0,0 +1,94 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Call graph and function side-effects that are kept across optimiser steps.
+ */
+
+#pragma once
+
+#include <libyul/optimiser/BlockHasher.h>
+#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/SideEffects.h>
+#include <libyul/YulString.h>
+
+#include <map>
+#include <optional>
+
+namespace solidity::yul
+{
+
+struct Dialect;
+struct OptimiserStepContext;
+
+/**
+ * Call graph and propagated side-effects of the functions of an AST that are kept
+ * across the steps of the optimiser suite.
+ *
+ * The direct calls of a top-level function are only collected again if its FunctionHasher
+ * fingerprint changed, and the side-effects are only propagated again if the call graph
+ * changed. Fingerprints compare the full contents of the functions, so hash collisions
+ * cannot lead to stale call graphs. The code outside of the top-level functions is always
+ * visited.
+ *
+ * The fingerprints are shared with the optimiser suite, which keeps them up to date
+ * between steps. Queries have to happen before the querying step modifies the AST.
+ *
+ * Prerequisite: Disambiguator
+ */
+class CallGraphCache
+{
+public:
+	CallGraphCache(Dialect const& _dialect, std::map<YulString, FunctionFingerprint>& _fingerprints):
+		m_dialect(_dialect),
+		m_fingerprints(_fingerprints)
+	{}
+
+	/// @returns the call graph of @a _ast, which has to be the AST of the last query or a
+	/// modified version of it.
+	CallGraph const& callGraph(Block const& _ast);
+	/// @returns the side-effects of the functions of @a _ast, including those of the functions
+	/// they call.
+	std::map<YulString, SideEffects> const& sideEffects(Block const& _ast);
+
+	/// @returns the call graph of @a _ast, using the cache of @a _context if it has one.
+	static CallGraph callGraph(OptimiserStepContext& _context, Block const& _ast);
+	/// @returns the side-effects of the functions of @a _ast, using the cache of @a _context
+	/// if it has one.
+	static std::map<YulString, SideEffects> sideEffects(OptimiserStepContext& _context, Block const& _ast);
+
+private:
+	/// Calls made by a top-level function and the functions defined inside it.
+	struct FunctionCalls
+	{
+		FunctionFingerprint fingerprint;
+		CallGraph callGraph;
+	};
+
+	/// Updates the cached call graph and @returns true if it changed.
+	bool update(Block const& _ast);
+
+	Dialect const& m_dialect;
+	std::map<YulString, FunctionFingerprint>& m_fingerprints;
+	std::map<YulString, FunctionCalls> m_functions;
+	/// Calls made outside of the top-level functions.
+	CallGraph m_outside;
+	CallGraph m_callGraph;
+	std::optional<std::map<YulString, SideEffects>> m_sideEffects;
+};
+
+}
@@ -21,6 +21,7 @@
 
 #include <libyul/AsmData.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/Exceptions.h>
 
 #include <libevmasm/Instruction.h>
 
@@ -79,6 +80,24 @@ CallGraph CallGraphGenerator::callGraph(Block const& _ast)
 	return std::move(gen.m_callGraph);
 }
 
+CallGraph CallGraphGenerator::callGraph(FunctionDefinition const& _function)
+{
+	CallGraphGenerator gen;
+	gen(_function);
+	yulAssert(gen.m_callGraph.functionCalls.at(YulString{}).empty(), "");
+	gen.m_callGraph.functionCalls.erase(YulString{});
+	return std::move(gen.m_callGraph);
+}
+
+CallGraph CallGraphGenerator::callGraphOutsideOfFunctions(Block const& _ast)
+{
+	CallGraphGenerator gen;
+	for (Statement const& statement: _ast.statements)
+		if (!holds_alternative<FunctionDefinition>(statement))
+			gen.visit(statement);
+	return std::move(gen.m_callGraph);
+}
+
 void CallGraphGenerator::operator()(FunctionCall const& _functionCall)
 {
 	m_callGraph.functionCalls[m_currentFunction].insert(_functionCall.functionName.name);
@@ -53,6 +53,11 @@ class CallGraphGenerator: public ASTWalker
 {
 public:
 	static CallGraph callGraph(Block const& _ast);
+	/// @returns the call graph of @a _function and the functions defined inside it,
+	/// without an entry for the outermost context.
+	static CallGraph callGraph(FunctionDefinition const& _function);
+	/// @returns the call graph of the code of @a _ast outside of its top-level functions.
+	static CallGraph callGraphOutsideOfFunctions(Block const& _ast);
 
 	using ASTWalker::operator();
 	void operator()(FunctionCall const& _functionCall) override;
@@ -23,7 +23,7 @@
 
 #include <libyul/optimiser/Metrics.h>
 #include <libyul/optimiser/SyntacticalEquality.h>
-#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/CallGraphCache.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/SideEffects.h>
 #include <libyul/Exceptions.h>
@@ -39,7 +39,7 @@ void CommonSubexpressionEliminator::run(OptimiserStepContext& _context, Block& _
 {
 	CommonSubexpressionEliminator cse{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
+		CallGraphCache::sideEffects(_context, _ast)
 	};
 	cse(_ast);
 }
@@ -38,7 +38,7 @@ namespace
 {
 
 ExpressionStatement makeDiscardCall(
-	langutil::SourceLocation const& _location,
+	Location const& _location,
 	BuiltinFunction const& _discardFunction,
 	Expression&& _expression
 )
@@ -32,6 +32,8 @@
 #include <libyul/AsmData.h>
 #include <libyul/Dialect.h>
 
+#include <libevmasm/GasProfile.h>
+
 #include <libsolutil/CommonData.h>
 #include <libsolutil/Visitor.h>
 
@@ -39,13 +41,30 @@ using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
 
+namespace
+{
+
+/// Rough estimate of the gas a call costs in addition to the inlined code:
+/// The jumps into and out of the function, pushing the return label and moving
+/// arguments and return values.
+size_t constexpr c_callGas = 40;
+/// Rough estimate of the deployment costs of one unit of code size, i.e. of two bytes.
+size_t constexpr c_codeSizeGas = 2 * 200;
+
+}
+
 void FullInliner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	FullInliner{_ast, _context.dispenser, _context.dialect}.run();
+	FullInliner{_ast, _context.dispenser, _context.dialect, _context.gasProfile}.run();
 }
 
-FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect):
-	m_ast(_ast), m_nameDispenser(_dispenser), m_dialect(_dialect)
+FullInliner::FullInliner(
+	Block& _ast,
+	NameDispenser& _dispenser,
+	Dialect const& _dialect,
+	evmasm::GasProfile const* _gasProfile
+):
+	m_ast(_ast), m_nameDispenser(_dispenser), m_dialect(_dialect), m_gasProfile(_gasProfile)
 {
 	// Determine constants
 	SSAValueTracker tracker;
@@ -112,6 +131,11 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
 	if (m_singleUse.count(calledFunction->name))
 		return true;
 
+	if (m_gasProfile)
+		if (optional<size_t> executions = m_gasProfile->executions(_funCall.location.toSourceLocation(m_dialect.repository)))
+			// Same as executions * c_callGas >= size * c_codeSizeGas, without overflow.
+			return *executions >= (size * c_codeSizeGas + c_callGas - 1) / c_callGas;
+
 	// Constant arguments might provide a means for further optimization, so they cause a bonus.
 	bool constantArg = false;
 	for (auto const& argument: _funCall.arguments)
@@ -34,6 +34,11 @@
 #include <set>
 #include <utility>
 
+namespace solidity::evmasm
+{
+class GasProfile;
+}
+
 namespace solidity::yul
 {
 
@@ -64,6 +69,11 @@ class NameCollector;
  * code of f, with replacements: a -> f_a, b -> f_b, c -> f_c
  * let z := f_c
  *
+ * If the context has a gas profile that lists the executions of a call, the call is inlined
+ * if the gas saved by avoiding the call outweighs the deployment costs of the copy of the
+ * function, instead of using the size thresholds. Tiny and single-use functions are
+ * always inlined.
+ *
  * Prerequisites: Disambiguator
  * More efficient if run after: Function Hoister, Expression Splitter
  */
@@ -91,7 +101,12 @@ public:
 	void tentativelyUpdateCodeSize(YulString _function, YulString _callSite);
 
 private:
-	FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect);
+	FullInliner(
+		Block& _ast,
+		NameDispenser& _dispenser,
+		Dialect const& _dialect,
+		evmasm::GasProfile const* _gasProfile = nullptr
+	);
 	void run();
 
 	void updateCodeSize(FunctionDefinition const& _fun);
@@ -111,6 +126,7 @@ private:
 	std::map<YulString, size_t> m_functionSizes;
 	NameDispenser& m_nameDispenser;
 	Dialect const& m_dialect;
+	evmasm::GasProfile const* m_gasProfile = nullptr;
 };
 
 /**
@@ -0,0 +1,110 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Information about the top-level functions of an AST that is kept across optimiser steps.
+ */
+
+#include <libyul/optimiser/FunctionStepCache.h>
+
+#include <libyul/optimiser/Metrics.h>
+#include <libyul/AsmData.h>
+#include <libyul/Exceptions.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+void FunctionStepCache::runFunctionLocalStep(
+	string const& _stepName,
+	Block& _ast,
+	function<void(Block&)> const& _step
+)
+{
+	map<YulString, FunctionFingerprint>& unchangedFunctions = m_unchangedFunctions[_stepName];
+	map<YulString, Block> hiddenBodies;
+	map<YulString, FunctionFingerprint> fingerprintsBefore;
+	for (Statement& statement: _ast.statements)
+		if (auto* function = get_if<FunctionDefinition>(&statement))
+		{
+			FunctionFingerprint const& current = fingerprint(*function);
+			auto unchanged = unchangedFunctions.find(function->name);
+			if (unchanged != unchangedFunctions.end() && unchanged->second == current)
+			{
+				Location location = function->body.location;
+				hiddenBodies.emplace(function->name, std::move(function->body));
+				function->body = Block{location, {}};
+				++m_hiddenFunctions;
+			}
+			else
+				fingerprintsBefore[function->name] = current;
+		}
+
+	_step(_ast);
+
+	for (Statement& statement: _ast.statements)
+		if (auto* function = get_if<FunctionDefinition>(&statement))
+		{
+			if (hiddenBodies.count(function->name))
+			{
+				yulAssert(function->body.statements.empty(), "");
+				function->body = std::move(hiddenBodies.at(function->name));
+				continue;
+			}
+			auto before = fingerprintsBefore.find(function->name);
+			FunctionFingerprint after = FunctionHasher::run(*function);
+			if (before != fingerprintsBefore.end() && before->second == after)
+			{
+				// Keep the previous fingerprint, so that comparisons with copies of it stay cheap.
+				m_fingerprints[function->name] = before->second;
+				unchangedFunctions[function->name] = before->second;
+			}
+			else
+				m_fingerprints[function->name] = move(after);
+		}
+}
+
+size_t FunctionStepCache::codeSizeIncludingFunctions(Block const& _ast)
+{
+	size_t size = 0;
+	for (Statement const& statement: _ast.statements)
+	{
+		auto const* function = get_if<FunctionDefinition>(&statement);
+		auto current = function ? m_fingerprints.find(function->name) : m_fingerprints.end();
+		if (current == m_fingerprints.end())
+		{
+			size += CodeSize::codeSizeIncludingFunctions(statement);
+			continue;
+		}
+		auto known = m_codeSizes.find(function->name);
+		if (known == m_codeSizes.end() || known->second.first != current->second)
+			known = m_codeSizes.insert_or_assign(
+				function->name,
+				make_pair(current->second, CodeSize::codeSizeIncludingFunctions(statement))
+			).first;
+		size += known->second.second;
+	}
+	return size;
+}
+
+FunctionFingerprint const& FunctionStepCache::fingerprint(FunctionDefinition const& _function)
+{
+	auto it = m_fingerprints.find(_function.name);
+	if (it == m_fingerprints.end())
+		it = m_fingerprints.emplace(_function.name, FunctionHasher::run(_function)).first;
+	return it->second;
+}
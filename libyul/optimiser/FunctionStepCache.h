@@ -0,0 +1,79 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Information about the top-level functions of an AST that is kept across optimiser steps.
+ */
+
+#pragma once
+
+#include <libyul/optimiser/BlockHasher.h>
+#include <libyul/AsmDataForward.h>
+#include <libyul/YulString.h>
+
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace solidity::yul
+{
+
+/**
+ * Information about the top-level functions of an AST that is kept across the steps
+ * of the optimiser suite and identified by the FunctionHasher fingerprints of the functions.
+ *
+ * The fingerprints are shared with the optimiser suite. Missing fingerprints are computed
+ * when needed, and the owner of the map has to remove the fingerprints of functions it
+ * modifies outside of runFunctionLocalStep().
+ *
+ * Prerequisite: Disambiguator, FunctionHoister
+ */
+class FunctionStepCache
+{
+public:
+	explicit FunctionStepCache(std::map<YulString, FunctionFingerprint>& _fingerprints):
+		m_fingerprints(_fingerprints)
+	{}
+
+	/// Runs @a _step, called @a _stepName, on @a _ast. The step must transform each function
+	/// independently of all other functions. Running it again on a function it did not change
+	/// will not change it either, so the bodies of the top-level functions that the last run
+	/// of the step left unchanged are hidden from it.
+	/// Updates the fingerprints of all functions that were visible to the step.
+	void runFunctionLocalStep(std::string const& _stepName, Block& _ast, std::function<void(Block&)> const& _step);
+
+	/// @returns CodeSize::codeSizeIncludingFunctions(_ast). Only visits the top-level functions
+	/// whose size is not known for their current fingerprint or that have no fingerprint.
+	size_t codeSizeIncludingFunctions(Block const& _ast);
+
+	/// @returns the number of function bodies that were hidden from steps so far.
+	size_t hiddenFunctions() const { return m_hiddenFunctions; }
+
+private:
+	FunctionFingerprint const& fingerprint(FunctionDefinition const& _function);
+
+	std::map<YulString, FunctionFingerprint>& m_fingerprints;
+	/// For each step, the fingerprints of the top-level functions that were not changed
+	/// by its last run on them.
+	std::map<std::string, std::map<YulString, FunctionFingerprint>> m_unchangedFunctions;
+	/// Code sizes of the top-level functions and the fingerprints they belong to.
+	std::map<YulString, std::pair<FunctionFingerprint, size_t>> m_codeSizes;
+	size_t m_hiddenFunctions = 0;
+};
+
+}
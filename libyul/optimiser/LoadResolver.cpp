@@ -24,7 +24,7 @@
 
 #include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/optimiser/Semantics.h>
-#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/CallGraphCache.h>
 #include <libyul/SideEffects.h>
 #include <libyul/AsmData.h>
 
@@ -37,7 +37,7 @@ void LoadResolver::run(OptimiserStepContext& _context, Block& _ast)
 	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
 	LoadResolver{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast)),
+		CallGraphCache::sideEffects(_context, _ast),
 		!containsMSize
 	}(_ast);
 }
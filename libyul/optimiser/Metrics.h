@@ -87,6 +87,7 @@ public:
 	static size_t codeSize(Expression const& _expression, CodeWeights const& _weights = {});
 	static size_t codeSize(Block const& _block, CodeWeights const& _weights = {});
 	static size_t codeSizeIncludingFunctions(Block const& _block, CodeWeights const& _weights = {});
+	static size_t codeSizeIncludingFunctions(Statement const& _statement, CodeWeights const& _weights = {});
 
 private:
 	CodeSize(bool _ignoreFunctions = true, CodeWeights const& _weights = {}):
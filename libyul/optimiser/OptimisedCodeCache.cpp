@@ -0,0 +1,215 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/optimiser/OptimisedCodeCache.h>
+
+#include <libyul/AsmData.h>
+#include <libyul/AsmParser.h>
+#include <libyul/AsmPrinter.h>
+
+#include <liblangutil/CharStream.h>
+#include <liblangutil/ErrorReporter.h>
+#include <liblangutil/Scanner.h>
+
+#include <functional>
+#include <type_traits>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+using namespace solidity::util;
+using namespace solidity::langutil;
+
+namespace
+{
+
+/**
+ * Calls a callback on the location of every node of a block, in a fixed order that only
+ * depends on the structure of the code.
+ */
+template <bool _const>
+struct LocationVisitor
+{
+	template <class T> using Ref = conditional_t<_const, T const&, T&>;
+
+	function<void(Ref<Location>)> callback;
+
+	void operator()(Ref<Literal> _literal) { callback(_literal.location); }
+	void operator()(Ref<Identifier> _identifier) { callback(_identifier.location); }
+	void operator()(Ref<TypedName> _typedName) { callback(_typedName.location); }
+	void operator()(Ref<FunctionCall> _call)
+	{
+		callback(_call.location);
+		(*this)(_call.functionName);
+		for (auto& argument: _call.arguments)
+			visit(*this, argument);
+	}
+	void operator()(Ref<ExpressionStatement> _statement)
+	{
+		callback(_statement.location);
+		visit(*this, _statement.expression);
+	}
+	void operator()(Ref<Assignment> _assignment)
+	{
+		callback(_assignment.location);
+		for (auto& variable: _assignment.variableNames)
+			(*this)(variable);
+		visitOptional(_assignment.value);
+	}
+	void operator()(Ref<VariableDeclaration> _declaration)
+	{
+		callback(_declaration.location);
+		for (auto& variable: _declaration.variables)
+			(*this)(variable);
+		visitOptional(_declaration.value);
+	}
+	void operator()(Ref<FunctionDefinition> _function)
+	{
+		callback(_function.location);
+		for (auto& parameter: _function.parameters)
+			(*this)(parameter);
+		for (auto& returnVariable: _function.returnVariables)
+			(*this)(returnVariable);
+		(*this)(_function.body);
+	}
+	void operator()(Ref<If> _if)
+	{
+		callback(_if.location);
+		visitOptional(_if.condition);
+		(*this)(_if.body);
+	}
+	void operator()(Ref<Switch> _switch)
+	{
+		callback(_switch.location);
+		visitOptional(_switch.expression);
+		for (auto& switchCase: _switch.cases)
+		{
+			callback(switchCase.location);
+			if (switchCase.value)
+				(*this)(*switchCase.value);
+			(*this)(switchCase.body);
+		}
+	}
+	void operator()(Ref<ForLoop> _loop)
+	{
+		callback(_loop.location);
+		(*this)(_loop.pre);
+		visitOptional(_loop.condition);
+		(*this)(_loop.post);
+		(*this)(_loop.body);
+	}
+	void operator()(Ref<Break> _break) { callback(_break.location); }
+	void operator()(Ref<Continue> _continue) { callback(_continue.location); }
+	void operator()(Ref<Leave> _leave) { callback(_leave.location); }
+	void operator()(Ref<Block> _block)
+	{
+		callback(_block.location);
+		for (auto& statement: _block.statements)
+			visit(*this, statement);
+	}
+
+private:
+	void visitOptional(Ref<unique_ptr<Expression>> _expression)
+	{
+		// The optimiser never creates nodes without mandatory children, so their absence
+		// does not need to be encoded.
+		if (_expression)
+			visit(*this, *_expression);
+	}
+};
+
+}
+
+OptimisedCodeCache& OptimisedCodeCache::global()
+{
+	static OptimisedCodeCache cache;
+	return cache;
+}
+
+optional<Json::Value> OptimisedCodeCache::load(h256 const& _key) const
+{
+	lock_guard<mutex> lock(m_mutex);
+	auto it = m_entries.find(_key);
+	if (it == m_entries.end())
+		return nullopt;
+	return it->second;
+}
+
+void OptimisedCodeCache::store(h256 const& _key, Json::Value _entry)
+{
+	lock_guard<mutex> lock(m_mutex);
+	if (!m_entries.emplace(_key, move(_entry)).second)
+		return;
+	m_keys.push_back(_key);
+	while (m_keys.size() > m_maxEntries)
+	{
+		m_entries.erase(m_keys.front());
+		m_keys.pop_front();
+	}
+}
+
+optional<Json::Value> OptimisedCodeCache::encode(Block const& _code, unsigned _sourceIndex)
+{
+	bool valid = true;
+	Json::Value locations{Json::arrayValue};
+	LocationVisitor<true>{[&](Location const& _location) {
+		if (_location.sourceIndex != 0 && _location.sourceIndex != _sourceIndex)
+			valid = false;
+		locations.append(_location.start);
+		locations.append(_location.end);
+		locations.append(_location.sourceIndex != 0);
+	}}(_code);
+	if (!valid)
+		return nullopt;
+
+	Json::Value entry{Json::objectValue};
+	entry["code"] = AsmPrinter{}(_code);
+	entry["locations"] = move(locations);
+	return entry;
+}
+
+shared_ptr<Block> OptimisedCodeCache::decode(Json::Value const& _entry, Dialect const& _dialect, unsigned _sourceIndex)
+{
+	if (!_entry.isObject() || !_entry["code"].isString() || !_entry["locations"].isArray())
+		return nullptr;
+
+	ErrorList errors;
+	ErrorReporter errorReporter(errors);
+	auto scanner = make_shared<Scanner>(CharStream(_entry["code"].asString(), ""));
+	shared_ptr<Block> code = Parser(errorReporter, _dialect).parse(scanner, false);
+	if (!code || !errorReporter.errors().empty())
+		return nullptr;
+
+	Json::Value const& locations = _entry["locations"];
+	Json::ArrayIndex index = 0;
+	bool valid = true;
+	LocationVisitor<false>{[&](Location& _location) {
+		if (index + 3 > locations.size() || !locations[index].isInt() || !locations[index + 1].isInt())
+		{
+			valid = false;
+			return;
+		}
+		_location.start = locations[index].asInt();
+		_location.end = locations[index + 1].asInt();
+		_location.sourceIndex = locations[index + 2].asBool() ? _sourceIndex : 0;
+		index += 3;
+	}}(*code);
+	if (!valid || index != locations.size())
+		return nullptr;
+	return code;
+}
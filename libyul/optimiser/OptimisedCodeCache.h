@@ -0,0 +1,78 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache for the results of the optimiser.
+ */
+#pragma once
+
+#include <libyul/AsmDataForward.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <json/json.h>
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace solidity::yul
+{
+struct Dialect;
+
+/**
+ * In-memory cache of optimised code, shared by all compilations of the process.
+ * The keys are chosen by the user and have to cover the unoptimised code and everything
+ * the optimiser depends on (dialect, settings, externally used identifiers, ...).
+ *
+ * Entries consist of the optimised code as text and the source locations of all its nodes.
+ * They do not depend on the YulStringRepository they were created in and can also be stored
+ * on disk. Decoding an entry results in exactly the code the optimiser produced, including
+ * source locations, so the optimiser's output stays deterministic.
+ * All locations of the cached code have to refer to a single source, which is replaced
+ * by the source of the code being optimised when the entry is decoded.
+ */
+class OptimisedCodeCache
+{
+public:
+	explicit OptimisedCodeCache(size_t _maxEntries = 1024): m_maxEntries(_maxEntries) {}
+
+	/// @returns the cache shared by all compilations.
+	static OptimisedCodeCache& global();
+
+	std::optional<Json::Value> load(util::h256 const& _key) const;
+	/// Stores @a _entry under @a _key. Evicts the oldest entries if the cache is full.
+	void store(util::h256 const& _key, Json::Value _entry);
+
+	/// @returns the representation of @a _code in the cache or nullopt if some of its
+	/// locations refer to a source other than @a _sourceIndex.
+	static std::optional<Json::Value> encode(Block const& _code, unsigned _sourceIndex);
+	/// @returns the code represented by @a _entry with its locations referring to @a _sourceIndex
+	/// or nullptr if @a _entry is invalid.
+	static std::shared_ptr<Block> decode(Json::Value const& _entry, Dialect const& _dialect, unsigned _sourceIndex);
+
+private:
+	size_t const m_maxEntries;
+	mutable std::mutex m_mutex;
+	std::map<util::h256, Json::Value> m_entries;
+	/// Keys of m_entries in order of insertion.
+	std::deque<util::h256> m_keys;
+};
+
+}
@@ -23,6 +23,11 @@
 #include <string>
 #include <set>
 
+namespace solidity::evmasm
+{
+class GasProfile;
+}
+
 namespace solidity::yul
 {
 
@@ -30,12 +35,18 @@ struct Dialect;
 struct Block;
 class YulString;
 class NameDispenser;
+class CallGraphCache;
 
 struct OptimiserStepContext
 {
 	Dialect const& dialect;
 	NameDispenser& dispenser;
 	std::set<YulString> const& reservedIdentifiers;
+	/// Execution counts of parts of the code, used by heuristics that trade
+	/// code size for runtime gas. Can be null.
+	evmasm::GasProfile const* gasProfile = nullptr;
+	/// Call graph and function side-effects kept across steps. Can be null.
+	CallGraphCache* callGraphCache = nullptr;
 };
 
 
@@ -47,7 +47,8 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	if (!instruction)
 		return nullptr;
 
-	static std::map<std::optional<EVMVersion>, std::unique_ptr<SimplificationRules>> evmRules;
+	// The rules store the current match and are thus not shared between threads.
+	thread_local std::map<std::optional<EVMVersion>, std::unique_ptr<SimplificationRules>> evmRules;
 
 	std::optional<EVMVersion> version;
 	if (yul::EVMDialect const* evmDialect = dynamic_cast<yul::EVMDialect const*>(&_dialect))
@@ -59,19 +60,23 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	SimplificationRules& rules = *evmRules[version];
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
-	for (auto const& rule: rules.m_rules[uint8_t(instruction->first)])
+	optional<unsigned> firstArgumentKind;
+	if (!instruction->second->empty())
+		firstArgumentKind = kind(instruction->second->front(), _dialect, _ssaValues);
+
+	for (auto const* rule: rules.m_index.candidates(instruction->first, firstArgumentKind))
 	{
 		rules.resetMatchGroups();
-		if (rule.pattern.matches(_expr, _dialect, _ssaValues))
-			if (!rule.feasible || rule.feasible())
-				return &rule;
+		if (rule->pattern.matches(_expr, _dialect, _ssaValues))
+			if (!rule->feasible || rule->feasible())
+				return rule;
 	}
 	return nullptr;
 }
 
 bool SimplificationRules::isInitialized() const
 {
-	return !m_rules[uint8_t(evmasm::Instruction::ADD)].empty();
+	return !m_index.empty(evmasm::Instruction::ADD);
 }
 
 std::optional<std::pair<evmasm::Instruction, vector<Expression> const*>>
@@ -86,15 +91,27 @@ std::optional<std::pair<evmasm::Instruction, vector<Expression> const*>>
 	return {};
 }
 
-void SimplificationRules::addRules(std::vector<Rule> const& _rules)
+unsigned SimplificationRules::kind(
+	Expression const& _expr,
+	Dialect const& _dialect,
+	map<YulString, AssignedValue> const& _ssaValues
+)
 {
-	for (auto const& r: _rules)
-		addRule(r);
-}
+	Expression const* expr = &_expr;
+	if (holds_alternative<Identifier>(_expr))
+	{
+		YulString varName = std::get<Identifier>(_expr).name;
+		if (_ssaValues.count(varName))
+			if (Expression const* value = _ssaValues.at(varName).value)
+				expr = value;
+	}
 
-void SimplificationRules::addRule(Rule const& _rule)
-{
-	m_rules[uint8_t(_rule.pattern.instruction())].push_back(_rule);
+	if (holds_alternative<Literal>(*expr))
+		return std::get<Literal>(*expr).kind == LiteralKind::Number ? Pattern::ConstantKind : Pattern::OtherKind;
+	else if (auto instruction = instructionAndArguments(_dialect, *expr))
+		return static_cast<unsigned>(instruction->first);
+	else
+		return Pattern::OtherKind;
 }
 
 SimplificationRules::SimplificationRules(std::optional<langutil::EVMVersion> _evmVersion)
@@ -117,7 +134,16 @@ SimplificationRules::SimplificationRules(std::optional<langutil::EVMVersion> _ev
 	Y.setMatchGroup(6, m_matchGroups);
 	Z.setMatchGroup(7, m_matchGroups);
 
-	addRules(simplificationRuleList(_evmVersion, A, B, C, W, X, Y, Z));
+	m_rules = simplificationRuleList(_evmVersion, A, B, C, W, X, Y, Z);
+	for (auto const& rule: m_rules)
+	{
+		vector<Pattern> arguments = rule.pattern.arguments();
+		m_index.add(
+			rule.pattern.instruction(),
+			rule,
+			arguments.empty() ? nullopt : arguments.front().kind()
+		);
+	}
 	assertThrow(isInitialized(), OptimizerException, "Rule list not properly initialized.");
 }
 
@@ -128,12 +154,27 @@ yul::Pattern::Pattern(evmasm::Instruction _instruction, initializer_list<Pattern
 {
 }
 
-void Pattern::setMatchGroup(unsigned _group, map<unsigned, Expression const*>& _matchGroups)
+void Pattern::setMatchGroup(unsigned _group, MatchGroups& _matchGroups)
 {
+	assertThrow(_group < _matchGroups.size(), OptimizerException, "Invalid match group.");
 	m_matchGroup = _group;
 	m_matchGroups = &_matchGroups;
 }
 
+optional<unsigned> Pattern::kind() const
+{
+	switch (m_kind)
+	{
+	case PatternKind::Operation:
+		return static_cast<unsigned>(m_instruction);
+	case PatternKind::Constant:
+		return ConstantKind;
+	case PatternKind::Any:
+		break;
+	}
+	return nullopt;
+}
+
 bool Pattern::matches(
 	Expression const& _expr,
 	Dialect const& _dialect,
@@ -192,7 +233,7 @@ bool Pattern::matches(
 		// on the variables and not their values.
 		// The assumption is that CSE or local value numbering has been done prior to this step.
 
-		if (m_matchGroups->count(m_matchGroup))
+		if ((*m_matchGroups)[m_matchGroup])
 		{
 			assertThrow(m_kind == PatternKind::Any, OptimizerException, "Match group repetition for non-any.");
 			Expression const* firstMatch = (*m_matchGroups)[m_matchGroup];
@@ -219,7 +260,7 @@ evmasm::Instruction Pattern::instruction() const
 	return m_instruction;
 }
 
-Expression Pattern::toExpression(SourceLocation const& _location) const
+Expression Pattern::toExpression(Location const& _location) const
 {
 	if (matchGroup())
 		return ASTCopier().translate(matchGroupValue());
@@ -32,6 +32,7 @@
 
 #include <boost/noncopyable.hpp>
 
+#include <array>
 #include <functional>
 #include <optional>
 #include <vector>
@@ -53,7 +54,8 @@ public:
 	explicit SimplificationRules(std::optional<langutil::EVMVersion> _evmVersion = std::nullopt);
 
 	/// @returns a pointer to the first matching pattern and sets the match
-	/// groups accordingly.
+	/// groups accordingly. Only tries the rules that the index selects by the
+	/// instruction and the first argument of @a _expr.
 	/// @param _ssaValues values of variables that are assigned exactly once.
 	static Rule const* findFirstMatch(
 		Expression const& _expr,
@@ -68,14 +70,20 @@ public:
 	static std::optional<std::pair<evmasm::Instruction, std::vector<Expression> const*>>
 	instructionAndArguments(Dialect const& _dialect, Expression const& _expr);
 
-private:
-	void addRules(std::vector<Rule> const& _rules);
-	void addRule(Rule const& _rule);
+	/// @returns the kind of @a _expr for the rule index, see Pattern::kind.
+	/// Variables are resolved through @a _ssaValues like patterns that are not of kind "any" do.
+	static unsigned kind(
+		Expression const& _expr,
+		Dialect const& _dialect,
+		std::map<YulString, AssignedValue> const& _ssaValues
+	);
 
-	void resetMatchGroups() { m_matchGroups.clear(); }
+private:
+	void resetMatchGroups() { m_matchGroups.fill(nullptr); }
 
-	std::map<unsigned, Expression const*> m_matchGroups;
-	std::vector<evmasm::SimplificationRule<Pattern>> m_rules[256];
+	std::array<Expression const*, 8> m_matchGroups{};
+	std::vector<Rule> m_rules;
+	evmasm::SimplificationRuleIndex<Pattern> m_index;
 };
 
 enum class PatternKind
@@ -96,6 +104,12 @@ public:
 	using Builtins = evmasm::EVMBuiltins<Pattern>;
 	static constexpr size_t WordSize = 256;
 	using Word = u256;
+	/// Matched expressions, indexed by match group. Group zero is unused.
+	using MatchGroups = std::array<Expression const*, 8>;
+	/// Kinds of expressions for the rule index: The instruction of builtin function calls,
+	/// number literals and everything else.
+	static constexpr unsigned ConstantKind = 256;
+	static constexpr unsigned OtherKind = 257;
 
 	/// Matches any expression.
 	Pattern(PatternKind _kind = PatternKind::Any): m_kind(_kind) {}
@@ -110,8 +124,11 @@ public:
 	/// Sets this pattern to be part of the match group with the identifier @a _group.
 	/// Inside one rule, all patterns in the same match group have to match expressions from the
 	/// same expression equivalence class.
-	void setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups);
+	void setMatchGroup(unsigned _group, MatchGroups& _matchGroups);
 	unsigned matchGroup() const { return m_matchGroup; }
+	/// @returns the kind of the expressions this pattern matches for the rule index,
+	/// or nullopt if it matches any expression.
+	std::optional<unsigned> kind() const;
 	bool matches(
 		Expression const& _expr,
 		Dialect const& _dialect,
@@ -127,7 +144,7 @@ public:
 
 	/// Turns this pattern into an actual expression. Should only be called
 	/// for patterns resulting from an action, i.e. with match groups assigned.
-	Expression toExpression(langutil::SourceLocation const& _location) const;
+	Expression toExpression(Location const& _location) const;
 
 private:
 	Expression const& matchGroupValue() const;
@@ -137,7 +154,7 @@ private:
 	std::shared_ptr<u256> m_data; ///< Only valid if m_kind is Constant
 	std::vector<Pattern> m_arguments;
 	unsigned m_matchGroup = 0;
-	std::map<unsigned, Expression const*>* m_matchGroups = nullptr;
+	MatchGroups* m_matchGroups = nullptr;
 };
 
 }
@@ -166,11 +166,21 @@ bool StackCompressor::run(
 		"Need to run the function grouper before the stack compressor."
 	);
 	bool allowMSizeOptimzation = !MSizeFinder::containsMSize(_dialect, *_object.code);
+	// Only the functions that were changed in the previous iteration have to be checked again.
+	optional<set<YulString>> functionsToCheck;
 	for (size_t iterations = 0; iterations < _maxIterations; iterations++)
 	{
-		map<YulString, int> stackSurplus = CompilabilityChecker::run(_dialect, _object, _optimizeStackAllocation);
+		map<YulString, int> stackSurplus = CompilabilityChecker::run(
+			_dialect,
+			_object,
+			_optimizeStackAllocation,
+			functionsToCheck
+		);
 		if (stackSurplus.empty())
 			return true;
+		functionsToCheck = set<YulString>{};
+		for (auto const& surplus: stackSurplus)
+			functionsToCheck->insert(surplus.first);
 
 		if (stackSurplus.count(YulString{}))
 		{
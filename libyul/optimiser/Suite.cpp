@@ -81,7 +81,8 @@ void OptimiserSuite::run(
 	Object& _object,
 	bool _optimizeStackAllocation,
 	string const& _optimisationSequence,
-	set<YulString> const& _externallyUsedIdentifiers
+	set<YulString> const& _externallyUsedIdentifiers,
+	evmasm::GasProfile const* _gasProfile
 )
 {
 	set<YulString> reservedIdentifiers = _externallyUsedIdentifiers;
@@ -94,7 +95,7 @@ void OptimiserSuite::run(
 	)(*_object.code));
 	Block& ast = *_object.code;
 
-	OptimiserSuite suite(_dialect, reservedIdentifiers, Debug::None, ast);
+	OptimiserSuite suite(_dialect, reservedIdentifiers, Debug::None, ast, _gasProfile);
 
 	// Some steps depend on properties ensured by FunctionHoister, FunctionGrouper and
 	// ForLoopInitRewriter. Run them first to be able to run arbitrary sequences safely.
@@ -115,12 +116,14 @@ void OptimiserSuite::run(
 		_optimizeStackAllocation,
 		stackCompressorMaxIterations
 	);
+	// The stack compressor changes the code outside of the suite.
+	suite.m_fingerprints.clear();
 	suite.runSequence("fDnTOc g", ast);
 
 	if (EVMDialect const* dialect = dynamic_cast<EVMDialect const*>(&_dialect))
 	{
 		yulAssert(_meter, "");
-		ConstantOptimiser{*dialect, *_meter}(ast);
+		ConstantOptimiser{*dialect, *_meter, _gasProfile}(ast);
 	}
 	else if (dynamic_cast<WasmDialect const*>(&_dialect))
 	{
@@ -156,38 +159,36 @@ map<string, unique_ptr<OptimiserStep>> optimiserStepCollection()
 
 map<string, unique_ptr<OptimiserStep>> const& OptimiserSuite::allSteps()
 {
-	static map<string, unique_ptr<OptimiserStep>> instance;
-	if (instance.empty())
-		instance = optimiserStepCollection<
-			BlockFlattener,
-			CircularReferencesPruner,
-			CommonSubexpressionEliminator,
-			ConditionalSimplifier,
-			ConditionalUnsimplifier,
-			ControlFlowSimplifier,
-			DeadCodeEliminator,
-			EquivalentFunctionCombiner,
-			ExpressionInliner,
-			ExpressionJoiner,
-			ExpressionSimplifier,
-			ExpressionSplitter,
-			ForLoopConditionIntoBody,
-			ForLoopConditionOutOfBody,
-			ForLoopInitRewriter,
-			FullInliner,
-			FunctionGrouper,
-			FunctionHoister,
-			LiteralRematerialiser,
-			LoadResolver,
-			LoopInvariantCodeMotion,
-			RedundantAssignEliminator,
-			Rematerialiser,
-			SSAReverser,
-			SSATransform,
-			StructuralSimplifier,
-			UnusedPruner,
-			VarDeclInitializer
-		>();
+	static map<string, unique_ptr<OptimiserStep>> const instance = optimiserStepCollection<
+		BlockFlattener,
+		CircularReferencesPruner,
+		CommonSubexpressionEliminator,
+		ConditionalSimplifier,
+		ConditionalUnsimplifier,
+		ControlFlowSimplifier,
+		DeadCodeEliminator,
+		EquivalentFunctionCombiner,
+		ExpressionInliner,
+		ExpressionJoiner,
+		ExpressionSimplifier,
+		ExpressionSplitter,
+		ForLoopConditionIntoBody,
+		ForLoopConditionOutOfBody,
+		ForLoopInitRewriter,
+		FullInliner,
+		FunctionGrouper,
+		FunctionHoister,
+		LiteralRematerialiser,
+		LoadResolver,
+		LoopInvariantCodeMotion,
+		RedundantAssignEliminator,
+		Rematerialiser,
+		SSAReverser,
+		SSATransform,
+		StructuralSimplifier,
+		UnusedPruner,
+		VarDeclInitializer
+	>();
 	// Does not include VarNameCleaner because it destroys the property of unique names.
 	return instance;
 }
@@ -316,7 +317,7 @@ void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
 	{
 		if (m_debug == Debug::PrintStep)
 			cout << "Running " << step << endl;
-		allSteps().at(step)->run(m_context, _ast);
+		runStep(step, _ast);
 		if (m_debug == Debug::PrintChanges)
 		{
 			// TODO should add switch to also compare variable names!
@@ -332,6 +333,48 @@ void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
 	}
 }
 
+void OptimiserSuite::runStep(string const& _stepName, Block& _ast)
+{
+	OptimiserStep const& step = *allSteps().at(_stepName);
+	if (!functionLocalSteps().count(_stepName))
+	{
+		step.run(m_context, _ast);
+		m_fingerprints.clear();
+		return;
+	}
+
+	m_functionStepCache.runFunctionLocalStep(_stepName, _ast, [&](Block& _block) {
+		step.run(m_context, _block);
+	});
+}
+
+set<string> const& OptimiserSuite::functionLocalSteps()
+{
+	// These steps do not consider the bodies of other functions, not even through their side-effects,
+	// and their only effect on the rest of the optimiser state is the use of new names.
+	static set<string> const steps{
+		BlockFlattener::name,
+		ConditionalSimplifier::name,
+		ConditionalUnsimplifier::name,
+		ControlFlowSimplifier::name,
+		DeadCodeEliminator::name,
+		ExpressionJoiner::name,
+		ExpressionSimplifier::name,
+		ExpressionSplitter::name,
+		ForLoopConditionIntoBody::name,
+		ForLoopConditionOutOfBody::name,
+		ForLoopInitRewriter::name,
+		LiteralRematerialiser::name,
+		RedundantAssignEliminator::name,
+		Rematerialiser::name,
+		SSAReverser::name,
+		SSATransform::name,
+		StructuralSimplifier::name,
+		VarDeclInitializer::name
+	};
+	return steps;
+}
+
 void OptimiserSuite::runSequenceUntilStable(
 	std::vector<string> const& _steps,
 	Block& _ast,
@@ -341,7 +384,7 @@ void OptimiserSuite::runSequenceUntilStable(
 	size_t codeSize = 0;
 	for (size_t rounds = 0; rounds < maxRounds; ++rounds)
 	{
-		size_t newSize = CodeSize::codeSizeIncludingFunctions(_ast);
+		size_t newSize = m_functionStepCache.codeSizeIncludingFunctions(_ast);
 		if (newSize == codeSize)
 			break;
 		codeSize = newSize;
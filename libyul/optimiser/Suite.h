@@ -23,10 +23,13 @@
 
 #include <libyul/AsmDataForward.h>
 #include <libyul/YulString.h>
+#include <libyul/optimiser/CallGraphCache.h>
+#include <libyul/optimiser/FunctionStepCache.h>
 #include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/optimiser/NameDispenser.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <map>
 #include <set>
 #include <string>
 #include <memory>
@@ -64,7 +67,8 @@ public:
 		Object& _object,
 		bool _optimizeStackAllocation,
 		std::string const& _optimisationSequence,
-		std::set<YulString> const& _externallyUsedIdentifiers = {}
+		std::set<YulString> const& _externallyUsedIdentifiers = {},
+		evmasm::GasProfile const* _gasProfile = nullptr
 	);
 
 	/// Ensures that specified sequence of step abbreviations is well-formed and can be executed.
@@ -88,16 +92,33 @@ private:
 		Dialect const& _dialect,
 		std::set<YulString> const& _externallyUsedIdentifiers,
 		Debug _debug,
-		Block& _ast
+		Block& _ast,
+		evmasm::GasProfile const* _gasProfile = nullptr
 	):
 		m_dispenser{_dialect, _ast, _externallyUsedIdentifiers},
-		m_context{_dialect, m_dispenser, _externallyUsedIdentifiers},
-		m_debug(_debug)
+		m_context{_dialect, m_dispenser, _externallyUsedIdentifiers, _gasProfile, &m_callGraphCache},
+		m_debug(_debug),
+		m_functionStepCache(m_fingerprints),
+		m_callGraphCache(_dialect, m_fingerprints)
 	{}
 
+	/// Runs the step @a _stepName on @a _ast. Steps that only look at one function at a time
+	/// skip the top-level functions they left unchanged before.
+	void runStep(std::string const& _stepName, Block& _ast);
+	/// @returns the names of the steps that transform each function independently of the
+	/// bodies of all other functions.
+	static std::set<std::string> const& functionLocalSteps();
+
 	NameDispenser m_dispenser;
 	OptimiserStepContext m_context;
 	Debug m_debug;
+	/// Fingerprints of the current top-level functions. Only kept up to date while
+	/// function-local steps run and cleared by all other steps.
+	std::map<YulString, FunctionFingerprint> m_fingerprints;
+	/// Skips unchanged functions in function-local steps, kept up to date using m_fingerprints.
+	FunctionStepCache m_functionStepCache;
+	/// Call graph of the AST, kept up to date using m_fingerprints.
+	CallGraphCache m_callGraphCache;
 };
 
 }
@@ -2,7 +2,8 @@
 
 # Bash script to test the ast-import option of the compiler by
 # first exporting a .sol file to JSON, then loading it into the compiler
-# and exporting it again. The second JSON should be identical to the first
+# and exporting it again. The second JSON should be identical to the first.
+# The same is checked for the binary AST format.
 
 REPO_ROOT=$(readlink -f "$(dirname "$0")"/..)
 SOLIDITY_BUILD_DIR=${SOLIDITY_BUILD_DIR:-${REPO_ROOT}/build}
@@ -63,8 +64,17 @@ function testImportExportEquivalence {
             FAILED=$((FAILED + 1))
             return 2
         fi
+        # the binary format has to lead to the same result
+        $SOLC --ast-binary $1 $2 > expected.ast 2> /dev/null
+        $SOLC --import-ast --combined-json ast,compact-format --pretty-json expected.ast > obtained.json 2> /dev/null
+        if [ $? -ne 0 ] || [ "$(diff expected.json obtained.json)" != "" ]
+        then
+            echo -e "ERROR: Import of the binary AST differs for $1"
+            FAILED=$((FAILED + 1))
+            return 3
+        fi
         TESTED=$((TESTED + 1))
-        rm expected.json obtained.json
+        rm expected.json obtained.json expected.ast
     else
         # echo "contract $solfile could not be compiled "
         UNCOMPILABLE=$((UNCOMPILABLE + 1))
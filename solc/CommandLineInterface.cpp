@@ -28,6 +28,7 @@
 
 #include <libsolidity/interface/Version.h>
 #include <libsolidity/parsing/Parser.h>
+#include <libsolidity/ast/ASTBinary.h>
 #include <libsolidity/ast/ASTJsonConverter.h>
 #include <libsolidity/ast/ASTJsonImporter.h>
 #include <libsolidity/analysis/NameAndTypeResolver.h>
@@ -42,6 +43,7 @@
 
 #include <libevmasm/Instruction.h>
 #include <libevmasm/GasMeter.h>
+#include <libevmasm/GasProfile.h>
 
 #include <liblangutil/Exceptions.h>
 #include <liblangutil/Scanner.h>
@@ -54,6 +56,7 @@
 #include <libsolutil/CommonData.h>
 #include <libsolutil/CommonIO.h>
 #include <libsolutil/JSON.h>
+#include <libsolutil/ThreadPool.h>
 
 #include <memory>
 
@@ -71,7 +74,12 @@
 	#include <unistd.h>
 #endif
 
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <iostream>
 #include <fstream>
 
@@ -117,8 +125,11 @@ static string const g_strAssemble = "assemble";
 static string const g_strAst = "ast";
 static string const g_strAstJson = "ast-json";
 static string const g_strAstCompactJson = "ast-compact-json";
+static string const g_strAstBinary = "ast-binary";
 static string const g_strBinary = "bin";
 static string const g_strBinaryRuntime = "bin-runtime";
+static string const g_strCacheDir = "cache-dir";
+static string const g_strModelCheckerCache = "model-checker-cache";
 static string const g_strCombinedJson = "combined-json";
 static string const g_strCompactJSON = "compact-format";
 static string const g_strContracts = "contracts";
@@ -128,9 +139,11 @@ static string const g_strEVM15 = "evm15";
 static string const g_strEVMVersion = "evm-version";
 static string const g_strEwasm = "ewasm";
 static string const g_strGas = "gas";
+static string const g_strGasProfile = "gas-profile";
 static string const g_strHelp = "help";
 static string const g_strImportAst = "import-ast";
 static string const g_strInputFile = "input-file";
+static string const g_strJobs = "jobs";
 static string const g_strInterface = "interface";
 static string const g_strYul = "yul";
 static string const g_strYulDialect = "yul-dialect";
@@ -167,6 +180,7 @@ static set<string> const g_revertStringsArgs
 	revertStringsToString(RevertStrings::VerboseDebug)
 };
 
+static string const g_strServer = "server";
 static string const g_strSignatureHashes = "hashes";
 static string const g_strSources = "sources";
 static string const g_strSourceList = "sourceList";
@@ -191,16 +205,21 @@ static string const g_argAsm = g_strAsm;
 static string const g_argAsmJson = g_strAsmJson;
 static string const g_argAssemble = g_strAssemble;
 static string const g_argAstCompactJson = g_strAstCompactJson;
+static string const g_argAstBinary = g_strAstBinary;
 static string const g_argAstJson = g_strAstJson;
 static string const g_argBinary = g_strBinary;
 static string const g_argBinaryRuntime = g_strBinaryRuntime;
+static string const g_argCacheDir = g_strCacheDir;
+static string const g_argModelCheckerCache = g_strModelCheckerCache;
 static string const g_argCombinedJson = g_strCombinedJson;
 static string const g_argCompactJSON = g_strCompactJSON;
 static string const g_argErrorRecovery = g_strErrorRecovery;
 static string const g_argGas = g_strGas;
+static string const g_argGasProfile = g_strGasProfile;
 static string const g_argHelp = g_strHelp;
 static string const g_argImportAst = g_strImportAst;
 static string const g_argInputFile = g_strInputFile;
+static string const g_argJobs = g_strJobs;
 static string const g_argYul = g_strYul;
 static string const g_argIR = g_strIR;
 static string const g_argIROptimized = g_strIROptimized;
@@ -217,6 +236,7 @@ static string const g_argOpcodes = g_strOpcodes;
 static string const g_argOptimize = g_strOptimize;
 static string const g_argOptimizeRuns = g_strOptimizeRuns;
 static string const g_argOutputDir = g_strOutputDir;
+static string const g_argServer = g_strServer;
 static string const g_argSignatureHashes = g_strSignatureHashes;
 static string const g_argStandardJSON = g_strStandardJSON;
 static string const g_argStorageLayout = g_strStorageLayout;
@@ -677,6 +697,18 @@ map<string, Json::Value> CommandLineInterface::parseAstFromInput()
 
 	for (auto const& srcPair: m_sourceCodes)
 	{
+		if (ASTBinary::isBinary(srcPair.second))
+		{
+			for (auto& [src, sourceJson]: ASTBinary::decode(srcPair.second))
+			{
+				astAssert(sourceJson["nodeType"].asString() == "SourceUnit", "Top-level node should be a 'SourceUnit'");
+				astAssert(sourceJsons.count(src) == 0, "All sources must have unique names");
+				tmpSources[src] = util::jsonCompactPrint(sourceJson);
+				sourceJsons.emplace(src, move(sourceJson));
+			}
+			continue;
+		}
+
 		Json::Value ast;
 		astAssert(jsonParseStrict(srcPair.second, ast), "Input file could not be parsed to JSON");
 		astAssert(ast.isMember("sources"), "Invalid Format for import-JSON: Must have 'sources'-object");
@@ -697,7 +729,7 @@ map<string, Json::Value> CommandLineInterface::parseAstFromInput()
 	return sourceJsons;
 }
 
-void CommandLineInterface::createFile(string const& _fileName, string const& _data)
+void CommandLineInterface::createFile(string const& _fileName, string const& _data, bool _binary)
 {
 	namespace fs = boost::filesystem;
 	// create directory if not existent
@@ -712,7 +744,7 @@ void CommandLineInterface::createFile(string const& _fileName, string const& _da
 		m_error = true;
 		return;
 	}
-	ofstream outFile(pathName);
+	ofstream outFile(pathName, _binary ? ios::out | ios::binary : ios::out);
 	outFile << _data;
 	if (!outFile)
 		BOOST_THROW_EXCEPTION(FileError() << errinfo_comment("Could not write to file: " + pathName));
@@ -808,6 +840,14 @@ General Information)").c_str(),
 			"Switch to Standard JSON input / output mode, ignoring all options. "
 			"It reads from standard input, if no input file was given, otherwise it reads from the provided input file. The result will be written to standard output."
 		)
+		(
+			g_argServer.c_str(),
+			("Switch to compile server mode, ignoring all options except --" + g_argAllowPaths + ", "
+			"--" + g_argBasePath + ", --" + g_argCacheDir + " and --" + g_argModelCheckerCache + ". "
+			"It reads Standard JSON requests from standard input, "
+			"each preceded by a line containing its length in bytes, processes them concurrently and writes "
+			"the responses in the same format and in the same order to standard output.").c_str()
+		)
 		(
 			g_argLink.c_str(),
 			("Switch to linker mode, ignoring all options apart from --" + g_argLibraries + " "
@@ -835,7 +875,7 @@ General Information)").c_str(),
 			g_argImportAst.c_str(),
 			("Import ASTs to be compiled, assumes input holds the AST in compact JSON format. "
 			"Supported Inputs is the output of the --" + g_argStandardJSON + " or the one produced by "
-			"--" + g_argCombinedJson + " " + g_strAst + "," + g_strCompactJSON).c_str()
+			"--" + g_argCombinedJson + " " + g_strAst + "," + g_strCompactJSON + " or --" + g_argAstBinary).c_str()
 		)
 	;
 	desc.add(alternativeInputModes);
@@ -896,6 +936,10 @@ General Information)").c_str(),
 	outputComponents.add_options()
 		(g_argAstJson.c_str(), "AST of all source files in JSON format.")
 		(g_argAstCompactJson.c_str(), "AST of all source files in a compact JSON format.")
+		(
+			g_argAstBinary.c_str(),
+			("AST of all source files in a compact binary format, which can be imported with --" + g_argImportAst + ".").c_str()
+		)
 		(g_argAsm.c_str(), "EVM assembly of the contracts.")
 		(g_argAsmJson.c_str(), "EVM assembly of the contracts in JSON format.")
 		(g_argOpcodes.c_str(), "Opcodes of the contracts.")
@@ -953,6 +997,12 @@ General Information)").c_str(),
 			"Set for how many contract runs to optimize. "
 			"Lower values will optimize more for initial deployment cost, higher values will optimize more for high-frequency usage."
 		)
+		(
+			g_argGasProfile.c_str(),
+			po::value<string>()->value_name("file"),
+			"Use the execution counts of functions and source ranges given in a JSON file instead of the number of runs "
+			"for the runtime code they cover."
+		)
 		(
 			g_strOptimizeYul.c_str(),
 			("Legacy option, ignored. Use the general --" + g_argOptimize + " to enable Yul optimizer.").c_str()
@@ -966,6 +1016,25 @@ General Information)").c_str(),
 			po::value<string>()->value_name("steps"),
 			"Forces yul optimizer to use the specified sequence of optimization steps instead of the built-in one."
 		)
+		(
+			g_argJobs.c_str(),
+			po::value<unsigned>()->value_name("n")->default_value(1),
+			"Parse up to n sources, optimize and assemble up to n contracts in parallel and use up to n threads to solve the queries of the SMTChecker. "
+			"The output does not depend on this setting."
+		)
+		(
+			g_argCacheDir.c_str(),
+			po::value<string>()->value_name("path"),
+			("Store compiled contracts in the given directory and reuse them in later runs with the same "
+			"sources and settings. With --" + g_argStandardJSON + ", the complete output is reused. "
+			"Ignored if --" + g_argGas + " is given.").c_str()
+		)
+		(
+			g_argModelCheckerCache.c_str(),
+			po::value<string>()->value_name("path"),
+			"Store the results of the SMT solvers used by the SMTChecker in the given directory "
+			"and reuse them for identical queries in later runs."
+		)
 	;
 	desc.add(optimizerOptions);
 
@@ -1134,6 +1203,7 @@ bool CommandLineInterface::processInput()
 
 	vector<string> const exclusiveModes = {
 		g_argStandardJSON,
+		g_argServer,
 		g_argLink,
 		g_argAssemble,
 		g_argStrictAssembly,
@@ -1166,10 +1236,17 @@ bool CommandLineInterface::processInput()
 		else
 			input = readFileAsString(jsonFile);
 		StandardCompiler compiler(fileReader);
+		if (m_args.count(g_argCacheDir))
+			compiler.setCacheDirectory(m_args[g_argCacheDir].as<string>());
+		if (m_args.count(g_argModelCheckerCache))
+			compiler.setModelCheckerCacheDirectory(m_args[g_argModelCheckerCache].as<string>());
 		sout() << compiler.compile(std::move(input)) << endl;
 		return true;
 	}
 
+	if (m_args.count(g_argServer))
+		return serve(fileReader);
+
 	if (!readInputFilesAndConfigureRemappings())
 		return false;
 
@@ -1196,6 +1273,7 @@ bool CommandLineInterface::processInput()
 			// TODO: The list is not complete. Add more.
 			g_argOutputDir,
 			g_argGas,
+			g_argGasProfile,
 			g_argCombinedJson,
 			g_strOptimizeYul,
 			g_strNoOptimizeYul,
@@ -1360,6 +1438,26 @@ bool CommandLineInterface::processInput()
 
 		OptimiserSettings settings = m_args.count(g_argOptimize) ? OptimiserSettings::standard() : OptimiserSettings::minimal();
 		settings.expectedExecutionsPerDeployment = m_args[g_argOptimizeRuns].as<unsigned>();
+		if (m_args.count(g_argGasProfile))
+		{
+			string const& profileFile = m_args[g_argGasProfile].as<string>();
+			Json::Value profile;
+			string errors;
+			if (!jsonParseStrict(readFileAsString(profileFile), profile, &errors))
+			{
+				serr() << "Could not read gas profile " << profileFile << ": " << errors << endl;
+				return false;
+			}
+			try
+			{
+				settings.gasProfile = make_shared<evmasm::GasProfile const>(evmasm::GasProfile::fromJson(profile));
+			}
+			catch (evmasm::GasProfileError const& _error)
+			{
+				serr() << "Invalid gas profile " << profileFile << ": " << *boost::get_error_info<errinfo_comment>(_error) << endl;
+				return false;
+			}
+		}
 		if (m_args.count(g_strNoOptimizeYul))
 			settings.runYulOptimiser = false;
 		if (m_args.count(g_strYulOptimizations))
@@ -1384,6 +1482,12 @@ bool CommandLineInterface::processInput()
 		}
 		settings.optimizeStackAllocation = settings.runYulOptimiser;
 		m_compiler->setOptimiserSettings(settings);
+		m_compiler->setParallelism(m_args[g_argJobs].as<unsigned>());
+		// Gas estimates need the assembly items, which are not stored for contracts in the cache.
+		if (m_args.count(g_argCacheDir) && !m_args.count(g_argGas))
+			m_compiler->setCacheDirectory(m_args[g_argCacheDir].as<string>());
+		if (m_args.count(g_argModelCheckerCache))
+			m_compiler->setModelCheckerCacheDirectory(m_args[g_argModelCheckerCache].as<string>());
 
 		if (m_args.count(g_argImportAst))
 		{
@@ -1624,9 +1728,24 @@ void CommandLineInterface::handleAst(string const& _argStr)
 	}
 }
 
+void CommandLineInterface::handleAstBinary()
+{
+	if (!m_args.count(g_argAstBinary))
+		return;
+
+	map<string, Json::Value> asts;
+	for (auto const& sourceCode: m_sourceCodes)
+		asts[sourceCode.first] = ASTJsonConverter(false, m_compiler->sourceIndices()).toJson(m_compiler->ast(sourceCode.first));
+	string data = ASTBinary::encode(asts);
+	if (m_args.count(g_argOutputDir))
+		createFile("combined_binary.ast", data, true);
+	else
+		sout() << data << flush;
+}
+
 bool CommandLineInterface::actOnInput()
 {
-	if (m_args.count(g_argStandardJSON) || m_onlyAssemble)
+	if (m_args.count(g_argStandardJSON) || m_args.count(g_argServer) || m_onlyAssemble)
 		// Already done in "processInput" phase.
 		return true;
 	else if (m_onlyLink)
@@ -1636,6 +1755,94 @@ bool CommandLineInterface::actOnInput()
 	return !m_error;
 }
 
+bool CommandLineInterface::serve(ReadCallback::Callback const& _fileReader)
+{
+	// The read callback records the files it reads and is not safe for concurrent use.
+	mutex fileReaderMutex;
+	ReadCallback::Callback fileReader = [&](string const& _kind, string const& _path)
+	{
+		lock_guard<mutex> lock(fileReaderMutex);
+		return _fileReader(_kind, _path);
+	};
+	string cacheDirectory = m_args.count(g_argCacheDir) ? m_args[g_argCacheDir].as<string>() : "";
+	string modelCheckerCacheDirectory =
+		m_args.count(g_argModelCheckerCache) ? m_args[g_argModelCheckerCache].as<string>() : "";
+
+	// Responses are written by a separate thread, so that reading further requests
+	// does not have to wait for the earlier ones to be finished.
+	mutex responsesMutex;
+	condition_variable responsesChanged;
+	deque<future<string>> responses;
+	bool inputFinished = false;
+	thread writer([&]()
+	{
+		while (true)
+		{
+			future<string> response;
+			{
+				unique_lock<mutex> lock(responsesMutex);
+				responsesChanged.wait(lock, [&]() { return inputFinished || !responses.empty(); });
+				if (responses.empty())
+					return;
+				response = move(responses.front());
+				responses.pop_front();
+			}
+			string output = response.get();
+			sout() << output.size() << "\n" << output << flush;
+		}
+	});
+
+	bool success = true;
+	{
+		ThreadPool pool{ThreadPool::hardwareConcurrency()};
+		string header;
+		while (getline(cin, header))
+		{
+			size_t length = 0;
+			try
+			{
+				size_t end = 0;
+				length = stoul(header, &end);
+				if (end != header.size())
+					throw invalid_argument(header);
+			}
+			catch (logic_error const&)
+			{
+				serr() << "Invalid message header: " << header << endl;
+				success = false;
+				break;
+			}
+			string request(length, '\0');
+			if (!cin.read(request.data(), static_cast<streamsize>(length)))
+			{
+				serr() << "Unexpected end of input." << endl;
+				success = false;
+				break;
+			}
+
+			future<string> response = pool.submit([&fileReader, &cacheDirectory, &modelCheckerCacheDirectory, request = move(request)]() {
+				StandardCompiler compiler(fileReader);
+				compiler.setCacheDirectory(cacheDirectory);
+				compiler.setModelCheckerCacheDirectory(modelCheckerCacheDirectory);
+				return compiler.compile(request);
+			});
+			{
+				lock_guard<mutex> lock(responsesMutex);
+				responses.emplace_back(move(response));
+			}
+			responsesChanged.notify_one();
+		}
+	}
+
+	{
+		lock_guard<mutex> lock(responsesMutex);
+		inputFinished = true;
+	}
+	responsesChanged.notify_one();
+	writer.join();
+	return success;
+}
+
 bool CommandLineInterface::link()
 {
 	// Map from how the libraries will be named inside the bytecode to their addresses.
@@ -1859,6 +2066,7 @@ void CommandLineInterface::outputCompilationResults()
 	// do we need AST output?
 	handleAst(g_argAstJson);
 	handleAst(g_argAstCompactJson);
+	handleAstBinary();
 
 	if (!m_compiler->compilationSuccessful())
 	{
@@ -68,6 +68,7 @@ private:
 
 	void handleCombinedJSON();
 	void handleAst(std::string const& _argStr);
+	void handleAstBinary();
 	void handleBinary(std::string const& _contract);
 	void handleOpcode(std::string const& _contract);
 	void handleIR(std::string const& _contract);
@@ -82,6 +83,12 @@ private:
 	void handleFormal();
 	void handleStorageLayout(std::string const& _contract);
 
+	/// Compile server mode: Processes standard JSON requests read from standard input
+	/// concurrently and writes the responses in order of the requests to standard output.
+	/// Every message is preceded by a line containing its length in bytes.
+	/// @returns false if the input is malformed.
+	bool serve(ReadCallback::Callback const& _fileReader);
+
 	/// Fills @a m_sourceCodes initially and @a m_redirects.
 	bool readInputFilesAndConfigureRemappings();
 	/// Tries to read from the file @a _input or interprets _input literally if that fails.
@@ -91,13 +98,14 @@ private:
 	/// Tries to read @ m_sourceCodes as a JSONs holding ASTs
 	/// such that they can be imported into the compiler  (importASTs())
 	/// (produced by --combined-json ast,compact-format <file.sol>
-	/// or standard-json output
+	/// or standard-json output or by --ast-binary
 	std::map<std::string, Json::Value> parseAstFromInput();
 
 	/// Create a file in the given directory
 	/// @arg _fileName the name of the file
 	/// @arg _data to be written
-	void createFile(std::string const& _fileName, std::string const& _data);
+	/// @arg _binary whether to write @a _data without newline conversion
+	void createFile(std::string const& _fileName, std::string const& _data, bool _binary = false);
 
 	/// Create a json file in the given directory
 	/// @arg _fileName the name of the file (the extension will be replaced with .json)
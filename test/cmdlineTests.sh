@@ -278,6 +278,22 @@ printTask "Running general commandline tests..."
     done
 )
 
+printTask "Testing compile server mode..."
+(
+    request='{"language": "Solidity", "sources": {"a.sol": {"content": "contract C { function f() public {} }"}}, "settings": {"outputSelection": {"*": {"*": ["evm.bytecode.object"]}}}}'
+    set +e
+    response=$(echo "$request" | "$SOLC" --standard-json 2>/dev/null)
+    output=$(printf '%s\n%s%s\n%s' "${#request}" "$request" "${#request}" "$request" | "$SOLC" --server 2>/dev/null)
+    result=$?
+    set -e
+
+    if [[ "$result" != 0 || "$output" != "$(printf '%s\n%s%s\n%s' "${#response}" "$response" "${#response}" "$response")" ]]
+    then
+        printError "Incorrect response in server mode: $output"
+        exit 1
+    fi
+)
+
 printTask "Compiling various other contracts and libraries..."
 (
     cd "$REPO_ROOT"/test/compilationTests/
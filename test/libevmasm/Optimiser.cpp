@@ -25,11 +25,16 @@
 
 #include <libevmasm/CommonSubexpressionEliminator.h>
 #include <libevmasm/PeepholeOptimiser.h>
+#include <libevmasm/Superoptimiser.h>
 #include <libevmasm/JumpdestRemover.h>
 #include <libevmasm/ControlFlowGraph.h>
 #include <libevmasm/BlockDeduplicator.h>
+#include <libevmasm/ConstantOptimiser.h>
+#include <libevmasm/GasProfile.h>
 #include <libevmasm/Assembly.h>
 
+#include <libsolutil/JSON.h>
+
 #include <boost/test/unit_test.hpp>
 
 #include <string>
@@ -1005,6 +1010,57 @@ BOOST_AUTO_TEST_CASE(peephole_pop_calldatasize)
 	BOOST_CHECK(items.empty());
 }
 
+BOOST_AUTO_TEST_CASE(peephole_superoptimiser)
+{
+	AssemblyItems items{
+		Instruction::CALLVALUE,
+		u256(0),
+		Instruction::ADD,
+		Instruction::NOT,
+		Instruction::NOT,
+		Instruction::DUP1,
+		Instruction::XOR,
+		Instruction::ISZERO
+	};
+	AssemblyItems original = items;
+	BOOST_CHECK(!PeepholeOptimiser(items).optimise());
+
+	AssemblyItems expectation{
+		Instruction::CALLVALUE,
+		Instruction::DUP1,
+		Instruction::EQ
+	};
+	PeepholeOptimiser peepOpt(items, true);
+	BOOST_REQUIRE(peepOpt.optimise());
+	while (peepOpt.optimise()) {}
+	BOOST_CHECK_EQUAL_COLLECTIONS(
+		items.begin(), items.end(),
+		expectation.begin(), expectation.end()
+	);
+	BOOST_CHECK(Superoptimiser::equivalent(original, items));
+}
+
+BOOST_AUTO_TEST_CASE(superoptimiser_rule_table)
+{
+	// The compiled-in table has to be up to date with the search and every rule has to be valid.
+	vector<Superoptimiser::Rule> const& rules = Superoptimiser::rules();
+	vector<Superoptimiser::Rule> searched = Superoptimiser::search(Superoptimiser::defaultAlphabet(), 3);
+	BOOST_REQUIRE_EQUAL(rules.size(), searched.size());
+	for (size_t i = 0; i < rules.size(); ++i)
+	{
+		BOOST_CHECK(rules[i].window == searched[i].window);
+		BOOST_CHECK(rules[i].replacement == searched[i].replacement);
+		BOOST_CHECK(Superoptimiser::isImprovement(rules[i].window, rules[i].replacement));
+		BOOST_CHECK(Superoptimiser::equivalent(rules[i].window, rules[i].replacement));
+	}
+
+	BOOST_CHECK(!Superoptimiser::equivalent({Instruction::SUB}, {Instruction::SWAP1, Instruction::SUB, Instruction::SWAP1}));
+	BOOST_CHECK(!Superoptimiser::equivalent({Instruction::SUB}, {Instruction::SWAP1, Instruction::SUB}));
+	BOOST_CHECK(Superoptimiser::equivalent({Instruction::ADD}, {Instruction::SWAP1, Instruction::ADD}));
+	// Memory is not only operated on the stack.
+	BOOST_CHECK(!Superoptimiser::equivalent({Instruction::MLOAD, Instruction::POP}, {Instruction::POP}));
+}
+
 BOOST_AUTO_TEST_CASE(peephole_commutative_swap1)
 {
 	vector<Instruction> ops{
@@ -1467,6 +1523,239 @@ BOOST_AUTO_TEST_CASE(cse_replace_too_large_shift)
 	});
 }
 
+BOOST_AUTO_TEST_CASE(cse_concurrent_blocks)
+{
+	// Blocks that can be simplified alternate with blocks that cannot.
+	auto createAssembly = []() {
+		Assembly assembly;
+		for (unsigned i = 0; i < 200; ++i)
+		{
+			assembly.append(assembly.newTag());
+			assembly.append(u256(i));
+			if (i % 3)
+			{
+				assembly.append(u256(2));
+				assembly.append(Instruction::ADD);
+				assembly.append(u256(0));
+				assembly.append(Instruction::ADD);
+			}
+			assembly.append(Instruction::CALLVALUE);
+			assembly.append(Instruction::SSTORE);
+		}
+		return assembly;
+	};
+
+	Assembly::OptimiserSettings settings;
+	settings.runCSE = true;
+	settings.evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	Assembly sequential = createAssembly();
+	sequential.optimise(settings);
+	BOOST_CHECK(sequential.items().size() < createAssembly().items().size());
+
+	for (size_t threads: {2u, 8u})
+	{
+		settings.threads = threads;
+		Assembly concurrent = createAssembly();
+		concurrent.optimise(settings);
+		BOOST_CHECK_EQUAL_COLLECTIONS(
+			concurrent.items().begin(), concurrent.items().end(),
+			sequential.items().begin(), sequential.items().end()
+		);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_subassemblies)
+{
+	// Creates a sub-assembly with blocks that can be simplified and deduplicated,
+	// whose tags are referenced from the super-assembly.
+	auto createSub = [](Assembly& _main, AssemblyPointer const& _shared) {
+		AssemblyPointer sub = make_shared<Assembly>();
+		vector<AssemblyItem> tags;
+		for (unsigned i = 0; i < 10; ++i)
+		{
+			tags.emplace_back(sub->newTag());
+			sub->append(tags.back());
+			sub->append(u256(i % 2));
+			sub->append(u256(2));
+			sub->append(Instruction::ADD);
+			sub->append(Instruction::CALLVALUE);
+			sub->append(Instruction::SSTORE);
+			sub->append(Instruction::STOP);
+		}
+		if (_shared)
+			sub->appendSubroutine(_shared);
+		size_t subId = static_cast<size_t>(_main.appendSubroutine(sub).data());
+		for (auto const& tag: tags)
+			_main.append(tag.toSubAssemblyTag(subId));
+	};
+	auto createAssembly = [&]() {
+		Assembly main;
+		AssemblyPointer shared = make_shared<Assembly>();
+		shared->append(u256(1));
+		shared->append(u256(2));
+		shared->append(Instruction::ADD);
+		for (unsigned i = 0; i < 5; ++i)
+			createSub(main, i % 2 ? shared : nullptr);
+		return main;
+	};
+
+	Assembly::OptimiserSettings settings;
+	settings.runJumpdestRemover = true;
+	settings.runPeephole = true;
+	settings.runDeduplicate = true;
+	settings.runCSE = true;
+	settings.evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	Assembly sequential = createAssembly();
+	sequential.optimise(settings);
+	BOOST_CHECK(sequential.assemblyString() != createAssembly().assemblyString());
+
+	for (size_t threads: {2u, 8u})
+	{
+		settings.threads = threads;
+		Assembly concurrent = createAssembly();
+		concurrent.optimise(settings);
+		BOOST_CHECK_EQUAL(concurrent.assemblyString(), sequential.assemblyString());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(constant_optimiser_reuse_stack)
+{
+	u256 constant(0x123456789);
+	AssemblyItems items{
+		constant,
+		Instruction::CALLVALUE,
+		constant,
+		Instruction::SSTORE,
+		AssemblyItem(Tag, 1),
+		constant,
+		Instruction::SWAP1,
+		constant,
+		Instruction::JUMP,
+		AssemblyItem(Tag, 2),
+		u256(0x20),
+		Instruction::DUP1,
+		u256(0x20),
+		constant
+	};
+	AssemblyItems expectation{
+		constant,
+		Instruction::CALLVALUE,
+		Instruction::DUP2,
+		Instruction::SSTORE,
+		AssemblyItem(Tag, 1),
+		constant,
+		Instruction::SWAP1,
+		Instruction::DUP2,
+		Instruction::JUMP,
+		AssemblyItem(Tag, 2),
+		u256(0x20),
+		Instruction::DUP1,
+		u256(0x20),
+		constant
+	};
+	BOOST_CHECK_EQUAL(ConstantOptimisationMethod::reuseConstantsOnStack(items), 2);
+	BOOST_CHECK_EQUAL_COLLECTIONS(
+		items.begin(), items.end(),
+		expectation.begin(), expectation.end()
+	);
+}
+
+BOOST_AUTO_TEST_CASE(gas_profile)
+{
+	Json::Value json;
+	BOOST_REQUIRE(util::jsonParseStrict(R"({
+		"ranges": [
+			{"source": "a.sol", "start": 10, "end": 100, "executions": 7},
+			{"source": "a.sol", "start": 20, "end": 30, "executions": 1000}
+		],
+		"functions": {"a.sol": {"C": {"f": 3}}}
+	})", json));
+	GasProfile profile = GasProfile::fromJson(json);
+	auto source = make_shared<CharStream>(string(200, ' '), "a.sol");
+	auto otherSource = make_shared<CharStream>(string(200, ' '), "b.sol");
+	BOOST_CHECK(profile.executions(SourceLocation{10, 100, source}) == 7);
+	BOOST_CHECK(profile.executions(SourceLocation{25, 28, source}) == 1000);
+	BOOST_CHECK(profile.executions(SourceLocation{25, 40, source}) == 7);
+	BOOST_CHECK(profile.executions(SourceLocation{5, 40, source}) == nullopt);
+	BOOST_CHECK(profile.executions(SourceLocation{25, 28, otherSource}) == nullopt);
+	BOOST_CHECK(profile.executions(SourceLocation{}) == nullopt);
+	BOOST_CHECK_EQUAL(profile.functions().at("a.sol").at("C").at("f"), 3);
+
+	util::h256 hash = profile.hash();
+	profile.addRange({"b.sol", 0, 50, 2});
+	BOOST_CHECK(profile.executions(SourceLocation{25, 28, otherSource}) == 2);
+	BOOST_CHECK(profile.hash() == hash);
+
+	for (string const& invalid: {
+		R"([])",
+		R"({"range": []})",
+		R"({"ranges": [{"source": "a.sol", "start": 10, "end": 5, "executions": 1}]})",
+		R"({"ranges": [{"source": "a.sol", "start": 10, "end": 20}]})",
+		R"({"functions": {"a.sol": {"C": {"f": "hot"}}}})"
+	})
+	{
+		BOOST_REQUIRE(util::jsonParseStrict(invalid, json));
+		BOOST_CHECK_THROW(GasProfile::fromJson(json), GasProfileError);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(constant_optimiser_gas_profile)
+{
+	// Computing the value as "not(0xff)" is cheaper than pushing it
+	// unless it is executed very often.
+	u256 constant = ~u256(0xff);
+	auto source = make_shared<CharStream>(string(20, ' '), "a.sol");
+	auto createAssembly = [&]() {
+		Assembly assembly;
+		assembly.setSourceLocation({0, 10, source});
+		assembly.append(constant);
+		assembly.append(Instruction::POP);
+		return assembly;
+	};
+
+	Assembly cold = createAssembly();
+	ConstantOptimisationMethod::optimiseConstants(false, 200, EVMVersion{}, cold);
+	AssemblyItems computed{u256(0xff), Instruction::NOT, Instruction::POP};
+	BOOST_CHECK_EQUAL_COLLECTIONS(cold.items().begin(), cold.items().end(), computed.begin(), computed.end());
+
+	GasProfile profile;
+	profile.addRange({"a.sol", 0, 20, 100000});
+	Assembly hot = createAssembly();
+	ConstantOptimisationMethod::optimiseConstants(false, 200, EVMVersion{}, hot, &profile);
+	AssemblyItems pushed{constant, Instruction::POP};
+	BOOST_CHECK_EQUAL_COLLECTIONS(hot.items().begin(), hot.items().end(), pushed.begin(), pushed.end());
+}
+
+BOOST_AUTO_TEST_CASE(constant_routine_cache)
+{
+	ConstantRoutineCache::clear();
+	ConstantRoutineCache::Key key{
+		ConstantRoutineCache::CostModel::Legacy,
+		u256(0x123456789),
+		200,
+		false,
+		1,
+		EVMVersion{}
+	};
+	size_t computations = 0;
+	auto compute = [&]() {
+		++computations;
+		return AssemblyItems{u256(0x123456789)};
+	};
+	BOOST_CHECK(ConstantRoutineCache::routine(key, compute) == AssemblyItems{u256(0x123456789)});
+	BOOST_CHECK(ConstantRoutineCache::routine(key, compute) == AssemblyItems{u256(0x123456789)});
+	BOOST_CHECK_EQUAL(computations, 1);
+
+	key.costModel = ConstantRoutineCache::CostModel::Yul;
+	ConstantRoutineCache::routine(key, compute);
+	BOOST_CHECK_EQUAL(computations, 2);
+
+	ConstantRoutineCache::clear();
+	ConstantRoutineCache::routine(key, compute);
+	BOOST_CHECK_EQUAL(computations, 3);
+	ConstantRoutineCache::clear();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -0,0 +1,158 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the binary AST format.
+ */
+
+#include <test/Common.h>
+
+#include <libsolidity/ast/ASTBinary.h>
+#include <libsolidity/ast/ASTJsonConverter.h>
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <libsolutil/JSON.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <limits>
+#include <string>
+
+using namespace std;
+using namespace solidity::langutil;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+map<string, Json::Value> compactASTs(CompilerStack const& _compiler)
+{
+	map<string, Json::Value> asts;
+	for (string const& name: _compiler.sourceNames())
+		asts[name] = ASTJsonConverter(false, _compiler.sourceIndices()).toJson(_compiler.ast(name));
+	return asts;
+}
+
+map<string, Json::Value> analyze(map<string, string> const& _sources)
+{
+	CompilerStack compiler;
+	compiler.setSources(_sources);
+	compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	BOOST_REQUIRE(compiler.parseAndAnalyze());
+	return compactASTs(compiler);
+}
+
+map<string, string> const c_sources{
+	{"a.sol", R"(
+		pragma solidity >=0.0;
+		import "b.sol";
+		/// @title A
+		contract A is B {
+			uint[] x;
+			function f(uint a) public returns (uint b) {
+				b = a + 0x1234 * 2 ** 200;
+				x.push(b);
+				assembly { b := add(b, 1) }
+			}
+		}
+	)"},
+	{"b.sol", "pragma solidity >=0.0; contract B { string s = \"\\x00\\x01abc\"; }"}
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE(ASTBinaryTest)
+
+BOOST_AUTO_TEST_CASE(round_trip)
+{
+	map<string, Json::Value> asts = analyze(c_sources);
+	string data = ASTBinary::encode(asts);
+	BOOST_CHECK(ASTBinary::isBinary(data));
+	map<string, Json::Value> decoded = ASTBinary::decode(data);
+	BOOST_CHECK(decoded == asts);
+	for (auto const& [name, ast]: asts)
+		BOOST_CHECK_EQUAL(util::jsonCompactPrint(decoded.at(name)), util::jsonCompactPrint(ast));
+	BOOST_CHECK_LT(data.size(), util::jsonCompactPrint(asts.at("a.sol")).size());
+}
+
+BOOST_AUTO_TEST_CASE(values)
+{
+	Json::Value value{Json::objectValue};
+	value["null"] = Json::nullValue;
+	value["bool"].append(true);
+	value["bool"].append(false);
+	value["int"].append(Json::Int64(-1));
+	value["int"].append(numeric_limits<Json::Int64>::min());
+	value["int"].append(numeric_limits<Json::Int64>::max());
+	value["uint"] = numeric_limits<Json::UInt64>::max();
+	value["real"] = -0.125;
+	value["string"] = Json::Value(string("a\0b", 3));
+	value["emptyArray"] = Json::arrayValue;
+	value["emptyObject"] = Json::objectValue;
+	value["nested"]["nested"]["string"] = "a\0b";
+	map<string, Json::Value> decoded = ASTBinary::decode(ASTBinary::encode({{"", value}}));
+	BOOST_REQUIRE_EQUAL(decoded.size(), 1);
+	BOOST_CHECK(decoded[""] == value);
+	BOOST_CHECK(decoded[""]["int"][0].type() == Json::intValue);
+	BOOST_CHECK(decoded[""]["uint"].type() == Json::uintValue);
+}
+
+BOOST_AUTO_TEST_CASE(node_index)
+{
+	map<string, Json::Value> asts = analyze(c_sources);
+	string data = ASTBinary::encode(asts);
+	for (auto const& node: asts.at("a.sol")["nodes"])
+	{
+		optional<Json::Value> decoded = ASTBinary::decodeNode(data, node["id"].asInt64());
+		BOOST_REQUIRE(decoded);
+		BOOST_CHECK(*decoded == node);
+	}
+	BOOST_CHECK(!ASTBinary::decodeNode(data, -1));
+}
+
+BOOST_AUTO_TEST_CASE(import)
+{
+	map<string, Json::Value> asts = analyze(c_sources);
+	CompilerStack compiler;
+	compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	compiler.importASTs(ASTBinary::decode(ASTBinary::encode(asts)));
+	BOOST_REQUIRE(compiler.analyze());
+	BOOST_CHECK(compactASTs(compiler) == asts);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_input)
+{
+	string data = ASTBinary::encode(analyze(c_sources));
+	BOOST_CHECK(!ASTBinary::isBinary(util::jsonCompactPrint(analyze(c_sources).at("b.sol"))));
+	BOOST_CHECK(!ASTBinary::isBinary(""));
+	for (size_t size: {size_t(0), size_t(9), size_t(10), data.size() / 2, data.size() - 1})
+		BOOST_CHECK_THROW(ASTBinary::decode(data.substr(0, size)), InvalidAstError);
+	string otherVersion = data;
+	otherVersion[9] = char(ASTBinary::version + 1);
+	BOOST_CHECK_THROW(ASTBinary::decode(otherVersion), InvalidAstError);
+	string corrupted = data;
+	corrupted.back() = char(0xff);
+	BOOST_CHECK_THROW(ASTBinary::decode(corrupted), InvalidAstError);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,273 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the on-disk compilation cache.
+ */
+
+#include <test/Common.h>
+
+#include <libsolidity/interface/CompilationCache.h>
+#include <libsolidity/interface/CompilerStack.h>
+#include <libsolidity/interface/StandardCompiler.h>
+
+#include <libsolutil/JSON.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+using namespace std;
+using namespace solidity::util;
+
+namespace fs = boost::filesystem;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+char const* const c_sourceCode = R"(
+	pragma solidity >=0.0;
+	library L { function f() external pure returns (uint) { return 7; } }
+	contract A { uint immutable x = 2; function f() public view returns (uint) { return x + L.f(); } }
+	contract B { function g() public returns (A) { return new A(); } }
+)";
+
+/// Temporary cache directory that is removed at the end of the test.
+class CacheDirectory
+{
+public:
+	CacheDirectory(): m_path(fs::temp_directory_path() / fs::unique_path("solc-cache-%%%%%%%%")) {}
+	~CacheDirectory() { fs::remove_all(m_path); }
+	string path() const { return m_path.string(); }
+	size_t entries() const
+	{
+		return size_t(distance(fs::directory_iterator(m_path), fs::directory_iterator()));
+	}
+private:
+	fs::path m_path;
+};
+
+struct Output
+{
+	string object;
+	string runtimeObject;
+	string assembly;
+	string assemblyJSON;
+	string sourceMapping;
+	string runtimeSourceMapping;
+	string gasEstimates;
+	size_t cachedContracts = 0;
+};
+
+Output compile(string const& _cacheDirectory, bool _optimize = false)
+{
+	CompilerStack compilerStack;
+	compilerStack.setSources({{"a.sol", c_sourceCode}});
+	compilerStack.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	compilerStack.setOptimiserSettings(_optimize);
+	compilerStack.setCacheDirectory(_cacheDirectory);
+	BOOST_REQUIRE_MESSAGE(compilerStack.compile(), "Compiling contract failed");
+
+	Output output;
+	for (string const& contract: compilerStack.contractNames())
+	{
+		output.object += compilerStack.object(contract).toHex();
+		output.runtimeObject += compilerStack.runtimeObject(contract).toHex();
+		output.assembly += compilerStack.assemblyString(contract, {{"a.sol", c_sourceCode}});
+		output.assemblyJSON += jsonCompactPrint(compilerStack.assemblyJSON(contract));
+		output.sourceMapping += *compilerStack.sourceMapping(contract);
+		output.runtimeSourceMapping += *compilerStack.runtimeSourceMapping(contract);
+		if (compilerStack.assemblyItems(contract))
+			output.gasEstimates += jsonCompactPrint(compilerStack.gasEstimates(contract));
+		else
+		{
+			BOOST_CHECK_THROW(compilerStack.gasEstimates(contract), CompilerError);
+			output.cachedContracts++;
+		}
+	}
+	return output;
+}
+
+/// @returns the standard JSON input for @a _sources, requesting @a _outputs for all contracts.
+Json::Value standardJsonInput(map<string, string> const& _sources, vector<string> const& _outputs)
+{
+	Json::Value input{Json::objectValue};
+	input["language"] = "Solidity";
+	for (auto const& [name, content]: _sources)
+		input["sources"][name]["content"] = content;
+	input["settings"]["evmVersion"] = solidity::test::CommonOptions::get().evmVersion().name();
+	input["settings"]["outputSelection"]["*"][""].append("ast");
+	for (string const& output: _outputs)
+		input["settings"]["outputSelection"]["*"]["*"].append(output);
+	return input;
+}
+
+string compileStandardJson(
+	string const& _cacheDirectory,
+	Json::Value const& _input,
+	ReadCallback::Callback _readFile = ReadCallback::Callback()
+)
+{
+	StandardCompiler compiler(move(_readFile));
+	compiler.setCacheDirectory(_cacheDirectory);
+	return jsonCompactPrint(compiler.compile(_input));
+}
+
+void checkEqual(Output const& _a, Output const& _b)
+{
+	BOOST_CHECK_EQUAL(_a.object, _b.object);
+	BOOST_CHECK_EQUAL(_a.runtimeObject, _b.runtimeObject);
+	BOOST_CHECK_EQUAL(_a.assembly, _b.assembly);
+	BOOST_CHECK_EQUAL(_a.assemblyJSON, _b.assemblyJSON);
+	BOOST_CHECK_EQUAL(_a.sourceMapping, _b.sourceMapping);
+	BOOST_CHECK_EQUAL(_a.runtimeSourceMapping, _b.runtimeSourceMapping);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(CompilationCacheTest)
+
+BOOST_AUTO_TEST_CASE(linker_object_roundtrip)
+{
+	evmasm::LinkerObject object;
+	object.bytecode = fromHex("6001600201");
+	object.linkReferences[1] = "a.sol:L";
+	object.immutableReferences[u256(12345)] = {"x", {0, 3}};
+
+	optional<evmasm::LinkerObject> decoded = CompilationCache::linkerObjectFromJson(
+		CompilationCache::linkerObjectToJson(object)
+	);
+	BOOST_REQUIRE(decoded);
+	BOOST_CHECK(decoded->bytecode == object.bytecode);
+	BOOST_CHECK(decoded->linkReferences == object.linkReferences);
+	BOOST_CHECK(decoded->immutableReferences == object.immutableReferences);
+
+	BOOST_CHECK(!CompilationCache::linkerObjectFromJson(Json::Value{}));
+	Json::Value invalid = CompilationCache::linkerObjectToJson(object);
+	invalid["bytecode"] = "xyz";
+	BOOST_CHECK(!CompilationCache::linkerObjectFromJson(invalid));
+}
+
+BOOST_AUTO_TEST_CASE(reuse)
+{
+	CacheDirectory directory;
+	Output uncached = compile("");
+	Output cold = compile(directory.path());
+	BOOST_CHECK_EQUAL(cold.cachedContracts, 0);
+	BOOST_CHECK_EQUAL(cold.gasEstimates, uncached.gasEstimates);
+	// Only deployable contracts are stored.
+	BOOST_CHECK_EQUAL(directory.entries(), 3);
+
+	Output warm = compile(directory.path());
+	BOOST_CHECK_EQUAL(warm.cachedContracts, 3);
+	BOOST_CHECK_EQUAL(directory.entries(), 3);
+	checkEqual(uncached, cold);
+	checkEqual(uncached, warm);
+}
+
+BOOST_AUTO_TEST_CASE(settings_are_part_of_the_key)
+{
+	CacheDirectory directory;
+	compile(directory.path());
+	Output optimized = compile(directory.path(), true);
+	BOOST_CHECK_EQUAL(optimized.cachedContracts, 0);
+	BOOST_CHECK_EQUAL(directory.entries(), 6);
+	checkEqual(compile("", true), optimized);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_entries_are_ignored)
+{
+	CacheDirectory directory;
+	compile(directory.path());
+	for (auto const& entry: fs::directory_iterator(directory.path()))
+		ofstream(entry.path().string(), ios::trunc) << "{\"object\": 1}";
+
+	Output recompiled = compile(directory.path());
+	BOOST_CHECK_EQUAL(recompiled.cachedContracts, 0);
+	checkEqual(compile(""), recompiled);
+	// The broken entries have been replaced.
+	BOOST_CHECK_EQUAL(compile(directory.path()).cachedContracts, 3);
+}
+
+BOOST_AUTO_TEST_CASE(standard_json_output_is_reused)
+{
+	CacheDirectory directory;
+	Json::Value input = standardJsonInput({{"a.sol", c_sourceCode}}, {"*"});
+	string uncached = compileStandardJson("", input);
+	string cold = compileStandardJson(directory.path(), input);
+	// Only the output is stored, since gas estimates are requested.
+	BOOST_CHECK_EQUAL(directory.entries(), 1);
+	BOOST_CHECK(cold.find("\"gasEstimates\"") != string::npos);
+
+	string warm = compileStandardJson(directory.path(), input);
+	BOOST_CHECK_EQUAL(directory.entries(), 1);
+	BOOST_CHECK_EQUAL(uncached, cold);
+	BOOST_CHECK_EQUAL(uncached, warm);
+
+	// The stored output is returned as is.
+	for (auto const& entry: fs::directory_iterator(directory.path()))
+		ofstream(entry.path().string(), ios::trunc) << "{\"output\": {\"sources\": {}}, \"importedSources\": {}}";
+	BOOST_CHECK_EQUAL(compileStandardJson(directory.path(), input), "{\"sources\":{}}");
+}
+
+BOOST_AUTO_TEST_CASE(standard_json_contracts_are_reused)
+{
+	CacheDirectory directory;
+	Json::Value bytecode = standardJsonInput({{"a.sol", c_sourceCode}}, {"evm.bytecode"});
+	Json::Value assembly = standardJsonInput({{"a.sol", c_sourceCode}}, {"evm.bytecode", "evm.assembly", "evm.legacyAssembly"});
+	BOOST_CHECK_EQUAL(compileStandardJson(directory.path(), bytecode), compileStandardJson("", bytecode));
+	// One output and three contracts.
+	BOOST_CHECK_EQUAL(directory.entries(), 4);
+
+	// A different output selection only reuses the contracts.
+	BOOST_CHECK_EQUAL(compileStandardJson(directory.path(), assembly), compileStandardJson("", assembly));
+	BOOST_CHECK_EQUAL(directory.entries(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(standard_json_imported_files_are_checked)
+{
+	CacheDirectory directory;
+	string imported = "contract C { function f() public pure returns (uint) { return 1; } }";
+	auto readFile = [&](string const&, string const& _path) {
+		return _path == "b.sol" ? ReadCallback::Result{true, imported} : ReadCallback::Result{false, "not found"};
+	};
+	Json::Value input = standardJsonInput({{"a.sol", "import \"b.sol\"; contract D is C {}"}}, {"evm.bytecode"});
+	string first = compileStandardJson(directory.path(), input, readFile);
+	BOOST_CHECK_EQUAL(compileStandardJson(directory.path(), input, readFile), first);
+
+	imported = "contract C { function f() public pure returns (uint) { return 2; } }";
+	string second = compileStandardJson(directory.path(), input, readFile);
+	BOOST_CHECK(second != first);
+	BOOST_CHECK_EQUAL(second, compileStandardJson("", input, readFile));
+}
+
+BOOST_AUTO_TEST_CASE(standard_json_errors_are_not_stored)
+{
+	CacheDirectory directory;
+	Json::Value input = standardJsonInput({{"a.sol", "contract C { function f() public { g(); } }"}}, {"evm.bytecode"});
+	string output = compileStandardJson(directory.path(), input);
+	BOOST_CHECK(output.find("DeclarationError") != string::npos);
+	BOOST_CHECK_EQUAL(directory.entries(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -21,8 +21,15 @@
 #include <test/libsolidity/AnalysisFramework.h>
 #include <test/Common.h>
 
+#include <libsolidity/formal/ModelChecker.h>
+#include <liblangutil/SourceReferenceFormatter.h>
+#include <libsolutil/Common.h>
+#include <libsolutil/CommonIO.h>
+
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <string>
 
 using namespace std;
@@ -137,6 +144,70 @@ BOOST_AUTO_TEST_CASE(import_library, *boost::unit_test::label("no_options"))
 
 }
 
+BOOST_AUTO_TEST_CASE(model_checker_cache, *boost::unit_test::label("no_options"))
+{
+	if (!ModelChecker::availableSolvers().some())
+		return;
+
+	namespace fs = boost::filesystem;
+	fs::path directory = fs::temp_directory_path() / fs::unique_path("solc-smt-cache-%%%%%%%%");
+	ScopeGuard removeDirectory([&]() { fs::remove_all(directory); });
+
+	// The assertion can only be proven by CHC, the overflow is found by BMC.
+	auto check = [&]() {
+		CompilerStack c;
+		c.setSources({{"c", R"(
+			pragma solidity >=0.0;
+			pragma experimental SMTChecker;
+			contract C {
+				uint x;
+				function f() public {
+					if (x < 10)
+						++x;
+				}
+				function g() public view {
+					assert(x < 11);
+				}
+				function h(uint8 a) public pure returns (uint8) {
+					return a + 1;
+				}
+			}
+		)"}});
+		c.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+		c.setParallelism(4);
+		c.setModelCheckerCacheDirectory(directory.string());
+		BOOST_CHECK(c.compile());
+		string output;
+		for (auto const& e: c.errors())
+			output += SourceReferenceFormatter::formatErrorInformation(*e);
+		return output;
+	};
+	auto entries = [&]() {
+		vector<fs::path> files;
+		for (auto const& entry: fs::directory_iterator(directory))
+			files.emplace_back(entry.path());
+		sort(files.begin(), files.end());
+		return files;
+	};
+
+	string output = check();
+	BOOST_CHECK(output.find("Assertion violation") == string::npos);
+	BOOST_CHECK(output.find("Overflow (resulting value larger than 255) happens here") != string::npos);
+	vector<fs::path> files = entries();
+	BOOST_REQUIRE(!files.empty());
+
+	BOOST_CHECK_EQUAL(check(), output);
+	BOOST_CHECK(entries() == files);
+
+	// With every cached answer replaced by "unknown", CHC no longer proves the assertion,
+	// so that BMC reports it, and BMC cannot decide the overflow.
+	for (auto const& file: files)
+		util::writeFileAtomically(file.string(), R"({"result":"unknown","values":[]})");
+	string cachedOutput = check();
+	BOOST_CHECK(cachedOutput.find("Assertion violation") != string::npos);
+	BOOST_CHECK(cachedOutput.find("Overflow (resulting value larger than 255) might happen here") != string::npos);
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,130 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the on-disk cache of SMT query results.
+ */
+
+#include <libsmtutil/SMTLib2Interface.h>
+#include <libsmtutil/SMTQueryCache.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace solidity::util;
+using namespace solidity::smtutil;
+
+namespace fs = boost::filesystem;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+/// @returns the query that checks whether the variables @a _x and @a _y
+/// can be different with @a _y being @a _x plus @a _offset.
+string query(string const& _x, string const& _y, size_t _offset)
+{
+	map<h256, string> responses;
+	SMTLib2Interface solver(responses, ReadCallback::Callback{});
+	Expression x = solver.newVariable(_x, SortProvider::uintSort);
+	Expression y = solver.newVariable(_y, SortProvider::uintSort);
+	solver.addAssertion(y == x + _offset);
+	solver.addAssertion(x != y);
+	return solver.dumpQuery({x});
+}
+
+/// Temporary cache directory that is removed at the end of the test.
+class CacheDirectory
+{
+public:
+	CacheDirectory(): m_path(fs::temp_directory_path() / fs::unique_path("solc-smt-cache-%%%%%%%%")) {}
+	~CacheDirectory() { fs::remove_all(m_path); }
+	string path() const { return m_path.string(); }
+private:
+	fs::path m_path;
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE(SMTQueryCacheTest)
+
+BOOST_AUTO_TEST_CASE(canonical_query)
+{
+	string canonical = SMTQueryCache::canonicalQuery(query("x_12_0", "y_13_0", 1));
+	BOOST_CHECK_EQUAL(SMTQueryCache::canonicalQuery(query("x_24_0", "y_25_3", 1)), canonical);
+	BOOST_CHECK(SMTQueryCache::canonicalQuery(query("x_12_0", "y_13_0", 2)) != canonical);
+	// Only the order of declaration matters, not the names.
+	BOOST_CHECK_EQUAL(SMTQueryCache::canonicalQuery(query("y_13_0", "x_12_0", 1)), canonical);
+
+	// Rule names are renamed as well, relations are renamed where they are used.
+	BOOST_CHECK_EQUAL(
+		SMTQueryCache::canonicalQuery("(declare-rel |block_3| ())\n(rule (! block_3 :named rule_3))\n(query block_3)"),
+		SMTQueryCache::canonicalQuery("(declare-rel |block_7| ())\n(rule (! block_7 :named rule_8))\n(query block_7)")
+	);
+	BOOST_CHECK(
+		SMTQueryCache::canonicalQuery("(declare-rel |a| ())\n(declare-rel |b| ())\n(query a)") !=
+		SMTQueryCache::canonicalQuery("(declare-rel |a| ())\n(declare-rel |b| ())\n(query b)")
+	);
+}
+
+BOOST_AUTO_TEST_CASE(store_and_load)
+{
+	CacheDirectory directory;
+	SMTQueryCache cache(directory.path(), "salt");
+	string satQuery = query("x_1", "y_2", 0);
+	string unsatQuery = query("x_1", "y_2", 1);
+	BOOST_CHECK(!cache.load("z3", satQuery));
+
+	cache.store("z3", satQuery, {CheckResult::SATISFIABLE, {"0", "(- 1)"}});
+	cache.store("z3", unsatQuery, {CheckResult::UNSATISFIABLE, {}});
+	auto sat = cache.load("z3", satQuery);
+	BOOST_REQUIRE(sat);
+	BOOST_CHECK(sat->first == CheckResult::SATISFIABLE);
+	BOOST_CHECK(sat->second == (vector<string>{"0", "(- 1)"}));
+	auto unsat = cache.load("z3", query("x_5", "y_6", 1));
+	BOOST_REQUIRE(unsat);
+	BOOST_CHECK(unsat->first == CheckResult::UNSATISFIABLE);
+	BOOST_CHECK(unsat->second.empty());
+
+	// Entries are specific to the solvers and the salt.
+	BOOST_CHECK(!cache.load("cvc4", satQuery));
+	BOOST_CHECK(!SMTQueryCache(directory.path(), "other salt").load("z3", satQuery));
+	BOOST_CHECK(SMTQueryCache(directory.path(), "salt").load("z3", satQuery));
+
+	// Errors are not stored.
+	string errorQuery = query("x_1", "y_2", 3);
+	cache.store("z3", errorQuery, {CheckResult::ERROR, {}});
+	BOOST_CHECK(!cache.load("z3", errorQuery));
+}
+
+BOOST_AUTO_TEST_CASE(missing_directory)
+{
+	CacheDirectory directory;
+	SMTQueryCache cache((fs::path(directory.path()) / "a" / "b").string(), "");
+	string satQuery = query("x", "y", 0);
+	cache.store("z3", satQuery, {CheckResult::UNKNOWN, {}});
+	auto unknown = cache.load("z3", satQuery);
+	BOOST_REQUIRE(unknown);
+	BOOST_CHECK(unknown->first == CheckResult::UNKNOWN);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
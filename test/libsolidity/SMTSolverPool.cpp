@@ -0,0 +1,128 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for checking batches of SMT queries concurrently.
+ */
+
+#include <libsmtutil/SMTLib2Interface.h>
+#include <libsmtutil/SMTSolverPool.h>
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+
+using namespace std;
+using namespace solidity::util;
+using namespace solidity::smtutil;
+
+namespace solidity::frontend::test
+{
+
+BOOST_AUTO_TEST_SUITE(SMTSolverPoolTest)
+
+BOOST_AUTO_TEST_CASE(results_in_query_order)
+{
+	map<h256, string> responses;
+	atomic<size_t> calls{0};
+	// Conditions with an even bound are satisfiable, the others are not.
+	auto callback = [&](string const&, string const& _query) {
+		++calls;
+		for (size_t bound = 0; bound < 10; ++bound)
+			if (boost::contains(_query, "(assert (> x " + to_string(bound) + "))"))
+				return ReadCallback::Result{true, bound % 2 ? "unsat\n" : "sat\n((|EVALEXPR_0| " + to_string(bound + 1) + "))\n"};
+		return ReadCallback::Result{true, "unknown\n"};
+	};
+
+	for (size_t contexts: {1u, 3u})
+	{
+		calls = 0;
+		vector<unique_ptr<SolverInterface>> solvers;
+		for (size_t i = 0; i < contexts; ++i)
+			solvers.emplace_back(make_unique<SMTLib2Interface>(responses, callback));
+		SMTSolverPool pool(move(solvers), contexts);
+		Expression x = pool.newVariable("x", SortProvider::sintSort);
+
+		vector<SMTSolverPool::Query> queries;
+		for (size_t bound = 0; bound < 10; ++bound)
+			queries.push_back({x > bound, {x}});
+		auto results = pool.check(queries);
+		BOOST_REQUIRE_EQUAL(results.size(), 10);
+		BOOST_CHECK_EQUAL(calls, 10);
+		for (size_t bound = 0; bound < 10; ++bound)
+		{
+			auto [result, values] = results[bound].get();
+			if (bound % 2)
+			{
+				BOOST_CHECK(result == CheckResult::UNSATISFIABLE);
+				BOOST_CHECK(values.empty());
+			}
+			else
+			{
+				BOOST_CHECK(result == CheckResult::SATISFIABLE);
+				BOOST_CHECK(values == vector<string>{to_string(bound + 1)});
+			}
+		}
+
+		// The conditions of the queries are removed again.
+		BOOST_CHECK(pool.check(vector<Expression>{}).first == CheckResult::UNKNOWN);
+		BOOST_CHECK(pool.unhandledQueries().empty());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(unhandled_queries)
+{
+	map<h256, string> responses;
+	set<string> queriesOfOneContext;
+	vector<string> queriesOfFourContexts;
+	for (auto [contexts, threads]: vector<pair<size_t, size_t>>{{1, 1}, {4, 1}, {4, 4}})
+	{
+		vector<unique_ptr<SolverInterface>> solvers;
+		for (size_t i = 0; i < contexts; ++i)
+			solvers.emplace_back(make_unique<SMTLib2Interface>(responses, ReadCallback::Callback{}));
+		SMTSolverPool pool(move(solvers), threads);
+		Expression x = pool.newVariable("x", SortProvider::uintSort);
+		pool.addAssertion(x < 100);
+
+		vector<SMTSolverPool::Query> queries;
+		for (size_t bound = 0; bound < 7; ++bound)
+			queries.push_back({x > bound, {}});
+		for (auto& result: pool.check(queries))
+			BOOST_CHECK(result.get().first == CheckResult::UNKNOWN);
+
+		vector<string> unhandled = pool.unhandledQueries();
+		BOOST_CHECK_EQUAL(unhandled.size(), 7);
+		// Every context sees the same declarations and assertions.
+		if (queriesOfOneContext.empty())
+			queriesOfOneContext = set<string>(unhandled.begin(), unhandled.end());
+		else
+			BOOST_CHECK(set<string>(unhandled.begin(), unhandled.end()) == queriesOfOneContext);
+		// The queries are assigned to the contexts independently of the number of threads.
+		if (contexts == 4)
+		{
+			if (queriesOfFourContexts.empty())
+				queriesOfFourContexts = unhandled;
+			else
+				BOOST_CHECK(unhandled == queriesOfFourContexts);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
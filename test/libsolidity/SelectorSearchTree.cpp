@@ -0,0 +1,119 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the search tree of the function dispatch.
+ */
+
+#include <libsolidity/codegen/SelectorSearchTree.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace solidity::util;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+vector<FixedHash<4>> selectors(size_t _count)
+{
+	vector<FixedHash<4>> selectors;
+	for (size_t i = 0; i < _count; ++i)
+		selectors.emplace_back(FixedHash<4>::Arith(0x01000000 * (i + 1)));
+	return selectors;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(SelectorSearchTreeTest)
+
+BOOST_AUTO_TEST_CASE(few_functions)
+{
+	SelectorSearchTree tree(selectors(4), 1000000);
+	BOOST_CHECK(tree.isLeaf());
+	BOOST_CHECK(tree.selectors() == selectors(4));
+}
+
+BOOST_AUTO_TEST_CASE(split_depends_on_runs)
+{
+	BOOST_CHECK(SelectorSearchTree(selectors(8), 1).isLeaf());
+
+	vector<FixedHash<4>> ids = selectors(8);
+	SelectorSearchTree tree(ids, 200);
+	BOOST_REQUIRE(!tree.isLeaf());
+	BOOST_CHECK(tree.pivot() == ids[4]);
+	BOOST_REQUIRE(tree.lower().isLeaf());
+	BOOST_REQUIRE(tree.upper().isLeaf());
+	BOOST_CHECK(tree.lower().selectors() == vector<FixedHash<4>>(ids.begin(), ids.begin() + 4));
+	BOOST_CHECK(tree.upper().selectors() == vector<FixedHash<4>>(ids.begin() + 4, ids.end()));
+}
+
+BOOST_AUTO_TEST_CASE(hot_function_first)
+{
+	// A single hot function is compared first instead of splitting. The other functions
+	// get an equal share of the runs if they have no executions.
+	vector<FixedHash<4>> ids = selectors(8);
+	SelectorSearchTree tree(ids, 200, {{ids[5], 1000000}, {ids[2], 10}});
+	BOOST_REQUIRE(tree.isLeaf());
+	BOOST_CHECK(tree.selectors() == (vector<FixedHash<4>>{ids[5], ids[0], ids[1], ids[3], ids[4], ids[6], ids[7], ids[2]}));
+}
+
+BOOST_AUTO_TEST_CASE(equal_executions)
+{
+	vector<FixedHash<4>> ids = selectors(16);
+	map<FixedHash<4>, size_t> executions;
+	for (auto const& id: ids)
+		executions[id] = 100000;
+	SelectorSearchTree tree(ids, 200, executions);
+	BOOST_REQUIRE(!tree.isLeaf());
+	BOOST_CHECK(tree.pivot() == ids[8]);
+	BOOST_REQUIRE(!tree.upper().isLeaf());
+	BOOST_CHECK(tree.upper().pivot() == ids[12]);
+	BOOST_REQUIRE(tree.upper().upper().isLeaf());
+	BOOST_CHECK(tree.upper().upper().selectors() == vector<FixedHash<4>>(ids.begin() + 12, ids.end()));
+}
+
+BOOST_AUTO_TEST_CASE(balance_executions)
+{
+	// The four hot functions are split into two pairs.
+	vector<FixedHash<4>> ids = selectors(16);
+	map<FixedHash<4>, size_t> executions;
+	for (size_t i = 0; i < ids.size(); ++i)
+		executions[ids[i]] = i < 4 ? 1000000 : 1000;
+	SelectorSearchTree tree(ids, 200, executions);
+	BOOST_REQUIRE(!tree.isLeaf());
+	BOOST_CHECK(tree.pivot() == ids[2]);
+	BOOST_REQUIRE(tree.lower().isLeaf());
+	BOOST_CHECK(tree.lower().selectors() == (vector<FixedHash<4>>{ids[0], ids[1]}));
+	BOOST_REQUIRE(tree.upper().isLeaf());
+	BOOST_CHECK_EQUAL(tree.upper().selectors().size(), 14);
+	BOOST_CHECK(tree.upper().selectors().at(0) == ids[2]);
+	BOOST_CHECK(tree.upper().selectors().at(1) == ids[3]);
+	BOOST_CHECK(tree.upper().selectors().at(2) == ids[4]);
+}
+
+BOOST_AUTO_TEST_CASE(no_profile)
+{
+	BOOST_CHECK(SelectorSearchTree::executions({}, nullptr).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -105,6 +105,61 @@ BOOST_AUTO_TEST_CASE(string_escapes_with_zero)
 	BOOST_CHECK_EQUAL(scanner.currentLiteral(), std::string("aa\0abc", 6));
 }
 
+BOOST_AUTO_TEST_CASE(literals_without_escapes_refer_to_source)
+{
+	Scanner scanner(CharStream("x = \"abc\" + \"a\\x62c\" + 1_000 + hex\"0061\";", ""));
+	auto inSource = [&]() {
+		string_view literal = scanner.currentLiteral();
+		return scanner.source().data() <= literal.data() && literal.data() < scanner.source().data() + scanner.source().size();
+	};
+	BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), "x");
+	BOOST_CHECK(inSource());
+	BOOST_CHECK_EQUAL(scanner.next(), Token::Assign);
+	BOOST_CHECK_EQUAL(scanner.next(), Token::StringLiteral);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), "abc");
+	BOOST_CHECK(inSource());
+	BOOST_CHECK_EQUAL(scanner.next(), Token::Add);
+	BOOST_CHECK_EQUAL(scanner.next(), Token::StringLiteral);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), "abc");
+	BOOST_CHECK(!inSource());
+	BOOST_CHECK_EQUAL(scanner.next(), Token::Add);
+	BOOST_CHECK_EQUAL(scanner.next(), Token::Number);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), "1_000");
+	BOOST_CHECK(inSource());
+	BOOST_CHECK_EQUAL(scanner.next(), Token::Add);
+	BOOST_CHECK_EQUAL(scanner.next(), Token::HexStringLiteral);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), string("\0a", 2));
+	BOOST_CHECK_EQUAL(scanner.next(), Token::Semicolon);
+	BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+}
+
+BOOST_AUTO_TEST_CASE(long_comments_identifiers_and_whitespace)
+{
+	// The lengths cover runs that end inside, at the end of and after the blocks the scanner skips at once.
+	for (size_t length = 0; length < 40; ++length)
+	{
+		string run(length, 'a');
+		string source =
+			"x" + run + string(length, ' ') + "// \xc2\xa2" + run + "\n" +
+			"/* * /" + run + "*/" + string(length, '\t') + "y" + run + "// " + run + "\xc2\x85" +
+			"/* " + run;
+		Scanner scanner(CharStream(source, ""));
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), "x" + run);
+		BOOST_CHECK_EQUAL(scanner.next(), Token::Identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), "y" + run);
+		// The comment ends at the non-ascii line terminator, which is not a valid token.
+		BOOST_CHECK_EQUAL(scanner.next(), Token::Illegal);
+		BOOST_CHECK_EQUAL(static_cast<size_t>(scanner.currentLocation().start), source.find("\xc2\x85"));
+		scanner.next();
+		scanner.next();
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Illegal);
+		BOOST_CHECK_EQUAL(scanner.currentError(), ScannerError::IllegalCommentTerminator);
+		BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+	}
+}
+
 BOOST_AUTO_TEST_CASE(string_escape_illegal)
 {
 	Scanner scanner(CharStream(" bla \"\\x6rf\" (illegalescape)", ""));
@@ -24,9 +24,12 @@
 #include <libsolidity/ast/Types.h>
 #include <libsolidity/ast/TypeProvider.h>
 #include <libsolidity/ast/AST.h>
+#include <libsolidity/interface/CompilerStack.h>
 #include <libsolutil/Keccak256.h>
 #include <boost/test/unit_test.hpp>
 
+#include <thread>
+
 using namespace std;
 using namespace solidity::langutil;
 
@@ -287,6 +290,66 @@ BOOST_AUTO_TEST_CASE(helper_string_result)
 	BOOST_REQUIRE_EQUAL(r1.message(), "Failure");
 }
 
+BOOST_AUTO_TEST_CASE(type_provider_instances)
+{
+	TypeProvider provider;
+	size_t initialCount = provider.typeCount();
+	size_t initialUsage = provider.memoryUsage();
+	BOOST_CHECK(initialUsage > sizeof(TypeProvider));
+
+	StringLiteralType const* defaultLiteral = TypeProvider::stringLiteral("abc");
+	BOOST_CHECK(TypeProvider::setCurrent(&provider) == nullptr);
+	StringLiteralType const* literal = TypeProvider::stringLiteral("abc");
+	TypeProvider::array(DataLocation::Memory, TypeProvider::uint256());
+	BOOST_CHECK(TypeProvider::setCurrent(nullptr) == &provider);
+
+	BOOST_CHECK(literal != defaultLiteral);
+	BOOST_CHECK(*literal == *defaultLiteral);
+	BOOST_CHECK(TypeProvider::stringLiteral("abc") == defaultLiteral);
+	BOOST_CHECK_EQUAL(provider.typeCount(), initialCount + 2);
+	BOOST_CHECK(provider.memoryUsage() > initialUsage);
+
+	provider.clear();
+	BOOST_CHECK_EQUAL(provider.typeCount(), initialCount);
+}
+
+BOOST_AUTO_TEST_CASE(type_provider_per_thread)
+{
+	IntegerType const* mainThreadType = TypeProvider::uint256();
+	IntegerType const* otherThreadType = nullptr;
+	thread([&]() { otherThreadType = TypeProvider::uint256(); }).join();
+	BOOST_CHECK(otherThreadType != mainThreadType);
+	BOOST_CHECK(TypeProvider::uint256() == mainThreadType);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_analysis)
+{
+	string const source = R"(
+		pragma solidity >=0.0;
+		contract C {
+			struct S { uint[] a; string s; }
+			mapping(address => S) m;
+			function f(string calldata _s) external returns (string memory) { m[msg.sender].s = _s; return "abc"; }
+		}
+	)";
+	// Stores the number of types of the compilation, leaves it at zero on failure.
+	auto analyze = [&](size_t& _typeCount) {
+		CompilerStack compiler;
+		compiler.setSources({{"", source}});
+		if (compiler.parseAndAnalyze())
+			_typeCount = compiler.typeProvider().typeCount();
+	};
+	vector<size_t> typeCounts(4, 0);
+	vector<thread> threads;
+	for (size_t& typeCount: typeCounts)
+		threads.emplace_back(analyze, ref(typeCount));
+	for (thread& t: threads)
+		t.join();
+	BOOST_CHECK(typeCounts.front() > 0);
+	for (size_t typeCount: typeCounts)
+		BOOST_CHECK_EQUAL(typeCount, typeCounts.front());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -29,6 +29,7 @@
 #include <libsolutil/CommonData.h>
 #include <test/Metadata.h>
 
+#include <functional>
 #include <set>
 
 using namespace std;
@@ -328,6 +329,110 @@ BOOST_AUTO_TEST_CASE(optimizer_runs_not_an_unsigned_number)
 	BOOST_CHECK(containsError(result, "JSONError", "The \"runs\" setting must be an unsigned number."));
 }
 
+BOOST_AUTO_TEST_CASE(parallelism_not_a_positive_number)
+{
+	for (string value: {"\"four\"", "0", "-1"})
+	{
+		string input = R"(
+		{
+			"language": "Solidity",
+			"settings": {
+				"parallelism": )" + value + R"(
+			},
+			"sources": {
+				"empty": {
+					"content": ""
+				}
+			}
+		}
+		)";
+		Json::Value result = compile(input);
+		BOOST_CHECK(containsError(result, "JSONError", "\"settings.parallelism\" must be a positive integer."));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(parallelism_does_not_change_output)
+{
+	auto input = [](unsigned _parallelism) {
+		return R"(
+		{
+			"language": "Solidity",
+			"settings": {
+				"parallelism": )" + to_string(_parallelism) + R"(,
+				"optimizer": { "enabled": true },
+				"outputSelection": { "*": { "*": ["evm.bytecode", "evm.deployedBytecode", "evm.assembly"] } }
+			},
+			"sources": {
+				"fileA": {
+					"content": "import \"fileB\"; contract A { function f() public { new B(); new C(); } } contract D { function f() public returns (bytes memory) { return type(C).runtimeCode; } }"
+				},
+				"fileB": {
+					"content": "contract B { uint x = 7; } contract C { function g() public returns (B) { return new B(); } } contract E { }"
+				}
+			}
+		}
+		)";
+	};
+	Json::Value sequential = compile(input(1));
+	BOOST_REQUIRE(containsAtMostWarnings(sequential));
+	for (unsigned parallelism: {2u, 4u, 16u})
+	{
+		Json::Value parallel = compile(input(parallelism));
+		BOOST_CHECK(containsAtMostWarnings(parallel));
+		BOOST_CHECK_EQUAL(util::jsonCompactPrint(parallel["contracts"]), util::jsonCompactPrint(sequential["contracts"]));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(parallelism_does_not_change_ast)
+{
+	auto input = [](unsigned _parallelism) {
+		return R"(
+		{
+			"language": "Solidity",
+			"settings": {
+				"parallelism": )" + to_string(_parallelism) + R"(,
+				"outputSelection": { "*": { "": ["ast"] } }
+			},
+			"sources": {
+				"fileA": {
+					"content": "import \"fileB\"; import {C as D} from \"fileC\"; contract A is D { function f() public pure returns (uint x) { assembly { x := 1 } } }"
+				},
+				"fileB": {
+					"content": "import \"fileC\" as c; import \"fileD\"; contract B is c.C { uint y; }"
+				},
+				"fileC": {
+					"content": "/** @title C */ contract C { struct S { uint a; } event E(uint indexed a); }"
+				},
+				"fileD": {
+					"content": "import \"fileC\"; library L { enum F { X, Y } }"
+				}
+			}
+		}
+		)";
+	};
+	Json::Value sequential = compile(input(1));
+	BOOST_REQUIRE(containsAtMostWarnings(sequential));
+
+	set<int64_t> ids;
+	function<void(Json::Value const&)> collectIDs = [&](Json::Value const& _node) {
+		if (_node.isObject() && _node.isMember("id") && _node["id"].isInt64())
+			BOOST_CHECK(ids.insert(_node["id"].asInt64()).second);
+		if (_node.isObject() || _node.isArray())
+			for (auto const& child: _node)
+				collectIDs(child);
+	};
+	for (auto const& source: sequential["sources"])
+		collectIDs(source["ast"]);
+	BOOST_CHECK(!ids.empty());
+
+	for (unsigned parallelism: {2u, 4u, 16u})
+	{
+		Json::Value parallel = compile(input(parallelism));
+		BOOST_CHECK(containsAtMostWarnings(parallel));
+		BOOST_CHECK_EQUAL(util::jsonCompactPrint(parallel["sources"]), util::jsonCompactPrint(sequential["sources"]));
+	}
+}
+
 BOOST_AUTO_TEST_CASE(basic_compilation)
 {
 	char const* input = R"(
@@ -1073,6 +1178,70 @@ BOOST_AUTO_TEST_CASE(optimizer_settings_details_different)
 	BOOST_CHECK(optimizer["runs"].asUInt() == 600);
 }
 
+BOOST_AUTO_TEST_CASE(optimizer_settings_gas_profile)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"outputSelection": {
+				"fileA": { "A": [ "metadata", "evm.bytecode.object" ] }
+			},
+			"optimizer": {
+				"enabled": true,
+				"gasProfile": {
+					"ranges": [{ "source": "fileA", "start": 0, "end": 10, "executions": 5000 }],
+					"functions": { "fileA": { "A": { "f": 0 } } }
+				}
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A { function f() public pure returns (uint) { return 1; } }"
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json::Value contract = getContractResult(result, "fileA", "A");
+	BOOST_CHECK(contract.isObject());
+	BOOST_CHECK(contract["evm"]["bytecode"]["object"].isString());
+	Json::Value metadata;
+	BOOST_CHECK(util::jsonParseStrict(contract["metadata"].asString(), metadata));
+
+	Json::Value const& optimizer = metadata["settings"]["optimizer"];
+	BOOST_CHECK(!optimizer.isMember("enabled"));
+	BOOST_CHECK(optimizer["details"]["constantOptimizer"].asBool() == true);
+	BOOST_CHECK(optimizer["details"]["gasProfile"].isString());
+	BOOST_CHECK_EQUAL(optimizer["details"]["gasProfile"].asString().size(), 66);
+}
+
+BOOST_AUTO_TEST_CASE(optimizer_settings_invalid_gas_profile)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"optimizer": {
+				"gasProfile": { "ranges": [{ "source": "fileA", "start": 0, "end": 10, "executions": -1 }] }
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A { }"
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsError(
+		result,
+		"JSONError",
+		"Invalid \"gasProfile\" setting: The executions of range fileA:0-10 must be an unsigned number."
+	));
+}
+
 BOOST_AUTO_TEST_CASE(metadata_without_compilation)
 {
 	// NOTE: the contract code here should fail to compile due to "out of stack"
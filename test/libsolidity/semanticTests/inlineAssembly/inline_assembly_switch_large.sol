@@ -0,0 +1,58 @@
+contract C {
+    function f(uint256 a) public returns (uint256 b) {
+        assembly {
+            switch a
+                case 7 { b := 1 }
+                case 0 { b := 2 }
+                case 3 { b := 3 }
+                case 0xffffffff { b := 4 }
+                case 12 { b := 5 }
+                case 1 { b := 6 }
+                case 0x8000000000000000000000000000000000000000000000000000000000000000 { b := 7 }
+                case 9 { b := 8 }
+                case 4 { b := 9 }
+                case 100 { b := 10 }
+                default { b := 11 }
+        }
+    }
+    function g(uint256 a) public returns (uint256 b) {
+        b = 42;
+        assembly {
+            switch a
+                case 1 { b := 1 }
+                case 2 { b := 2 }
+                case 3 { b := 3 }
+                case 5 { b := 5 }
+                case 8 { b := 8 }
+                case 13 { b := 13 }
+        }
+    }
+}
+
+// ====
+// compileViaYul: also
+// ----
+// f(uint256): 7 -> 1
+// f(uint256): 0 -> 2
+// f(uint256): 3 -> 3
+// f(uint256): 0xffffffff -> 4
+// f(uint256): 12 -> 5
+// f(uint256): 1 -> 6
+// f(uint256): 0x8000000000000000000000000000000000000000000000000000000000000000 -> 7
+// f(uint256): 9 -> 8
+// f(uint256): 4 -> 9
+// f(uint256): 100 -> 10
+// f(uint256): 2 -> 11
+// f(uint256): 8 -> 11
+// f(uint256): 101 -> 11
+// f(uint256): 0xfffffffe -> 11
+// f(uint256): 0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff -> 11
+// g(uint256): 0 -> 42
+// g(uint256): 1 -> 1
+// g(uint256): 2 -> 2
+// g(uint256): 3 -> 3
+// g(uint256): 4 -> 42
+// g(uint256): 5 -> 5
+// g(uint256): 8 -> 8
+// g(uint256): 13 -> 13
+// g(uint256): 14 -> 42
@@ -0,0 +1,109 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the thread pool.
+ */
+
+#include <libsolutil/ThreadPool.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(ThreadPoolTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(single_thread_runs_synchronously)
+{
+	ThreadPool pool(1);
+	BOOST_CHECK_EQUAL(pool.threads(), 1);
+	thread::id caller = this_thread::get_id();
+	thread::id executor;
+	future<int> result = pool.submit([&]() { executor = this_thread::get_id(); return 42; });
+	BOOST_CHECK(executor == caller);
+	BOOST_CHECK_EQUAL(result.get(), 42);
+}
+
+BOOST_AUTO_TEST_CASE(results_and_exceptions)
+{
+	ThreadPool pool(4);
+	BOOST_CHECK_EQUAL(pool.threads(), 4);
+	vector<future<size_t>> results;
+	for (size_t i = 0; i < 100; ++i)
+		results.emplace_back(pool.submit([i]() {
+			if (i == 23)
+				throw runtime_error("failure");
+			return i * i;
+		}));
+	for (size_t i = 0; i < results.size(); ++i)
+		if (i == 23)
+			BOOST_CHECK_THROW(results[i].get(), runtime_error);
+		else
+			BOOST_CHECK_EQUAL(results[i].get(), i * i);
+}
+
+BOOST_AUTO_TEST_CASE(destructor_waits_for_nested_tasks)
+{
+	atomic<size_t> executed{0};
+	{
+		ThreadPool pool(3);
+		for (size_t i = 0; i < 10; ++i)
+			pool.submit([&]() {
+				++executed;
+				for (size_t j = 0; j < 10; ++j)
+					pool.submit([&]() { ++executed; });
+			});
+	}
+	BOOST_CHECK_EQUAL(executed, 110);
+}
+
+BOOST_AUTO_TEST_CASE(tasks_wait_for_nested_tasks)
+{
+	// Every task of every level waits for its children, which would block
+	// all workers if waiting did not run queued tasks.
+	ThreadPool pool(2);
+	function<size_t(size_t)> count = [&](size_t _depth) -> size_t {
+		if (_depth == 0)
+			return 1;
+		vector<future<size_t>> children;
+		for (size_t i = 0; i < 4; ++i)
+			children.emplace_back(pool.submit([&, _depth]() { return count(_depth - 1); }));
+		size_t result = 1;
+		for (auto& child: children)
+		{
+			pool.wait(child);
+			result += child.get();
+		}
+		return result;
+	};
+	future<size_t> total = pool.submit([&]() { return count(4); });
+	pool.wait(total);
+	BOOST_CHECK_EQUAL(total.get(), 1 + 4 + 16 + 64 + 256);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,173 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the call graph cache of the optimiser suite.
+ */
+
+#include <test/Common.h>
+
+#include <test/libyul/Common.h>
+
+#include <libyul/optimiser/BlockHasher.h>
+#include <libyul/optimiser/CallGraphCache.h>
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/AsmData.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+Dialect const& dialect()
+{
+	return EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion());
+}
+
+shared_ptr<Block> parseCode(string const& _source)
+{
+	shared_ptr<Block> ast = yul::test::parse(_source, false).first;
+	BOOST_REQUIRE(ast);
+	return ast;
+}
+
+FunctionDefinition& function(Block& _ast, string const& _name)
+{
+	for (Statement& statement: _ast.statements)
+		if (auto* function = get_if<FunctionDefinition>(&statement))
+			if (function->name == YulString{_name})
+				return *function;
+	BOOST_FAIL("Function not found: " + _name);
+	return get<FunctionDefinition>(_ast.statements.front());
+}
+
+void checkCache(CallGraphCache& _cache, Block const& _ast)
+{
+	CallGraph expectation = CallGraphGenerator::callGraph(_ast);
+	CallGraph const& callGraph = _cache.callGraph(_ast);
+	BOOST_CHECK(callGraph.functionCalls == expectation.functionCalls);
+	BOOST_CHECK(callGraph.functionsWithLoops == expectation.functionsWithLoops);
+	BOOST_CHECK(_cache.sideEffects(_ast) == SideEffectsPropagator::sideEffects(dialect(), expectation));
+}
+}
+
+BOOST_AUTO_TEST_SUITE(CallGraphCacheTest)
+
+BOOST_AUTO_TEST_CASE(unchanged)
+{
+	shared_ptr<Block> ast = parseCode(R"({
+		{ f() }
+		function f() { g() }
+		function g() { for {} 1 {} { sstore(0, 1) } }
+	})");
+	map<YulString, FunctionFingerprint> fingerprints;
+	CallGraphCache cache{dialect(), fingerprints};
+	checkCache(cache, *ast);
+	BOOST_CHECK_EQUAL(fingerprints.size(), 2u);
+	BOOST_CHECK(fingerprints.at(YulString{"f"}) == FunctionHasher::run(function(*ast, "f")));
+	map<YulString, SideEffects> const* sideEffects = &cache.sideEffects(*ast);
+	checkCache(cache, *ast);
+	BOOST_CHECK(sideEffects == &cache.sideEffects(*ast));
+	BOOST_CHECK(!cache.sideEffects(*ast).at(YulString{"f"}).movable);
+}
+
+BOOST_AUTO_TEST_CASE(changed_function)
+{
+	shared_ptr<Block> ast = parseCode(R"({
+		{ f() }
+		function f() { g() }
+		function g() { sstore(0, 1) }
+		function h() { }
+	})");
+	map<YulString, FunctionFingerprint> fingerprints;
+	CallGraphCache cache{dialect(), fingerprints};
+	checkCache(cache, *ast);
+
+	// Fingerprints of modified functions are removed by the owner of the map.
+	FunctionDefinition& f = function(*ast, "f");
+	get<ExpressionStatement>(f.body.statements.front()).expression =
+		std::move(get<ExpressionStatement>(function(*ast, "g").body.statements.front()).expression);
+	function(*ast, "g").body.statements.clear();
+	fingerprints.clear();
+	checkCache(cache, *ast);
+	BOOST_CHECK(cache.callGraph(*ast).functionCalls.at(YulString{"f"}).count(YulString{"sstore"}));
+	BOOST_CHECK(cache.sideEffects(*ast).at(YulString{"g"}).movable);
+
+	function(*ast, "h").body = std::move(f.body);
+	f.body = Block{};
+	fingerprints.erase(YulString{"f"});
+	fingerprints.erase(YulString{"h"});
+	checkCache(cache, *ast);
+	BOOST_CHECK(cache.callGraph(*ast).functionCalls.at(YulString{"f"}).empty());
+	BOOST_CHECK(!cache.sideEffects(*ast).at(YulString{"h"}).movable);
+}
+
+BOOST_AUTO_TEST_CASE(recomputed_fingerprints)
+{
+	shared_ptr<Block> ast = parseCode(R"({
+		{ f() }
+		function f() { g() }
+		function g() { sstore(0, 1) }
+	})");
+	map<YulString, FunctionFingerprint> fingerprints;
+	CallGraphCache cache{dialect(), fingerprints};
+	checkCache(cache, *ast);
+	map<YulString, SideEffects> const* sideEffects = &cache.sideEffects(*ast);
+
+	// Fingerprints with the same contents match, even if they were computed separately.
+	fingerprints.clear();
+	checkCache(cache, *ast);
+	BOOST_CHECK(sideEffects == &cache.sideEffects(*ast));
+
+	// The name of the called function is part of the contents.
+	function(*ast, "g").name = YulString{"h"};
+	FunctionCall& call = get<FunctionCall>(get<ExpressionStatement>(function(*ast, "f").body.statements.front()).expression);
+	call.functionName.name = YulString{"h"};
+	fingerprints.clear();
+	checkCache(cache, *ast);
+	BOOST_CHECK(cache.callGraph(*ast).functionCalls.at(YulString{"f"}).count(YulString{"h"}));
+}
+
+BOOST_AUTO_TEST_CASE(changed_outside_of_functions)
+{
+	shared_ptr<Block> ast = parseCode(R"({
+		{ f() }
+		function f() { }
+		function g() { }
+	})");
+	map<YulString, FunctionFingerprint> fingerprints;
+	CallGraphCache cache{dialect(), fingerprints};
+	checkCache(cache, *ast);
+
+	Statement& call = get<Block>(ast->statements.front()).statements.front();
+	get<FunctionCall>(get<ExpressionStatement>(call).expression).functionName.name = YulString{"g"};
+	checkCache(cache, *ast);
+
+	ast->statements.erase(ast->statements.begin() + 1);
+	fingerprints.erase(YulString{"f"});
+	checkCache(cache, *ast);
+	BOOST_CHECK(!cache.callGraph(*ast).functionCalls.count(YulString{"f"}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -34,17 +34,33 @@ namespace solidity::yul::test
 
 namespace
 {
-string check(string const& _input)
+string check(string const& _input, optional<set<YulString>> const& _functions = nullopt)
 {
 	Object obj;
 	std::tie(obj.code, obj.analysisInfo) = yul::test::parse(_input, false);
 	BOOST_REQUIRE(obj.code);
-	map<YulString, int> functions = CompilabilityChecker::run(EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion()), obj, true);
+	map<YulString, int> functions = CompilabilityChecker::run(
+		EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion()),
+		obj,
+		true,
+		_functions
+	);
 	string out;
 	for (auto const& function: functions)
 		out += function.first.str() + ": " + to_string(function.second) + " ";
 	return out;
 }
+
+size_t stackHeightBound(string const& _input)
+{
+	shared_ptr<Block> code = yul::test::parse(_input, false).first;
+	BOOST_REQUIRE(code);
+	BOOST_REQUIRE(!code->statements.empty());
+	return CompilabilityChecker::stackHeightBound(
+		EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion()),
+		std::get<FunctionDefinition>(code->statements.front())
+	);
+}
 }
 
 BOOST_AUTO_TEST_SUITE(CompilabilityChecker)
@@ -219,6 +235,30 @@ BOOST_AUTO_TEST_CASE(also_in_outer_block)
 	BOOST_CHECK_EQUAL(out, "g: 5 : 9 ");
 }
 
+BOOST_AUTO_TEST_CASE(only_given_functions)
+{
+	string source = R"({
+		function f(a, b) -> r1, r2, r3, r4, r5, r6, r7, r8, r9, r10, r11, r12, r13, r14, r15, r16, r17, r18, r19 {
+		}
+		function g(r1, r2, r3, r4, r5, r6, r7, r8, r9, r10, r11, r12, r13, r14, r15, r16, r17, r18, r19) -> x, y {
+		}
+	})";
+	BOOST_CHECK_EQUAL(check(source, set<YulString>{YulString{"g"}}), "g: 5 ");
+	BOOST_CHECK_EQUAL(check(source, set<YulString>{}), "");
+}
+
+BOOST_AUTO_TEST_CASE(stack_height_bound)
+{
+	// Return label, two arguments, return variable and two arguments of "add" on top.
+	BOOST_CHECK_EQUAL(stackHeightBound("{ function f(a, b) -> x { let y := add(a, mul(b, 2)) x := y } }"), 6);
+	// Expression, case value and a copy of the expression during the comparison.
+	BOOST_CHECK_EQUAL(stackHeightBound("{ function f(a) { switch a case 0 { } default { } } }"), 5);
+	// Return label of the call and its arguments.
+	BOOST_CHECK_EQUAL(stackHeightBound("{ function f() -> x { x := f() pop(g(1, 2, 3)) } function g(a, b, c) -> y { } }"), 6);
+	// Variables declared in the loop header stay on the stack in the body.
+	BOOST_CHECK_EQUAL(stackHeightBound("{ function f() { for { let i := 0 } lt(i, 10) { i := add(i, 1) } { let x := i } } }"), 4);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
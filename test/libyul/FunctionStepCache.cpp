@@ -0,0 +1,176 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the function fingerprints and the function step cache of the optimiser suite.
+ */
+
+#include <test/libyul/Common.h>
+
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/BlockHasher.h>
+#include <libyul/optimiser/FunctionStepCache.h>
+#include <libyul/optimiser/Metrics.h>
+#include <libyul/AsmData.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+shared_ptr<Block> parseCode(string const& _source)
+{
+	shared_ptr<Block> ast = yul::test::parse(_source, false).first;
+	BOOST_REQUIRE(ast);
+	return ast;
+}
+
+FunctionDefinition& function(Block& _ast, string const& _name)
+{
+	for (Statement& statement: _ast.statements)
+		if (auto* function = get_if<FunctionDefinition>(&statement))
+			if (function->name == YulString{_name})
+				return *function;
+	BOOST_FAIL("Function not found: " + _name);
+	return get<FunctionDefinition>(_ast.statements.front());
+}
+
+/// @returns the names of the top-level functions whose bodies are not empty.
+set<string> visibleFunctions(Block const& _ast)
+{
+	set<string> names;
+	for (Statement const& statement: _ast.statements)
+		if (auto const* function = get_if<FunctionDefinition>(&statement))
+			if (!function->body.statements.empty())
+				names.insert(function->name.str());
+	return names;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(FunctionStepCacheTest)
+
+BOOST_AUTO_TEST_CASE(fingerprints)
+{
+	shared_ptr<Block> ast = parseCode(R"({
+		function f(a) -> b { b := add(a, 1) }
+		function g(a) -> b { b := add(a, 1) }
+		function h(a) -> b { b := add(a, 2) }
+		function i(a) -> c { c := add(a, 1) }
+	})");
+	FunctionFingerprint f = FunctionHasher::run(function(*ast, "f"));
+	BOOST_CHECK(f == FunctionHasher::run(function(*ast, "f")));
+	BOOST_CHECK(f == FunctionHasher::run(function(*parseCode("{ function f(a) -> b { b := add(a, 1) } }"), "f")));
+	BOOST_CHECK(f != FunctionHasher::run(function(*ast, "g")));
+
+	// Apart from the name, h only differs in a literal and i only in the name of a variable.
+	FunctionDefinition& h = function(*ast, "h");
+	FunctionDefinition& i = function(*ast, "i");
+	h.name = i.name = YulString{"f"};
+	BOOST_CHECK(f != FunctionHasher::run(h));
+	BOOST_CHECK(f != FunctionHasher::run(i));
+	FunctionDefinition& g = function(*ast, "g");
+	g.name = YulString{"f"};
+	BOOST_CHECK(f == FunctionHasher::run(g));
+}
+
+BOOST_AUTO_TEST_CASE(reuse_and_invalidation)
+{
+	shared_ptr<Block> ast = parseCode(R"({
+		{ f() }
+		function f() { sstore(0, 1) sstore(1, 2) }
+		function g() { sstore(2, 3) }
+	})");
+	map<YulString, FunctionFingerprint> fingerprints;
+	FunctionStepCache cache{fingerprints};
+
+	// Removes the last statement of f, as long as there is more than one.
+	set<string> visible;
+	auto step = [&](Block& _ast) {
+		visible = visibleFunctions(_ast);
+		auto& body = function(_ast, "f").body.statements;
+		if (body.size() > 1)
+			body.pop_back();
+	};
+
+	cache.runFunctionLocalStep("step", *ast, step);
+	BOOST_CHECK(visible == (set<string>{"f", "g"}));
+	BOOST_CHECK_EQUAL(function(*ast, "f").body.statements.size(), 1u);
+	BOOST_CHECK(fingerprints.at(YulString{"f"}) == FunctionHasher::run(function(*ast, "f")));
+
+	// g was left unchanged, f was changed.
+	cache.runFunctionLocalStep("step", *ast, step);
+	BOOST_CHECK(visible == (set<string>{"f"}));
+	BOOST_CHECK_EQUAL(cache.hiddenFunctions(), 1u);
+	// The hidden body is restored.
+	BOOST_CHECK_EQUAL(function(*ast, "g").body.statements.size(), 1u);
+
+	cache.runFunctionLocalStep("step", *ast, step);
+	BOOST_CHECK(visible.empty());
+	BOOST_CHECK_EQUAL(cache.hiddenFunctions(), 3u);
+
+	// Other steps do not know about the functions yet.
+	cache.runFunctionLocalStep("other step", *ast, step);
+	BOOST_CHECK(visible == (set<string>{"f", "g"}));
+
+	// A function modified outside of the cache is visible again once its fingerprint is removed.
+	function(*ast, "g").body.statements.emplace_back(ASTCopier{}.translate(function(*ast, "f").body.statements.front()));
+	fingerprints.erase(YulString{"g"});
+	cache.runFunctionLocalStep("step", *ast, step);
+	BOOST_CHECK(visible == (set<string>{"g"}));
+
+	// Steps that are not function-local remove all fingerprints. The recomputed
+	// fingerprint of an unchanged function still matches.
+	function(*ast, "f").body.statements.clear();
+	fingerprints.clear();
+	cache.runFunctionLocalStep("step", *ast, step);
+	BOOST_CHECK(visible.empty());
+	cache.runFunctionLocalStep("step", *ast, step);
+	BOOST_CHECK(visible.empty());
+	BOOST_CHECK_EQUAL(function(*ast, "g").body.statements.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(code_size)
+{
+	shared_ptr<Block> ast = parseCode(R"({
+		{ f() }
+		function f() { sstore(0, 1) sstore(1, 2) }
+		function g() { sstore(2, 3) function h() { sstore(3, 4) } }
+	})");
+	map<YulString, FunctionFingerprint> fingerprints;
+	FunctionStepCache cache{fingerprints};
+	BOOST_CHECK_EQUAL(cache.codeSizeIncludingFunctions(*ast), CodeSize::codeSizeIncludingFunctions(*ast));
+
+	cache.runFunctionLocalStep("step", *ast, [](Block&) {});
+	BOOST_CHECK_EQUAL(cache.codeSizeIncludingFunctions(*ast), CodeSize::codeSizeIncludingFunctions(*ast));
+
+	cache.runFunctionLocalStep("other step", *ast, [](Block& _ast) {
+		function(_ast, "f").body.statements.pop_back();
+	});
+	BOOST_CHECK_EQUAL(cache.codeSizeIncludingFunctions(*ast), CodeSize::codeSizeIncludingFunctions(*ast));
+
+	function(*ast, "g").body.statements.pop_back();
+	fingerprints.erase(YulString{"g"});
+	BOOST_CHECK_EQUAL(cache.codeSizeIncludingFunctions(*ast), CodeSize::codeSizeIncludingFunctions(*ast));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,93 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the cache of optimised code.
+ */
+
+#include <test/Common.h>
+
+#include <libyul/optimiser/OptimisedCodeCache.h>
+#include <libyul/AsmData.h>
+#include <libyul/AsmPrinter.h>
+#include <libyul/AssemblyStack.h>
+#include <libyul/backends/evm/EVMDialect.h>
+
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace solidity::util;
+
+namespace solidity::yul::test
+{
+
+BOOST_AUTO_TEST_SUITE(YulOptimisedCodeCache, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(encode_decode)
+{
+	langutil::EVMVersion evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	AssemblyStack stack(evmVersion, AssemblyStack::Language::StrictAssembly, frontend::OptimiserSettings::full());
+	BOOST_REQUIRE(stack.parseAndAnalyze("", R"({
+		function f(a, b) -> c { c := add(a, mul(b, 2)) }
+		for { let i := 0 } lt(i, calldataload(0)) { i := add(i, 1) } {
+			switch calldataload(i)
+			case 0 { sstore(i, f(i, "abc")) }
+			default { if iszero(i) { revert(0, 0) } }
+		}
+		mstore(0x40, f(calldataload(4), 3))
+	})"));
+	stack.optimize();
+	Block const& code = *stack.parserResult()->code;
+	unsigned sourceIndex = code.location.sourceIndex;
+	BOOST_REQUIRE(sourceIndex != 0);
+
+	optional<Json::Value> entry = OptimisedCodeCache::encode(code, sourceIndex);
+	BOOST_REQUIRE(entry);
+	BOOST_CHECK(!OptimisedCodeCache::encode(code, sourceIndex + 1));
+
+	EVMDialect const& dialect = EVMDialect::strictAssemblyForEVMObjects(evmVersion);
+	shared_ptr<Block> decoded = OptimisedCodeCache::decode(*entry, dialect, sourceIndex);
+	BOOST_REQUIRE(decoded);
+	BOOST_CHECK_EQUAL(AsmPrinter{}(*decoded), AsmPrinter{}(code));
+	optional<Json::Value> reencoded = OptimisedCodeCache::encode(*decoded, sourceIndex);
+	BOOST_REQUIRE(reencoded);
+	BOOST_CHECK_EQUAL(jsonCompactPrint(*reencoded), jsonCompactPrint(*entry));
+
+	Json::Value truncated = *entry;
+	truncated["locations"].resize(truncated["locations"].size() - 3);
+	BOOST_CHECK(!OptimisedCodeCache::decode(truncated, dialect, sourceIndex));
+	Json::Value invalid = *entry;
+	invalid["code"] = "{ let x := }";
+	BOOST_CHECK(!OptimisedCodeCache::decode(invalid, dialect, sourceIndex));
+}
+
+BOOST_AUTO_TEST_CASE(eviction)
+{
+	OptimisedCodeCache cache(2);
+	for (string const& name: {"a", "b", "c"})
+		cache.store(keccak256(name), Json::Value(name));
+	BOOST_CHECK(!cache.load(keccak256("a")));
+	BOOST_CHECK_EQUAL(cache.load(keccak256("b"))->asString(), "b");
+	BOOST_CHECK_EQUAL(cache.load(keccak256("c"))->asString(), "c");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
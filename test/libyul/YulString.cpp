@@ -0,0 +1,157 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for YulString and the YulStringRepository.
+ */
+
+#include <libyul/AsmData.h>
+#include <libyul/YulString.h>
+#include <libyul/backends/evm/EVMDialect.h>
+
+#include <liblangutil/CharStream.h>
+#include <liblangutil/EVMVersion.h>
+#include <liblangutil/SourceLocation.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace solidity::langutil;
+
+namespace solidity::yul::test
+{
+
+BOOST_AUTO_TEST_SUITE(YulStringRepositoryTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(interning)
+{
+	YulStringRepository repository;
+	BOOST_CHECK_EQUAL(repository.stringToHandle("").id, 0);
+	BOOST_CHECK_EQUAL(repository.idToString(0), "");
+
+	// Spans several segments of the lookup table.
+	vector<YulStringRepository::Handle> handles;
+	for (size_t i = 0; i < 5000; ++i)
+		handles.emplace_back(repository.stringToHandle("s" + to_string(i)));
+	BOOST_CHECK_EQUAL(repository.size(), 5001);
+	for (size_t i = 0; i < handles.size(); ++i)
+	{
+		string name = "s" + to_string(i);
+		BOOST_CHECK_EQUAL(repository.idToString(handles[i].id), name);
+		BOOST_CHECK_EQUAL(repository.stringToHandle(name).id, handles[i].id);
+		BOOST_CHECK_EQUAL(handles[i].hash, YulStringRepository::hash(name));
+	}
+	BOOST_CHECK_EQUAL(repository.size(), 5001);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_interning)
+{
+	YulStringRepository repository;
+	// Prime, so that every thread visits all indices.
+	size_t const stringCount = 3001;
+	// Every thread interns the same strings in a different order.
+	vector<vector<size_t>> ids(4, vector<size_t>(stringCount));
+	vector<thread> threads;
+	for (size_t t = 0; t < ids.size(); ++t)
+		threads.emplace_back([&, t]() {
+			for (size_t i = 0; i < stringCount; ++i)
+			{
+				size_t index = (i * (2 * t + 1)) % stringCount;
+				ids[t][index] = repository.stringToHandle("x" + to_string(index)).id;
+			}
+		});
+	for (thread& t: threads)
+		t.join();
+
+	BOOST_CHECK_EQUAL(repository.size(), stringCount + 1);
+	for (size_t i = 0; i < stringCount; ++i)
+	{
+		BOOST_CHECK_EQUAL(repository.idToString(ids[0][i]), "x" + to_string(i));
+		for (size_t t = 1; t < ids.size(); ++t)
+			BOOST_CHECK_EQUAL(ids[t][i], ids[0][i]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(scopes)
+{
+	YulString outer("scoped");
+	EVMDialect const* outerDialect = &EVMDialect::strictAssemblyForEVM(EVMVersion{});
+	{
+		YulStringRepository::Scope scope;
+		BOOST_CHECK(&YulStringRepository::instance() == &scope.repository());
+		YulString inner("scoped");
+		BOOST_CHECK_EQUAL(inner.str(), "scoped");
+		BOOST_CHECK_EQUAL(scope.repository().size(), 2);
+
+		EVMDialect const& dialect = EVMDialect::strictAssemblyForEVM(EVMVersion{});
+		BOOST_CHECK(&dialect != outerDialect);
+		BOOST_CHECK(&dialect == &EVMDialect::strictAssemblyForEVM(EVMVersion{}));
+		BOOST_CHECK(dialect.builtin("add"_yulstring));
+	}
+	BOOST_CHECK_EQUAL(outer.str(), "scoped");
+	BOOST_CHECK(&EVMDialect::strictAssemblyForEVM(EVMVersion{}) == outerDialect);
+}
+
+BOOST_AUTO_TEST_CASE(locations)
+{
+	YulStringRepository repository;
+	auto source = make_shared<CharStream>("{ }", "a.yul");
+	auto otherSource = make_shared<CharStream>("{ }", "b.yul");
+
+	Location location{SourceLocation{1, 2, source}, repository};
+	BOOST_CHECK_EQUAL(location.start, 1);
+	BOOST_CHECK_EQUAL(location.end, 2);
+	BOOST_CHECK(location == Location(SourceLocation{1, 2, source}, repository));
+	BOOST_CHECK(location != Location(SourceLocation{1, 2, otherSource}, repository));
+	BOOST_CHECK(location.toSourceLocation(repository) == (SourceLocation{1, 2, source}));
+	BOOST_CHECK(Location(SourceLocation{1, 2, otherSource}, repository).toSourceLocation(repository).source == otherSource);
+
+	Location empty;
+	BOOST_CHECK_EQUAL(empty.sourceIndex, 0);
+	BOOST_CHECK(empty == Location(SourceLocation{}, repository));
+	BOOST_CHECK(!empty.toSourceLocation(repository).source);
+}
+
+BOOST_AUTO_TEST_CASE(locations_do_not_depend_on_current_repository)
+{
+	YulStringRepository repository;
+	YulStringRepository::Scope scope;
+	vector<shared_ptr<CharStream>> sources;
+	vector<Location> locations;
+	// More sources than fit into the first segment of the source table.
+	for (int i = 0; i < 2000; ++i)
+	{
+		sources.emplace_back(make_shared<CharStream>("", to_string(i) + ".yul"));
+		locations.emplace_back(SourceLocation{i, i + 1, sources.back()}, repository);
+	}
+
+	// Converted on another thread, which uses a different repository.
+	size_t mismatches = 0;
+	thread([&]() {
+		for (size_t i = 0; i < sources.size(); ++i)
+			if (locations[i].toSourceLocation(repository) != SourceLocation{int(i), int(i) + 1, sources[i]})
+				++mismatches;
+	}).join();
+	BOOST_CHECK_EQUAL(mismatches, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
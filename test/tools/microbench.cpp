@@ -0,0 +1,418 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Micro-benchmarks for performance critical parts of the compiler.
+ */
+
+#include <libsolidity/interface/CompilerStack.h>
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <liblangutil/CharStream.h>
+#include <liblangutil/Scanner.h>
+
+#include <libevmasm/CommonSubexpressionEliminator.h>
+#include <libevmasm/KnownState.h>
+#include <libevmasm/SemanticInformation.h>
+
+#include <libyul/AssemblyStack.h>
+#include <libyul/Object.h>
+#include <libyul/YulString.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/Disambiguator.h>
+#include <libyul/optimiser/ExpressionSimplifier.h>
+#include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/OptimiserStep.h>
+
+#include <libsolutil/CommonIO.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::evmasm;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+struct BenchmarkSettings
+{
+	/// Maximum number of threads, benchmarks supporting concurrency run with 1, 2, 4, ... threads.
+	size_t threads = 1;
+	/// Number of operations per thread.
+	size_t iterations = 1000000;
+	/// Directories whose Solidity files are used as input for the scanner benchmark.
+	vector<string> corpora;
+};
+
+/// Runs @a _work on @a _threads threads concurrently.
+/// @returns the wall-clock time in seconds until all of them have finished.
+double runConcurrently(size_t _threads, function<void(size_t)> const& _work)
+{
+	auto start = chrono::steady_clock::now();
+	vector<thread> threads;
+	for (size_t i = 0; i < _threads; ++i)
+		threads.emplace_back(_work, i);
+	for (thread& t: threads)
+		t.join();
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+void report(string const& _name, size_t _threads, size_t _operations, double _seconds)
+{
+	cout <<
+		left << setw(24) << _name <<
+		right << setw(4) << _threads << " threads " <<
+		setw(12) << fixed << setprecision(0) << (double(_operations) / _seconds) << " ops/s" <<
+		endl;
+}
+
+void reportThroughput(string const& _name, size_t _threads, size_t _bytes, double _seconds)
+{
+	cout <<
+		left << setw(24) << _name <<
+		right << setw(4) << _threads << " threads " <<
+		setw(12) << fixed << setprecision(1) << (double(_bytes) / _seconds / 1e6) << " MB/s" <<
+		endl;
+}
+
+/// Interns identifiers drawn from a fixed vocabulary, which is how the parser and the optimiser
+/// use the YulStringRepository: Most strings are already known, some are new.
+void yulStrings(BenchmarkSettings const& _settings)
+{
+	size_t const vocabularySize = 20000;
+	vector<string> vocabulary;
+	for (size_t i = 0; i < vocabularySize; ++i)
+		vocabulary.emplace_back("identifier_" + to_string(i * 7919));
+
+	for (size_t threads = 1; threads <= _settings.threads; threads *= 2)
+	{
+		yul::YulStringRepository repository;
+		vector<vector<size_t>> ids(threads);
+		double seconds = runConcurrently(threads, [&](size_t _thread) {
+			ids[_thread].reserve(_settings.iterations);
+			for (size_t i = 0; i < _settings.iterations; ++i)
+				ids[_thread].emplace_back(
+					repository.stringToHandle(vocabulary[(i * 31 + _thread * 997) % vocabularySize]).id
+				);
+		});
+		report("intern", threads, threads * _settings.iterations, seconds);
+
+		// Results are stored so that the lookups are not optimised away.
+		vector<size_t> lengths(threads, 0);
+		seconds = runConcurrently(threads, [&](size_t _thread) {
+			for (size_t id: ids[_thread])
+				lengths[_thread] += repository.idToString(id).size();
+		});
+		report("idToString", threads, threads * _settings.iterations, seconds);
+	}
+}
+
+/// Contract whose unoptimised runtime assembly is used as input for the assembly benchmarks.
+string const c_assemblySource = R"(
+pragma solidity >=0.0;
+contract Token {
+	mapping(address => uint) public balanceOf;
+	mapping(address => mapping(address => uint)) public allowance;
+	uint public totalSupply;
+	uint8 public decimals = 18;
+	event Transfer(address indexed from, address indexed to, uint value);
+	event Approval(address indexed owner, address indexed spender, uint value);
+	constructor(uint _supply) public { balanceOf[msg.sender] = totalSupply = _supply; }
+	function transfer(address _to, uint _value) public returns (bool) {
+		return transferFrom(msg.sender, _to, _value);
+	}
+	function transferFrom(address _from, address _to, uint _value) public returns (bool) {
+		if (_from != msg.sender) {
+			require(allowance[_from][msg.sender] >= _value);
+			allowance[_from][msg.sender] -= _value;
+		}
+		require(balanceOf[_from] >= _value && balanceOf[_to] + _value >= balanceOf[_to]);
+		balanceOf[_from] -= _value;
+		balanceOf[_to] += _value;
+		emit Transfer(_from, _to, _value);
+		return true;
+	}
+	function approve(address _spender, uint _value) public returns (bool) {
+		allowance[msg.sender][_spender] = _value;
+		emit Approval(msg.sender, _spender, _value);
+		return true;
+	}
+	function batch(address[] calldata _to, uint[] calldata _values) external {
+		for (uint i = 0; i < _to.length; ++i)
+			transfer(_to[i], _values[i % _values.length] * 10 ** uint(decimals) / 3 + (i << 2));
+	}
+	function digest(bytes memory _data, uint _rounds) public pure returns (bytes32 h) {
+		for (uint i = 0; i < _rounds; ++i)
+			h = keccak256(abi.encodePacked(h, _data, i, uint8(i) ^ 0x5a));
+	}
+}
+)";
+
+/// Runs the common subexpression eliminator on the basic blocks of the unoptimised runtime code
+/// of a token contract, in the same way as the assembly optimiser does.
+void commonSubexpressions(BenchmarkSettings const& _settings)
+{
+	frontend::CompilerStack compiler;
+	compiler.setSources({{"token.sol", c_assemblySource}});
+	compiler.setOptimiserSettings(frontend::OptimiserSettings::minimal());
+	if (!compiler.compile())
+	{
+		cerr << "Could not compile the benchmark contract." << endl;
+		return;
+	}
+	AssemblyItems const& items = *compiler.runtimeAssemblyItems("token.sol:Token");
+	bool usesMSize = find(items.begin(), items.end(), AssemblyItem(Instruction::MSIZE)) != items.end();
+
+	vector<pair<size_t, size_t>> blocks;
+	for (size_t begin = 0, end = 0; end < items.size(); begin = end)
+	{
+		while (end < items.size() && !SemanticInformation::breaksCSEAnalysisBlock(items[end], usesMSize))
+			++end;
+		if (end < items.size())
+			++end;
+		blocks.emplace_back(begin, end);
+	}
+
+	size_t const iterations = max<size_t>(_settings.iterations / 100, 1);
+	for (size_t threads = 1; threads <= _settings.threads; threads *= 2)
+	{
+		// Results are stored so that the optimisation is not optimised away.
+		vector<size_t> optimisedSizes(threads, 0);
+		double seconds = runConcurrently(threads, [&](size_t _thread) {
+			for (size_t i = 0; i < iterations; ++i)
+			{
+				auto [begin, end] = blocks[(i + _thread) % blocks.size()];
+				KnownState emptyState;
+				CommonSubexpressionEliminator eliminator{emptyState};
+				eliminator.feedItems(
+					items.begin() + static_cast<ptrdiff_t>(begin),
+					items.begin() + static_cast<ptrdiff_t>(end),
+					usesMSize
+				);
+				try
+				{
+					optimisedSizes[_thread] += eliminator.getOptimizedItems().size();
+				}
+				catch (StackTooDeepException const&)
+				{
+					// The assembly optimiser keeps the original block in these cases.
+				}
+				catch (ItemNotAvailableException const&)
+				{
+				}
+			}
+		});
+		report("basic blocks", threads, threads * iterations, seconds);
+	}
+}
+
+/// Runs the Yul expression simplifier on code in the style of the ABI coder: Values loaded
+/// from calldata are cleaned, shifted and combined, some of which can be simplified.
+void expressionSimplifier(BenchmarkSettings const& _settings)
+{
+	string source = "{\n";
+	for (size_t i = 0; i < 100; ++i)
+	{
+		string x = "x" + to_string(i);
+		string offset = to_string(i * 32);
+		source +=
+			"let " + x + " := calldataload(" + offset + ")\n"
+			"sstore(" + to_string(i) + ", add(and(" + x + ", 0xff), mul(sub(" + x + ", " + x + "), 3)))\n"
+			"mstore(" + offset + ", or(shl(8, and(shr(8, " + x + "), 0xffff)), iszero(iszero(lt(" + x + ", " + offset + ")))))\n"
+			"mstore(add(" + offset + ", 0x20), and(and(" + x + ", 0xffffffffffffffffffffffffffffffffffffffff), sub(shl(160, 1), 1)))\n";
+	}
+	source += "}\n";
+
+	solidity::langutil::EVMVersion evmVersion;
+	yul::AssemblyStack stack(evmVersion, yul::AssemblyStack::Language::StrictAssembly, frontend::OptimiserSettings::none());
+	if (!stack.parseAndAnalyze("simplifier.yul", source))
+	{
+		cerr << "Could not parse the benchmark code." << endl;
+		return;
+	}
+	yul::Dialect const& dialect = yul::EVMDialect::strictAssemblyForEVMObjects(evmVersion);
+	shared_ptr<yul::Object> object = stack.parserResult();
+	yul::Block const ast = get<yul::Block>(yul::Disambiguator(dialect, *object->analysisInfo)(*object->code));
+
+	size_t const iterations = max<size_t>(_settings.iterations / 10000, 1);
+	for (size_t threads = 1; threads <= _settings.threads; threads *= 2)
+	{
+		// The simplifier modifies the code, so every run gets its own copy.
+		vector<vector<yul::Block>> copies(threads);
+		for (auto& threadCopies: copies)
+			for (size_t i = 0; i < iterations; ++i)
+				threadCopies.emplace_back(get<yul::Block>(yul::ASTCopier{}(ast)));
+
+		double seconds = runConcurrently(threads, [&](size_t _thread) {
+			set<yul::YulString> reservedIdentifiers;
+			yul::NameDispenser dispenser{dialect, ast};
+			yul::OptimiserStepContext context{dialect, dispenser, reservedIdentifiers};
+			for (yul::Block& block: copies[_thread])
+				yul::ExpressionSimplifier::run(context, block);
+		});
+		report("simplify 400 statements", threads, threads * iterations, seconds);
+	}
+}
+
+/// Tokenises all Solidity files of the corpora, including the literals of the tokens,
+/// which is the work the scanner does for the parser.
+void scanner(BenchmarkSettings const& _settings)
+{
+	vector<shared_ptr<solidity::langutil::CharStream>> sources;
+	size_t bytes = 0;
+	for (string const& corpus: _settings.corpora)
+	{
+		if (!boost::filesystem::is_directory(corpus))
+		{
+			cerr << "Corpus not found: " << corpus << endl;
+			continue;
+		}
+		for (auto const& entry: boost::filesystem::recursive_directory_iterator(corpus))
+			if (entry.path().extension() == ".sol")
+			{
+				string content = util::readFileAsString(entry.path().string());
+				bytes += content.size();
+				sources.emplace_back(make_shared<solidity::langutil::CharStream>(move(content), entry.path().string()));
+			}
+	}
+	if (sources.empty())
+	{
+		cerr << "No Solidity files found." << endl;
+		return;
+	}
+	cout << sources.size() << " files, " << bytes << " bytes" << endl;
+
+	size_t const iterations = max<size_t>(_settings.iterations / 100000, 1);
+	for (size_t threads = 1; threads <= _settings.threads; threads *= 2)
+	{
+		// Results are stored so that the scanning is not optimised away.
+		vector<size_t> literalSizes(threads, 0);
+		double seconds = runConcurrently(threads, [&](size_t _thread) {
+			for (size_t i = 0; i < iterations; ++i)
+				for (auto const& source: sources)
+				{
+					solidity::langutil::Scanner scanner{source};
+					for (; scanner.currentToken() != solidity::langutil::Token::EOS; scanner.next())
+						literalSizes[_thread] += scanner.currentLiteral().size();
+				}
+		});
+		reportThroughput("scan", threads, threads * iterations * bytes, seconds);
+	}
+}
+
+map<string, function<void(BenchmarkSettings const&)>> const c_benchmarks{
+	{"cse", commonSubexpressions},
+	{"scanner", scanner},
+	{"simplifier", expressionSimplifier},
+	{"yulstrings", yulStrings}
+};
+
+}
+
+int main(int argc, char** argv)
+{
+	string benchmarkNames;
+	for (auto const& benchmark: c_benchmarks)
+		benchmarkNames += "  " + benchmark.first + "\n";
+
+	po::options_description options(
+		R"(microbench, micro-benchmarks for the compiler.
+Usage: microbench [Options] [benchmark...]
+Runs the given benchmarks or all of them and prints their throughput.
+
+Available benchmarks:
+)" + benchmarkNames + R"(
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		(
+			"threads",
+			po::value<size_t>()->default_value(thread::hardware_concurrency() ? thread::hardware_concurrency() : 1),
+			"Maximum number of threads for concurrent benchmarks."
+		)
+		("iterations", po::value<size_t>()->default_value(1000000), "Number of operations per thread.")
+		(
+			"corpus",
+			po::value<vector<string>>()->default_value({"test"}, "test"),
+			"Directory with Solidity files for the scanner benchmark, e.g. the checkout of an external test. "
+			"Can be given multiple times."
+		)
+		("benchmark", po::value<vector<string>>(), "benchmark to run");
+	po::positional_options_description benchmarkPositions;
+	benchmarkPositions.add("benchmark", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(benchmarkPositions);
+		po::store(cmdLineParser.run(), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	BenchmarkSettings settings;
+	settings.threads = max<size_t>(arguments["threads"].as<size_t>(), 1);
+	settings.iterations = arguments["iterations"].as<size_t>();
+	settings.corpora = arguments["corpus"].as<vector<string>>();
+
+	vector<string> selected;
+	if (arguments.count("benchmark"))
+		selected = arguments["benchmark"].as<vector<string>>();
+	else
+		for (auto const& benchmark: c_benchmarks)
+			selected.emplace_back(benchmark.first);
+
+	for (string const& name: selected)
+	{
+		if (!c_benchmarks.count(name))
+		{
+			cerr << "Unknown benchmark: " << name << endl;
+			return 1;
+		}
+		cout << name << ":" << endl;
+		c_benchmarks.at(name)(settings);
+	}
+
+	return 0;
+}
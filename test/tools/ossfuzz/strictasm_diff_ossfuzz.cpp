@@ -56,7 +56,7 @@ extern "C" int LLVMFuzzerTestOneInput(uint8_t const* _data, size_t _size)
 	}))
 		return 0;
 
-	YulStringRepository::reset();
+	YulStringRepository::Scope yulStringScope;
 
 	AssemblyStack stack(
 		langutil::EVMVersion(),
@@ -50,7 +50,7 @@ DEFINE_PROTO_FUZZER(Program const& _input)
 	if (yul_source.size() > 1200)
 		return;
 
-	YulStringRepository::reset();
+	YulStringRepository::Scope yulStringScope;
 
 	// AssemblyStack entry point
 	AssemblyStack stack(
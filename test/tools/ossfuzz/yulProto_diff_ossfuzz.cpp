@@ -68,7 +68,7 @@ DEFINE_PROTO_FUZZER(Program const& _input)
 		of.write(yul_source.data(), static_cast<streamsize>(yul_source.size()));
 	}
 
-	YulStringRepository::reset();
+	YulStringRepository::Scope yulStringScope;
 
 	// AssemblyStack entry point
 	AssemblyStack stack(
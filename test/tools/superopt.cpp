@@ -0,0 +1,135 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Runs the superoptimiser search and prints the rule table in the format of
+ * libevmasm/SuperoptimiserRules.h.
+ */
+
+#include <libevmasm/Superoptimiser.h>
+
+#include <boost/program_options.hpp>
+
+#include <iostream>
+#include <string>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::evmasm;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+string itemsToSource(AssemblyItems const& _items)
+{
+	string source = "{";
+	for (AssemblyItem const& item: _items)
+	{
+		if (source.size() > 1)
+			source += ", ";
+		if (item.type() == Operation)
+			source += "Instruction::" + instructionInfo(item.instruction()).name;
+		else
+			source += "u256(" + item.data().str() + ")";
+	}
+	return source + "}";
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(superopt, offline search for cheaper equivalents of short instruction sequences.
+Usage: superopt [Options] > libevmasm/SuperoptimiserRules.h
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("max-length", po::value<size_t>()->default_value(3), "Maximum length of the windows.");
+
+	po::variables_map arguments;
+	try
+	{
+		po::store(po::parse_command_line(argc, argv, options), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	size_t maxLength = arguments["max-length"].as<size_t>();
+	vector<Superoptimiser::Rule> rules = Superoptimiser::search(Superoptimiser::defaultAlphabet(), maxLength);
+
+	cout << R"(/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Rules found by the superoptimiser, generated by test/tools/superopt.cpp. Do not edit.
+)";
+	cout << " * Windows of at most " << maxLength << " items, " << rules.size() << " rules.\n";
+	cout << R"( */
+
+#pragma once
+
+#include <libevmasm/Superoptimiser.h>
+
+#include <vector>
+
+namespace solidity::evmasm
+{
+
+inline std::vector<Superoptimiser::Rule> superoptimiserRuleTable()
+{
+	return {
+)";
+	for (size_t i = 0; i < rules.size(); ++i)
+		cout <<
+			"\t\t{" << itemsToSource(rules[i].window) << ", " << itemsToSource(rules[i].replacement) << "}" <<
+			(i + 1 < rules.size() ? "," : "") << "\n";
+	cout << R"(	};
+}
+
+}
+)";
+	return 0;
+}